@@ -0,0 +1,2542 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "src/parser/parser.bison"
+
+/* C declarations & preamble code */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "decl.h"
+#include "expr.h"
+#include "param_list.h"
+#include "stmt.h"
+#include "symbol.h"
+#include "type.h"
+#include "scanner.h"
+
+int yyerror(yyscan_t scanner, Compiler *c, const char *str);
+
+
+#line 89 "build/parser.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "token.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_TOKEN_ERROR = 3,                /* TOKEN_ERROR  */
+  YYSYMBOL_TOKEN_IDENTIFIER = 4,           /* TOKEN_IDENTIFIER  */
+  YYSYMBOL_TOKEN_STRING_LITERAL = 5,       /* TOKEN_STRING_LITERAL  */
+  YYSYMBOL_TOKEN_INTEGER_LITERAL = 6,      /* TOKEN_INTEGER_LITERAL  */
+  YYSYMBOL_TOKEN_HEXIDECIMAL_LITERAL = 7,  /* TOKEN_HEXIDECIMAL_LITERAL  */
+  YYSYMBOL_TOKEN_BINARY_LITERAL = 8,       /* TOKEN_BINARY_LITERAL  */
+  YYSYMBOL_TOKEN_DOUBLE_LITERAL = 9,       /* TOKEN_DOUBLE_LITERAL  */
+  YYSYMBOL_TOKEN_DOUBLE_SCIENTIFIC_LITERAL = 10, /* TOKEN_DOUBLE_SCIENTIFIC_LITERAL  */
+  YYSYMBOL_TOKEN_CHAR_LITERAL = 11,        /* TOKEN_CHAR_LITERAL  */
+  YYSYMBOL_TOKEN_ARRAY = 12,               /* TOKEN_ARRAY  */
+  YYSYMBOL_TOKEN_AUTO = 13,                /* TOKEN_AUTO  */
+  YYSYMBOL_TOKEN_BOOLEAN = 14,             /* TOKEN_BOOLEAN  */
+  YYSYMBOL_TOKEN_CARRAY = 15,              /* TOKEN_CARRAY  */
+  YYSYMBOL_TOKEN_CHAR = 16,                /* TOKEN_CHAR  */
+  YYSYMBOL_TOKEN_ELSE = 17,                /* TOKEN_ELSE  */
+  YYSYMBOL_TOKEN_FALSE = 18,               /* TOKEN_FALSE  */
+  YYSYMBOL_TOKEN_FLOAT = 19,               /* TOKEN_FLOAT  */
+  YYSYMBOL_TOKEN_DOUBLE = 20,              /* TOKEN_DOUBLE  */
+  YYSYMBOL_TOKEN_FOR = 21,                 /* TOKEN_FOR  */
+  YYSYMBOL_TOKEN_FUNCTION = 22,            /* TOKEN_FUNCTION  */
+  YYSYMBOL_TOKEN_IF = 23,                  /* TOKEN_IF  */
+  YYSYMBOL_TOKEN_INTEGER = 24,             /* TOKEN_INTEGER  */
+  YYSYMBOL_TOKEN_PRINT = 25,               /* TOKEN_PRINT  */
+  YYSYMBOL_TOKEN_RETURN = 26,              /* TOKEN_RETURN  */
+  YYSYMBOL_TOKEN_STRING = 27,              /* TOKEN_STRING  */
+  YYSYMBOL_TOKEN_TRUE = 28,                /* TOKEN_TRUE  */
+  YYSYMBOL_TOKEN_VOID = 29,                /* TOKEN_VOID  */
+  YYSYMBOL_TOKEN_WHILE = 30,               /* TOKEN_WHILE  */
+  YYSYMBOL_TOKEN_LPAREN = 31,              /* TOKEN_LPAREN  */
+  YYSYMBOL_TOKEN_RPAREN = 32,              /* TOKEN_RPAREN  */
+  YYSYMBOL_TOKEN_LBRACE = 33,              /* TOKEN_LBRACE  */
+  YYSYMBOL_TOKEN_RBRACE = 34,              /* TOKEN_RBRACE  */
+  YYSYMBOL_TOKEN_LBRACKET = 35,            /* TOKEN_LBRACKET  */
+  YYSYMBOL_TOKEN_RBRACKET = 36,            /* TOKEN_RBRACKET  */
+  YYSYMBOL_TOKEN_INCREMENT = 37,           /* TOKEN_INCREMENT  */
+  YYSYMBOL_TOKEN_DECREMENT = 38,           /* TOKEN_DECREMENT  */
+  YYSYMBOL_TOKEN_ARRAY_LEN = 39,           /* TOKEN_ARRAY_LEN  */
+  YYSYMBOL_TOKEN_LOGICAL_NOT = 40,         /* TOKEN_LOGICAL_NOT  */
+  YYSYMBOL_TOKEN_EXPONENTIATION = 41,      /* TOKEN_EXPONENTIATION  */
+  YYSYMBOL_TOKEN_MULTIPLICATION = 42,      /* TOKEN_MULTIPLICATION  */
+  YYSYMBOL_TOKEN_DIVISION = 43,            /* TOKEN_DIVISION  */
+  YYSYMBOL_TOKEN_REMINDER = 44,            /* TOKEN_REMINDER  */
+  YYSYMBOL_TOKEN_ADDITION = 45,            /* TOKEN_ADDITION  */
+  YYSYMBOL_TOKEN_SUBTRACTION = 46,         /* TOKEN_SUBTRACTION  */
+  YYSYMBOL_TOKEN_LESS_THAN = 47,           /* TOKEN_LESS_THAN  */
+  YYSYMBOL_TOKEN_LESS_THAN_OR_EQUAL = 48,  /* TOKEN_LESS_THAN_OR_EQUAL  */
+  YYSYMBOL_TOKEN_GREATER_THAN = 49,        /* TOKEN_GREATER_THAN  */
+  YYSYMBOL_TOKEN_GREATER_THAN_OR_EQUAL = 50, /* TOKEN_GREATER_THAN_OR_EQUAL  */
+  YYSYMBOL_TOKEN_COMPARISON_EQUAL = 51,    /* TOKEN_COMPARISON_EQUAL  */
+  YYSYMBOL_TOKEN_COMPARISON_NOT_EQUAL = 52, /* TOKEN_COMPARISON_NOT_EQUAL  */
+  YYSYMBOL_TOKEN_LOGICAL_AND = 53,         /* TOKEN_LOGICAL_AND  */
+  YYSYMBOL_TOKEN_LOGICAL_OR = 54,          /* TOKEN_LOGICAL_OR  */
+  YYSYMBOL_TOKEN_ASSIGNMENT = 55,          /* TOKEN_ASSIGNMENT  */
+  YYSYMBOL_TOKEN_SEMICOLON = 56,           /* TOKEN_SEMICOLON  */
+  YYSYMBOL_TOKEN_COLON = 57,               /* TOKEN_COLON  */
+  YYSYMBOL_TOKEN_COMMA = 58,               /* TOKEN_COMMA  */
+  YYSYMBOL_YYACCEPT = 59,                  /* $accept  */
+  YYSYMBOL_program = 60,                   /* program  */
+  YYSYMBOL_decl_list = 61,                 /* decl_list  */
+  YYSYMBOL_decl = 62,                      /* decl  */
+  YYSYMBOL_var_decl = 63,                  /* var_decl  */
+  YYSYMBOL_array_init = 64,                /* array_init  */
+  YYSYMBOL_array_init_list = 65,           /* array_init_list  */
+  YYSYMBOL_array_init_element = 66,        /* array_init_element  */
+  YYSYMBOL_func_decl = 67,                 /* func_decl  */
+  YYSYMBOL_id = 68,                        /* id  */
+  YYSYMBOL_param_list = 69,                /* param_list  */
+  YYSYMBOL_non_empty_param_list = 70,      /* non_empty_param_list  */
+  YYSYMBOL_param_decl = 71,                /* param_decl  */
+  YYSYMBOL_type = 72,                      /* type  */
+  YYSYMBOL_atomic_type = 73,               /* atomic_type  */
+  YYSYMBOL_return_type = 74,               /* return_type  */
+  YYSYMBOL_array_type = 75,                /* array_type  */
+  YYSYMBOL_stmt_list = 76,                 /* stmt_list  */
+  YYSYMBOL_stmt = 77,                      /* stmt  */
+  YYSYMBOL_unmatched_stmt = 78,            /* unmatched_stmt  */
+  YYSYMBOL_matched_stmt = 79,              /* matched_stmt  */
+  YYSYMBOL_for_init = 80,                  /* for_init  */
+  YYSYMBOL_for_cond = 81,                  /* for_cond  */
+  YYSYMBOL_for_updt = 82,                  /* for_updt  */
+  YYSYMBOL_base_stmt = 83,                 /* base_stmt  */
+  YYSYMBOL_expr_stmt = 84,                 /* expr_stmt  */
+  YYSYMBOL_print_stmt = 85,                /* print_stmt  */
+  YYSYMBOL_return_stmt = 86,               /* return_stmt  */
+  YYSYMBOL_block = 87,                     /* block  */
+  YYSYMBOL_expr = 88,                      /* expr  */
+  YYSYMBOL_assign_expr = 89,               /* assign_expr  */
+  YYSYMBOL_or_expr = 90,                   /* or_expr  */
+  YYSYMBOL_and_expr = 91,                  /* and_expr  */
+  YYSYMBOL_eq_expr = 92,                   /* eq_expr  */
+  YYSYMBOL_comp_expr = 93,                 /* comp_expr  */
+  YYSYMBOL_add_expr = 94,                  /* add_expr  */
+  YYSYMBOL_mul_expr = 95,                  /* mul_expr  */
+  YYSYMBOL_exp_expr = 96,                  /* exp_expr  */
+  YYSYMBOL_unary_expr = 97,                /* unary_expr  */
+  YYSYMBOL_postfix_expr = 98,              /* postfix_expr  */
+  YYSYMBOL_literals_expr = 99,             /* literals_expr  */
+  YYSYMBOL_expr_list = 100,                /* expr_list  */
+  YYSYMBOL_non_empty_expr_list = 101,      /* non_empty_expr_list  */
+  YYSYMBOL_expr_list_init = 102            /* expr_list_init  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  8
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   331
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  59
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  44
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  114
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  188
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   313
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   134,   134,   138,   141,   144,   146,   151,   153,   155,
+     159,   163,   165,   169,   171,   176,   178,   184,   189,   192,
+     195,   197,   201,   207,   209,   211,   215,   217,   219,   221,
+     223,   225,   229,   231,   233,   237,   239,   241,   243,   248,
+     251,   254,   256,   260,   262,   264,   268,   270,   272,   276,
+     279,   282,   285,   288,   291,   294,   296,   298,   300,   302,
+     307,   311,   313,   317,   319,   323,   328,   332,   334,   338,
+     340,   344,   346,   350,   352,   354,   358,   360,   362,   364,
+     366,   370,   372,   374,   378,   380,   382,   384,   388,   390,
+     394,   396,   398,   400,   405,   407,   409,   411,   413,   417,
+     419,   421,   423,   425,   427,   429,   431,   433,   435,   437,
+     441,   444,   447,   449,   453
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "TOKEN_ERROR",
+  "TOKEN_IDENTIFIER", "TOKEN_STRING_LITERAL", "TOKEN_INTEGER_LITERAL",
+  "TOKEN_HEXIDECIMAL_LITERAL", "TOKEN_BINARY_LITERAL",
+  "TOKEN_DOUBLE_LITERAL", "TOKEN_DOUBLE_SCIENTIFIC_LITERAL",
+  "TOKEN_CHAR_LITERAL", "TOKEN_ARRAY", "TOKEN_AUTO", "TOKEN_BOOLEAN",
+  "TOKEN_CARRAY", "TOKEN_CHAR", "TOKEN_ELSE", "TOKEN_FALSE", "TOKEN_FLOAT",
+  "TOKEN_DOUBLE", "TOKEN_FOR", "TOKEN_FUNCTION", "TOKEN_IF",
+  "TOKEN_INTEGER", "TOKEN_PRINT", "TOKEN_RETURN", "TOKEN_STRING",
+  "TOKEN_TRUE", "TOKEN_VOID", "TOKEN_WHILE", "TOKEN_LPAREN",
+  "TOKEN_RPAREN", "TOKEN_LBRACE", "TOKEN_RBRACE", "TOKEN_LBRACKET",
+  "TOKEN_RBRACKET", "TOKEN_INCREMENT", "TOKEN_DECREMENT",
+  "TOKEN_ARRAY_LEN", "TOKEN_LOGICAL_NOT", "TOKEN_EXPONENTIATION",
+  "TOKEN_MULTIPLICATION", "TOKEN_DIVISION", "TOKEN_REMINDER",
+  "TOKEN_ADDITION", "TOKEN_SUBTRACTION", "TOKEN_LESS_THAN",
+  "TOKEN_LESS_THAN_OR_EQUAL", "TOKEN_GREATER_THAN",
+  "TOKEN_GREATER_THAN_OR_EQUAL", "TOKEN_COMPARISON_EQUAL",
+  "TOKEN_COMPARISON_NOT_EQUAL", "TOKEN_LOGICAL_AND", "TOKEN_LOGICAL_OR",
+  "TOKEN_ASSIGNMENT", "TOKEN_SEMICOLON", "TOKEN_COLON", "TOKEN_COMMA",
+  "$accept", "program", "decl_list", "decl", "var_decl", "array_init",
+  "array_init_list", "array_init_element", "func_decl", "id", "param_list",
+  "non_empty_param_list", "param_decl", "type", "atomic_type",
+  "return_type", "array_type", "stmt_list", "stmt", "unmatched_stmt",
+  "matched_stmt", "for_init", "for_cond", "for_updt", "base_stmt",
+  "expr_stmt", "print_stmt", "return_stmt", "block", "expr", "assign_expr",
+  "or_expr", "and_expr", "eq_expr", "comp_expr", "add_expr", "mul_expr",
+  "exp_expr", "unary_expr", "postfix_expr", "literals_expr", "expr_list",
+  "non_empty_expr_list", "expr_list_init", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-165)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-18)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+       1,  -165,    17,  -165,     1,  -165,  -165,   -38,  -165,  -165,
+      76,    -2,  -165,  -165,     5,  -165,  -165,  -165,    10,  -165,
+    -165,   -28,  -165,  -165,   176,   192,  -165,  -165,  -165,    20,
+     235,  -165,  -165,  -165,  -165,  -165,  -165,  -165,  -165,  -165,
+    -165,  -165,   251,   304,   251,   251,   251,    12,  -165,    28,
+      -7,    50,    31,    71,    15,  -165,    13,    18,  -165,   304,
+      25,     1,   294,    29,    37,    55,  -165,  -165,  -165,  -165,
+     304,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,  -165,  -165,
+    -165,   304,    42,    72,  -165,    70,  -165,    93,    73,  -165,
+    -165,  -165,  -165,  -165,    -7,  -165,    50,    31,    31,    71,
+      71,    71,    71,    15,    15,  -165,  -165,  -165,  -165,  -165,
+      97,  -165,    74,   100,  -165,   304,    63,     1,  -165,   294,
+    -165,   251,  -165,  -165,   112,  -165,  -165,  -165,  -165,   133,
+    -165,    89,   102,   116,     4,    66,  -165,    91,   118,   133,
+    -165,  -165,  -165,  -165,  -165,  -165,  -165,    94,   251,   251,
+    -165,   101,  -165,   104,   304,  -165,  -165,  -165,   106,  -165,
+     121,  -165,  -165,   251,   133,   107,  -165,  -165,   148,   251,
+     133,   135,  -165,  -165,  -165,   133,  -165,  -165
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       4,    17,     0,     2,     4,     5,     6,     0,     1,     3,
+       0,     0,    25,    29,     0,    30,    28,    27,     0,    26,
+      31,     0,    24,    23,     0,     0,    34,    32,    33,     0,
+       0,     7,   108,    99,   100,   101,   102,   103,   104,   105,
+     107,   106,     0,     0,     0,     0,     0,     0,    66,    67,
+      69,    71,    73,    76,    81,    84,    88,    93,    94,     0,
+       0,    19,     0,     0,     0,     0,    37,    92,    90,    91,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   111,     0,    97,    98,
+      38,     0,     0,     0,    18,    21,    14,     0,    12,    13,
+       9,     8,   109,    35,    70,    68,    72,    74,    75,    77,
+      78,    79,    80,    82,    83,    85,    86,    87,    89,   114,
+       0,   110,   113,     0,    36,     0,     0,     0,    10,     0,
+      96,     0,    95,    22,     0,    15,    20,    11,   112,    40,
+      16,   108,     0,     0,     0,     0,    55,     0,     0,    40,
+      41,    42,    48,    56,    57,    58,    59,     0,    50,     0,
+      62,     0,    63,     0,     0,    65,    39,    60,     0,    49,
+       0,    61,    64,    52,     0,     0,    51,    43,    42,    54,
+       0,     0,    53,    44,    46,     0,    45,    47
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -165,  -165,   164,  -165,    41,   139,    46,  -165,  -165,     3,
+    -165,    43,  -165,   -39,   153,  -165,  -165,    27,     0,  -164,
+    -138,  -165,  -165,  -165,  -165,  -165,  -165,  -165,    44,   -24,
+     105,  -165,   117,   119,    49,   -11,    45,    26,    69,  -165,
+     -60,  -165,  -106,  -165
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     2,     3,     4,   146,    96,    97,    98,     6,   147,
+      93,    94,    95,    21,    22,    29,    23,   148,   149,   150,
+     151,   168,   175,   181,   152,   153,   154,   155,   156,   157,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,   120,   121,   122
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      47,    60,    99,     7,    66,     1,    64,     7,    32,    33,
+      34,    35,    36,    37,    38,    39,   183,     8,    65,    10,
+      90,   186,    40,    26,    13,   138,    15,    30,    31,    16,
+      17,   103,    41,    24,    19,    42,   178,    20,   161,    27,
+      25,     5,   184,    44,    45,     5,    73,   187,    70,    86,
+      46,    61,   124,    87,    85,    88,    89,    82,    83,    84,
+     160,    91,   119,   123,    92,   109,   110,   111,   112,    99,
+      32,    33,    34,    35,    36,    37,    38,    39,    76,    77,
+      78,    79,    71,    72,    40,   100,   133,   102,    11,    12,
+      13,    14,    15,   101,    41,    16,    17,    42,    18,   125,
+      19,    74,    75,    20,   126,    44,    45,   119,   115,   116,
+     117,   118,    46,    67,    68,    69,    80,    81,   134,   135,
+     119,   163,   162,   107,   108,   113,   114,   128,   127,   130,
+      92,   129,   131,   158,   169,   170,   132,   141,    33,    34,
+      35,    36,    37,    38,    39,   139,   -17,   159,   164,   176,
+     167,    40,   165,   174,   142,   182,   143,   171,   144,   145,
+     172,    41,   173,   179,    42,   180,   139,   185,     9,    63,
+     136,    28,    44,    45,   177,   137,   166,   105,   140,    46,
+      32,    33,    34,    35,    36,    37,    38,    39,   104,     0,
+       0,     0,   106,     0,    40,     0,    32,    33,    34,    35,
+      36,    37,    38,    39,    41,     0,     0,    42,     0,     0,
+      40,     0,    43,     0,     0,    44,    45,     0,     0,     0,
+      41,     0,    46,    42,     0,     0,     0,     0,    59,     0,
+       0,    44,    45,     0,     0,     0,     0,     0,    46,    32,
+      33,    34,    35,    36,    37,    38,    39,     0,     0,     0,
+       0,     0,     0,    40,     0,    32,    33,    34,    35,    36,
+      37,    38,    39,    41,     0,     0,    42,     0,    62,    40,
+       0,     0,     0,     0,    44,    45,     0,     0,     0,    41,
+       0,    46,    42,     0,     0,     0,     0,     0,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,    32,    33,
+      34,    35,    36,    37,    38,    39,     0,     0,     0,     0,
+       0,     0,    40,     0,     0,     0,    11,    12,    13,    14,
+      15,     0,    41,    16,    17,    42,     0,    62,    19,     0,
+       0,    20
+};
+
+static const yytype_int16 yycheck[] =
+{
+      24,    25,    62,     0,    43,     4,    30,     4,     4,     5,
+       6,     7,     8,     9,    10,    11,   180,     0,    42,    57,
+      59,   185,    18,    13,    14,   131,    16,    55,    56,    19,
+      20,    70,    28,    35,    24,    31,   174,    27,   144,    29,
+      35,     0,   180,    39,    40,     4,    53,   185,    36,    31,
+      46,    31,    91,    35,    41,    37,    38,    42,    43,    44,
+      56,    36,    86,    87,    61,    76,    77,    78,    79,   129,
+       4,     5,     6,     7,     8,     9,    10,    11,    47,    48,
+      49,    50,    54,    55,    18,    56,   125,    32,    12,    13,
+      14,    15,    16,    56,    28,    19,    20,    31,    22,    57,
+      24,    51,    52,    27,    32,    39,    40,   131,    82,    83,
+      84,    85,    46,    44,    45,    46,    45,    46,    55,    56,
+     144,   145,    56,    74,    75,    80,    81,    34,    58,    32,
+     127,    58,    58,    31,   158,   159,    36,     4,     5,     6,
+       7,     8,     9,    10,    11,    33,    57,    31,    57,   173,
+      56,    18,    34,    32,    21,   179,    23,    56,    25,    26,
+      56,    28,    56,    56,    31,    17,    33,    32,     4,    30,
+     127,    18,    39,    40,   174,   129,   149,    72,   134,    46,
+       4,     5,     6,     7,     8,     9,    10,    11,    71,    -1,
+      -1,    -1,    73,    -1,    18,    -1,     4,     5,     6,     7,
+       8,     9,    10,    11,    28,    -1,    -1,    31,    -1,    -1,
+      18,    -1,    36,    -1,    -1,    39,    40,    -1,    -1,    -1,
+      28,    -1,    46,    31,    -1,    -1,    -1,    -1,    36,    -1,
+      -1,    39,    40,    -1,    -1,    -1,    -1,    -1,    46,     4,
+       5,     6,     7,     8,     9,    10,    11,    -1,    -1,    -1,
+      -1,    -1,    -1,    18,    -1,     4,     5,     6,     7,     8,
+       9,    10,    11,    28,    -1,    -1,    31,    -1,    33,    18,
+      -1,    -1,    -1,    -1,    39,    40,    -1,    -1,    -1,    28,
+      -1,    46,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      39,    40,    -1,    -1,    -1,    -1,    -1,    46,     4,     5,
+       6,     7,     8,     9,    10,    11,    -1,    -1,    -1,    -1,
+      -1,    -1,    18,    -1,    -1,    -1,    12,    13,    14,    15,
+      16,    -1,    28,    19,    20,    31,    -1,    33,    24,    -1,
+      -1,    27
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     4,    60,    61,    62,    63,    67,    68,     0,    61,
+      57,    12,    13,    14,    15,    16,    19,    20,    22,    24,
+      27,    72,    73,    75,    35,    35,    13,    29,    73,    74,
+      55,    56,     4,     5,     6,     7,     8,     9,    10,    11,
+      18,    28,    31,    36,    39,    40,    46,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,    36,
+      88,    31,    33,    64,    88,    88,    72,    97,    97,    97,
+      36,    54,    55,    53,    51,    52,    47,    48,    49,    50,
+      45,    46,    42,    43,    44,    41,    31,    35,    37,    38,
+      72,    36,    68,    69,    70,    71,    64,    65,    66,    99,
+      56,    56,    32,    72,    91,    89,    92,    93,    93,    94,
+      94,    94,    94,    95,    95,    96,    96,    96,    96,    88,
+     100,   101,   102,    88,    72,    57,    32,    58,    34,    58,
+      32,    58,    36,    72,    55,    56,    70,    65,   101,    33,
+      87,     4,    21,    23,    25,    26,    63,    68,    76,    77,
+      78,    79,    83,    84,    85,    86,    87,    88,    31,    31,
+      56,   101,    56,    88,    57,    34,    76,    56,    80,    88,
+      88,    56,    56,    56,    32,    81,    88,    77,    79,    56,
+      17,    82,    88,    78,    79,    32,    78,    79
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    59,    60,    61,    61,    62,    62,    63,    63,    63,
+      64,    65,    65,    66,    66,    67,    67,    68,    69,    69,
+      70,    70,    71,    72,    72,    72,    73,    73,    73,    73,
+      73,    73,    74,    74,    74,    75,    75,    75,    75,    76,
+      76,    77,    77,    78,    78,    78,    79,    79,    79,    80,
+      80,    81,    81,    82,    82,    83,    83,    83,    83,    83,
+      84,    85,    85,    86,    86,    87,    88,    89,    89,    90,
+      90,    91,    91,    92,    92,    92,    93,    93,    93,    93,
+      93,    94,    94,    94,    95,    95,    95,    95,    96,    96,
+      97,    97,    97,    97,    98,    98,    98,    98,    98,    99,
+      99,    99,    99,    99,    99,    99,    99,    99,    99,    99,
+     100,   100,   101,   101,   102
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     0,     1,     1,     4,     6,     6,
+       3,     3,     1,     1,     1,     8,     9,     1,     1,     0,
+       3,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     5,     5,     4,     4,     2,
+       0,     1,     1,     5,     7,     9,     7,     9,     1,     1,
+       0,     1,     0,     1,     0,     1,     1,     1,     1,     1,
+       2,     3,     2,     2,     3,     3,     1,     1,     3,     1,
+       3,     1,     3,     1,     3,     3,     1,     3,     3,     3,
+       3,     1,     3,     3,     1,     3,     3,     3,     1,     3,
+       2,     2,     2,     1,     1,     4,     4,     2,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       1,     0,     3,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (scanner, c, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, scanner, c); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, Compiler *c)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (scanner);
+  YY_USE (c);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, Compiler *c)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, c);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, yyscan_t scanner, Compiler *c)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, c);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, c); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, yyscan_t scanner, Compiler *c)
+{
+  YY_USE (yyvaluep);
+  YY_USE (scanner);
+  YY_USE (c);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (yyscan_t scanner, Compiler *c)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, scanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: decl_list  */
+#line 135 "src/parser/parser.bison"
+            { c->root = (yyvsp[0].decl); }
+#line 1636 "build/parser.c"
+    break;
+
+  case 3: /* decl_list: decl decl_list  */
+#line 139 "src/parser/parser.bison"
+              { (yyval.decl) = (yyvsp[-1].decl); (yyvsp[-1].decl)->next = (yyvsp[0].decl); }
+#line 1642 "build/parser.c"
+    break;
+
+  case 4: /* decl_list: %empty  */
+#line 141 "src/parser/parser.bison"
+              { (yyval.decl) = 0; }
+#line 1648 "build/parser.c"
+    break;
+
+  case 5: /* decl: var_decl  */
+#line 145 "src/parser/parser.bison"
+              { (yyval.decl) = (yyvsp[0].decl); }
+#line 1654 "build/parser.c"
+    break;
+
+  case 6: /* decl: func_decl  */
+#line 147 "src/parser/parser.bison"
+              { (yyval.decl) = (yyvsp[0].decl); }
+#line 1660 "build/parser.c"
+    break;
+
+  case 7: /* var_decl: id TOKEN_COLON type TOKEN_SEMICOLON  */
+#line 152 "src/parser/parser.bison"
+                { (yyval.decl) = decl_create((yyvsp[-3].expr)->name, (yyvsp[-1].type), 0, 0, 0); }
+#line 1666 "build/parser.c"
+    break;
+
+  case 8: /* var_decl: id TOKEN_COLON type TOKEN_ASSIGNMENT expr TOKEN_SEMICOLON  */
+#line 154 "src/parser/parser.bison"
+                { (yyval.decl) = decl_create((yyvsp[-5].expr)->name, (yyvsp[-3].type), (yyvsp[-1].expr), 0, 0); }
+#line 1672 "build/parser.c"
+    break;
+
+  case 9: /* var_decl: id TOKEN_COLON type TOKEN_ASSIGNMENT array_init TOKEN_SEMICOLON  */
+#line 156 "src/parser/parser.bison"
+                { (yyval.decl) = decl_create((yyvsp[-5].expr)->name, (yyvsp[-3].type), (yyvsp[-1].expr), 0, 0); }
+#line 1678 "build/parser.c"
+    break;
+
+  case 10: /* array_init: TOKEN_LBRACE array_init_list TOKEN_RBRACE  */
+#line 160 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_BRACES, 0, (yyvsp[-1].expr)); }
+#line 1684 "build/parser.c"
+    break;
+
+  case 11: /* array_init_list: array_init_element TOKEN_COMMA array_init_list  */
+#line 164 "src/parser/parser.bison"
+                        { (yyval.expr) = (yyvsp[-2].expr); (yyvsp[-2].expr)->right = (yyvsp[0].expr); }
+#line 1690 "build/parser.c"
+    break;
+
+  case 12: /* array_init_list: array_init_element  */
+#line 166 "src/parser/parser.bison"
+                        { (yyval.expr) = (yyvsp[0].expr); }
+#line 1696 "build/parser.c"
+    break;
+
+  case 13: /* array_init_element: literals_expr  */
+#line 170 "src/parser/parser.bison"
+                        { (yyval.expr) = expr_create(EXPR_ARGS, (yyvsp[0].expr), 0); }
+#line 1702 "build/parser.c"
+    break;
+
+  case 14: /* array_init_element: array_init  */
+#line 172 "src/parser/parser.bison"
+                        { (yyval.expr) = expr_create(EXPR_ARGS, (yyvsp[0].expr), 0); }
+#line 1708 "build/parser.c"
+    break;
+
+  case 15: /* func_decl: id TOKEN_COLON TOKEN_FUNCTION return_type TOKEN_LPAREN param_list TOKEN_RPAREN TOKEN_SEMICOLON  */
+#line 177 "src/parser/parser.bison"
+                { (yyval.decl) = decl_create((yyvsp[-7].expr)->name, type_create(TYPE_FUNCTION, (yyvsp[-4].type), (yyvsp[-2].param_list), 0), 0, 0, 0); }
+#line 1714 "build/parser.c"
+    break;
+
+  case 16: /* func_decl: id TOKEN_COLON TOKEN_FUNCTION return_type TOKEN_LPAREN param_list TOKEN_RPAREN TOKEN_ASSIGNMENT block  */
+#line 179 "src/parser/parser.bison"
+                { (yyval.decl) = decl_create((yyvsp[-8].expr)->name, type_create(TYPE_FUNCTION, (yyvsp[-5].type), (yyvsp[-3].param_list), 0), 0, (yyvsp[0].stmt), 0); }
+#line 1720 "build/parser.c"
+    break;
+
+  case 17: /* id: TOKEN_IDENTIFIER  */
+#line 185 "src/parser/parser.bison"
+            { (yyval.expr) = expr_create_name((yyvsp[0].name)); }
+#line 1726 "build/parser.c"
+    break;
+
+  case 18: /* param_list: non_empty_param_list  */
+#line 190 "src/parser/parser.bison"
+                { (yyval.param_list) = (yyvsp[0].param_list); }
+#line 1732 "build/parser.c"
+    break;
+
+  case 19: /* param_list: %empty  */
+#line 192 "src/parser/parser.bison"
+                { (yyval.param_list) = 0; }
+#line 1738 "build/parser.c"
+    break;
+
+  case 20: /* non_empty_param_list: param_decl TOKEN_COMMA non_empty_param_list  */
+#line 196 "src/parser/parser.bison"
+                            { (yyval.param_list) = (yyvsp[-2].param_list); (yyvsp[-2].param_list)->next = (yyvsp[0].param_list); }
+#line 1744 "build/parser.c"
+    break;
+
+  case 21: /* non_empty_param_list: param_decl  */
+#line 198 "src/parser/parser.bison"
+                            { (yyval.param_list) = (yyvsp[0].param_list); }
+#line 1750 "build/parser.c"
+    break;
+
+  case 22: /* param_decl: id TOKEN_COLON type  */
+#line 202 "src/parser/parser.bison"
+                { (yyval.param_list) = param_list_create((yyvsp[-2].expr)->name, (yyvsp[0].type), 0); }
+#line 1756 "build/parser.c"
+    break;
+
+  case 23: /* type: array_type  */
+#line 208 "src/parser/parser.bison"
+                { (yyval.type) = (yyvsp[0].type); }
+#line 1762 "build/parser.c"
+    break;
+
+  case 24: /* type: atomic_type  */
+#line 210 "src/parser/parser.bison"
+                { (yyval.type) = (yyvsp[0].type); }
+#line 1768 "build/parser.c"
+    break;
+
+  case 25: /* type: TOKEN_AUTO  */
+#line 212 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_AUTO, 0, 0, 0); }
+#line 1774 "build/parser.c"
+    break;
+
+  case 26: /* atomic_type: TOKEN_INTEGER  */
+#line 216 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_INTEGER, 0, 0, 0); }
+#line 1780 "build/parser.c"
+    break;
+
+  case 27: /* atomic_type: TOKEN_DOUBLE  */
+#line 218 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_DOUBLE, 0, 0, 0); }
+#line 1786 "build/parser.c"
+    break;
+
+  case 28: /* atomic_type: TOKEN_FLOAT  */
+#line 220 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_DOUBLE, 0, 0, 0); }
+#line 1792 "build/parser.c"
+    break;
+
+  case 29: /* atomic_type: TOKEN_BOOLEAN  */
+#line 222 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_BOOLEAN, 0, 0, 0); }
+#line 1798 "build/parser.c"
+    break;
+
+  case 30: /* atomic_type: TOKEN_CHAR  */
+#line 224 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_CHARACTER, 0, 0, 0); }
+#line 1804 "build/parser.c"
+    break;
+
+  case 31: /* atomic_type: TOKEN_STRING  */
+#line 226 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_STRING, 0, 0, 0); }
+#line 1810 "build/parser.c"
+    break;
+
+  case 32: /* return_type: TOKEN_VOID  */
+#line 230 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_VOID, 0, 0, 0); }
+#line 1816 "build/parser.c"
+    break;
+
+  case 33: /* return_type: atomic_type  */
+#line 232 "src/parser/parser.bison"
+                { (yyval.type) = (yyvsp[0].type); }
+#line 1822 "build/parser.c"
+    break;
+
+  case 34: /* return_type: TOKEN_AUTO  */
+#line 234 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_AUTO, 0, 0, 0); }
+#line 1828 "build/parser.c"
+    break;
+
+  case 35: /* array_type: TOKEN_ARRAY TOKEN_LBRACKET expr TOKEN_RBRACKET type  */
+#line 238 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_ARRAY, (yyvsp[0].type), 0, (yyvsp[-2].expr)); }
+#line 1834 "build/parser.c"
+    break;
+
+  case 36: /* array_type: TOKEN_CARRAY TOKEN_LBRACKET expr TOKEN_RBRACKET type  */
+#line 240 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_CARRAY, (yyvsp[0].type), 0, (yyvsp[-2].expr)); }
+#line 1840 "build/parser.c"
+    break;
+
+  case 37: /* array_type: TOKEN_ARRAY TOKEN_LBRACKET TOKEN_RBRACKET type  */
+#line 242 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_ARRAY, (yyvsp[0].type), 0, 0); }
+#line 1846 "build/parser.c"
+    break;
+
+  case 38: /* array_type: TOKEN_CARRAY TOKEN_LBRACKET TOKEN_RBRACKET type  */
+#line 244 "src/parser/parser.bison"
+                { (yyval.type) = type_create(TYPE_CARRAY, (yyvsp[0].type), 0, 0); }
+#line 1852 "build/parser.c"
+    break;
+
+  case 39: /* stmt_list: stmt stmt_list  */
+#line 249 "src/parser/parser.bison"
+                { (yyval.stmt) = (yyvsp[-1].stmt); (yyvsp[-1].stmt)->next = (yyvsp[0].stmt); }
+#line 1858 "build/parser.c"
+    break;
+
+  case 40: /* stmt_list: %empty  */
+#line 251 "src/parser/parser.bison"
+                { (yyval.stmt) = 0;}
+#line 1864 "build/parser.c"
+    break;
+
+  case 41: /* stmt: unmatched_stmt  */
+#line 255 "src/parser/parser.bison"
+                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 1870 "build/parser.c"
+    break;
+
+  case 42: /* stmt: matched_stmt  */
+#line 257 "src/parser/parser.bison"
+                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 1876 "build/parser.c"
+    break;
+
+  case 43: /* unmatched_stmt: TOKEN_IF TOKEN_LPAREN expr TOKEN_RPAREN stmt  */
+#line 261 "src/parser/parser.bison"
+                        {(yyval.stmt) = stmt_create(STMT_IF_ELSE, 0, 0, (yyvsp[-2].expr), 0, (yyvsp[0].stmt), 0, 0); }
+#line 1882 "build/parser.c"
+    break;
+
+  case 44: /* unmatched_stmt: TOKEN_IF TOKEN_LPAREN expr TOKEN_RPAREN matched_stmt TOKEN_ELSE unmatched_stmt  */
+#line 263 "src/parser/parser.bison"
+                        { (yyval.stmt) = stmt_create(STMT_IF_ELSE, 0, 0, (yyvsp[-4].expr), 0, (yyvsp[-2].stmt), (yyvsp[0].stmt), 0); }
+#line 1888 "build/parser.c"
+    break;
+
+  case 45: /* unmatched_stmt: TOKEN_FOR TOKEN_LPAREN for_init TOKEN_SEMICOLON for_cond TOKEN_SEMICOLON for_updt TOKEN_RPAREN unmatched_stmt  */
+#line 265 "src/parser/parser.bison"
+                        { (yyval.stmt) = stmt_create(STMT_FOR, 0, (yyvsp[-6].expr), (yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].stmt), 0, 0); }
+#line 1894 "build/parser.c"
+    break;
+
+  case 46: /* matched_stmt: TOKEN_IF TOKEN_LPAREN expr TOKEN_RPAREN matched_stmt TOKEN_ELSE matched_stmt  */
+#line 269 "src/parser/parser.bison"
+                        { (yyval.stmt) = stmt_create(STMT_IF_ELSE, 0, 0, (yyvsp[-4].expr), 0, (yyvsp[-2].stmt), (yyvsp[0].stmt), 0); }
+#line 1900 "build/parser.c"
+    break;
+
+  case 47: /* matched_stmt: TOKEN_FOR TOKEN_LPAREN for_init TOKEN_SEMICOLON for_cond TOKEN_SEMICOLON for_updt TOKEN_RPAREN matched_stmt  */
+#line 271 "src/parser/parser.bison"
+                        { (yyval.stmt) = stmt_create(STMT_FOR, 0, (yyvsp[-6].expr), (yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].stmt), 0, 0); }
+#line 1906 "build/parser.c"
+    break;
+
+  case 48: /* matched_stmt: base_stmt  */
+#line 273 "src/parser/parser.bison"
+                        { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 1912 "build/parser.c"
+    break;
+
+  case 49: /* for_init: expr  */
+#line 277 "src/parser/parser.bison"
+                { (yyval.expr) = (yyvsp[0].expr); }
+#line 1918 "build/parser.c"
+    break;
+
+  case 50: /* for_init: %empty  */
+#line 279 "src/parser/parser.bison"
+                { (yyval.expr) = 0; }
+#line 1924 "build/parser.c"
+    break;
+
+  case 51: /* for_cond: expr  */
+#line 283 "src/parser/parser.bison"
+                { (yyval.expr) = (yyvsp[0].expr); }
+#line 1930 "build/parser.c"
+    break;
+
+  case 52: /* for_cond: %empty  */
+#line 285 "src/parser/parser.bison"
+                { (yyval.expr) = 0; }
+#line 1936 "build/parser.c"
+    break;
+
+  case 53: /* for_updt: expr  */
+#line 289 "src/parser/parser.bison"
+                { (yyval.expr) = (yyvsp[0].expr); }
+#line 1942 "build/parser.c"
+    break;
+
+  case 54: /* for_updt: %empty  */
+#line 291 "src/parser/parser.bison"
+                { (yyval.expr) = 0; }
+#line 1948 "build/parser.c"
+    break;
+
+  case 55: /* base_stmt: var_decl  */
+#line 295 "src/parser/parser.bison"
+                {(yyval.stmt) = stmt_create(STMT_DECL, (yyvsp[0].decl), 0, 0, 0, 0, 0, 0); }
+#line 1954 "build/parser.c"
+    break;
+
+  case 56: /* base_stmt: expr_stmt  */
+#line 297 "src/parser/parser.bison"
+                {(yyval.stmt) = (yyvsp[0].stmt); }
+#line 1960 "build/parser.c"
+    break;
+
+  case 57: /* base_stmt: print_stmt  */
+#line 299 "src/parser/parser.bison"
+                {(yyval.stmt) = (yyvsp[0].stmt); }
+#line 1966 "build/parser.c"
+    break;
+
+  case 58: /* base_stmt: return_stmt  */
+#line 301 "src/parser/parser.bison"
+                {(yyval.stmt) = (yyvsp[0].stmt); }
+#line 1972 "build/parser.c"
+    break;
+
+  case 59: /* base_stmt: block  */
+#line 303 "src/parser/parser.bison"
+                {(yyval.stmt) = (yyvsp[0].stmt); }
+#line 1978 "build/parser.c"
+    break;
+
+  case 60: /* expr_stmt: expr TOKEN_SEMICOLON  */
+#line 308 "src/parser/parser.bison"
+                {(yyval.stmt) = stmt_create(STMT_EXPR, 0, 0, (yyvsp[-1].expr), 0, 0, 0, 0); }
+#line 1984 "build/parser.c"
+    break;
+
+  case 61: /* print_stmt: TOKEN_PRINT non_empty_expr_list TOKEN_SEMICOLON  */
+#line 312 "src/parser/parser.bison"
+                { (yyval.stmt) = stmt_create(STMT_PRINT, 0, 0, (yyvsp[-1].expr), 0, 0, 0, 0); }
+#line 1990 "build/parser.c"
+    break;
+
+  case 62: /* print_stmt: TOKEN_PRINT TOKEN_SEMICOLON  */
+#line 314 "src/parser/parser.bison"
+                { (yyval.stmt) = stmt_create(STMT_PRINT, 0, 0, 0, 0, 0, 0, 0); }
+#line 1996 "build/parser.c"
+    break;
+
+  case 63: /* return_stmt: TOKEN_RETURN TOKEN_SEMICOLON  */
+#line 318 "src/parser/parser.bison"
+                { (yyval.stmt) = stmt_create(STMT_RETURN, 0, 0, 0, 0, 0, 0, 0); }
+#line 2002 "build/parser.c"
+    break;
+
+  case 64: /* return_stmt: TOKEN_RETURN expr TOKEN_SEMICOLON  */
+#line 320 "src/parser/parser.bison"
+                { (yyval.stmt) = stmt_create(STMT_RETURN, 0, 0, (yyvsp[-1].expr), 0, 0, 0, 0); }
+#line 2008 "build/parser.c"
+    break;
+
+  case 65: /* block: TOKEN_LBRACE stmt_list TOKEN_RBRACE  */
+#line 324 "src/parser/parser.bison"
+                {(yyval.stmt) = stmt_create(STMT_BLOCK, 0, 0, 0, 0, (yyvsp[-1].stmt), 0, 0);}
+#line 2014 "build/parser.c"
+    break;
+
+  case 66: /* expr: assign_expr  */
+#line 329 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2020 "build/parser.c"
+    break;
+
+  case 67: /* assign_expr: or_expr  */
+#line 333 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2026 "build/parser.c"
+    break;
+
+  case 68: /* assign_expr: or_expr TOKEN_ASSIGNMENT assign_expr  */
+#line 335 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_ASSIGN, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2032 "build/parser.c"
+    break;
+
+  case 69: /* or_expr: and_expr  */
+#line 339 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2038 "build/parser.c"
+    break;
+
+  case 70: /* or_expr: or_expr TOKEN_LOGICAL_OR and_expr  */
+#line 341 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_OR, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2044 "build/parser.c"
+    break;
+
+  case 71: /* and_expr: eq_expr  */
+#line 345 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2050 "build/parser.c"
+    break;
+
+  case 72: /* and_expr: and_expr TOKEN_LOGICAL_AND eq_expr  */
+#line 347 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_AND, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2056 "build/parser.c"
+    break;
+
+  case 73: /* eq_expr: comp_expr  */
+#line 351 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2062 "build/parser.c"
+    break;
+
+  case 74: /* eq_expr: eq_expr TOKEN_COMPARISON_EQUAL comp_expr  */
+#line 353 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_EQ, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2068 "build/parser.c"
+    break;
+
+  case 75: /* eq_expr: eq_expr TOKEN_COMPARISON_NOT_EQUAL comp_expr  */
+#line 355 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_NOT_EQ, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2074 "build/parser.c"
+    break;
+
+  case 76: /* comp_expr: add_expr  */
+#line 359 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2080 "build/parser.c"
+    break;
+
+  case 77: /* comp_expr: comp_expr TOKEN_LESS_THAN add_expr  */
+#line 361 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_LT, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2086 "build/parser.c"
+    break;
+
+  case 78: /* comp_expr: comp_expr TOKEN_LESS_THAN_OR_EQUAL add_expr  */
+#line 363 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_LTE, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2092 "build/parser.c"
+    break;
+
+  case 79: /* comp_expr: comp_expr TOKEN_GREATER_THAN add_expr  */
+#line 365 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_GT, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2098 "build/parser.c"
+    break;
+
+  case 80: /* comp_expr: comp_expr TOKEN_GREATER_THAN_OR_EQUAL add_expr  */
+#line 367 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_GTE, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2104 "build/parser.c"
+    break;
+
+  case 81: /* add_expr: mul_expr  */
+#line 371 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2110 "build/parser.c"
+    break;
+
+  case 82: /* add_expr: add_expr TOKEN_ADDITION mul_expr  */
+#line 373 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_ADD, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2116 "build/parser.c"
+    break;
+
+  case 83: /* add_expr: add_expr TOKEN_SUBTRACTION mul_expr  */
+#line 375 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_SUB, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2122 "build/parser.c"
+    break;
+
+  case 84: /* mul_expr: exp_expr  */
+#line 379 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2128 "build/parser.c"
+    break;
+
+  case 85: /* mul_expr: mul_expr TOKEN_MULTIPLICATION exp_expr  */
+#line 381 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_MUL, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2134 "build/parser.c"
+    break;
+
+  case 86: /* mul_expr: mul_expr TOKEN_DIVISION exp_expr  */
+#line 383 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_DIV, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2140 "build/parser.c"
+    break;
+
+  case 87: /* mul_expr: mul_expr TOKEN_REMINDER exp_expr  */
+#line 385 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_REM, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2146 "build/parser.c"
+    break;
+
+  case 88: /* exp_expr: unary_expr  */
+#line 389 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2152 "build/parser.c"
+    break;
+
+  case 89: /* exp_expr: unary_expr TOKEN_EXPONENTIATION exp_expr  */
+#line 391 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_EXPO, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 2158 "build/parser.c"
+    break;
+
+  case 90: /* unary_expr: TOKEN_LOGICAL_NOT unary_expr  */
+#line 395 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_NOT, (yyvsp[0].expr), 0); }
+#line 2164 "build/parser.c"
+    break;
+
+  case 91: /* unary_expr: TOKEN_SUBTRACTION unary_expr  */
+#line 397 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_NEGATION, (yyvsp[0].expr), 0); }
+#line 2170 "build/parser.c"
+    break;
+
+  case 92: /* unary_expr: TOKEN_ARRAY_LEN unary_expr  */
+#line 399 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_ARR_LEN, (yyvsp[0].expr), 0); }
+#line 2176 "build/parser.c"
+    break;
+
+  case 93: /* unary_expr: postfix_expr  */
+#line 401 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2182 "build/parser.c"
+    break;
+
+  case 94: /* postfix_expr: literals_expr  */
+#line 406 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2188 "build/parser.c"
+    break;
+
+  case 95: /* postfix_expr: postfix_expr TOKEN_LBRACKET expr TOKEN_RBRACKET  */
+#line 408 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_INDEX, (yyvsp[-3].expr), (yyvsp[-1].expr));}
+#line 2194 "build/parser.c"
+    break;
+
+  case 96: /* postfix_expr: postfix_expr TOKEN_LPAREN expr_list TOKEN_RPAREN  */
+#line 410 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_FUNC, (yyvsp[-3].expr), (yyvsp[-1].expr));}
+#line 2200 "build/parser.c"
+    break;
+
+  case 97: /* postfix_expr: postfix_expr TOKEN_INCREMENT  */
+#line 412 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_INCREMENT, (yyvsp[-1].expr), 0); }
+#line 2206 "build/parser.c"
+    break;
+
+  case 98: /* postfix_expr: postfix_expr TOKEN_DECREMENT  */
+#line 414 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_DECREMENT, (yyvsp[-1].expr), 0); }
+#line 2212 "build/parser.c"
+    break;
+
+  case 99: /* literals_expr: TOKEN_STRING_LITERAL  */
+#line 418 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_string_literal((yyvsp[0].string)); }
+#line 2218 "build/parser.c"
+    break;
+
+  case 100: /* literals_expr: TOKEN_INTEGER_LITERAL  */
+#line 420 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_integer_literal((yyvsp[0].int_literal)); }
+#line 2224 "build/parser.c"
+    break;
+
+  case 101: /* literals_expr: TOKEN_HEXIDECIMAL_LITERAL  */
+#line 422 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_integer_literal((yyvsp[0].int_literal)); }
+#line 2230 "build/parser.c"
+    break;
+
+  case 102: /* literals_expr: TOKEN_BINARY_LITERAL  */
+#line 424 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_integer_literal((yyvsp[0].int_literal)); }
+#line 2236 "build/parser.c"
+    break;
+
+  case 103: /* literals_expr: TOKEN_DOUBLE_LITERAL  */
+#line 426 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_double_literal((yyvsp[0].double_lit)); }
+#line 2242 "build/parser.c"
+    break;
+
+  case 104: /* literals_expr: TOKEN_DOUBLE_SCIENTIFIC_LITERAL  */
+#line 428 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_double_literal((yyvsp[0].double_lit)); }
+#line 2248 "build/parser.c"
+    break;
+
+  case 105: /* literals_expr: TOKEN_CHAR_LITERAL  */
+#line 430 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_char_literal((yyvsp[0].string)); }
+#line 2254 "build/parser.c"
+    break;
+
+  case 106: /* literals_expr: TOKEN_TRUE  */
+#line 432 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_boolean_literal(1); }
+#line 2260 "build/parser.c"
+    break;
+
+  case 107: /* literals_expr: TOKEN_FALSE  */
+#line 434 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_boolean_literal(0); }
+#line 2266 "build/parser.c"
+    break;
+
+  case 108: /* literals_expr: TOKEN_IDENTIFIER  */
+#line 436 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create_name((yyvsp[0].name)); }
+#line 2272 "build/parser.c"
+    break;
+
+  case 109: /* literals_expr: TOKEN_LPAREN expr TOKEN_RPAREN  */
+#line 438 "src/parser/parser.bison"
+                    { (yyval.expr) = expr_create(EXPR_GROUPS, (yyvsp[-1].expr), 0); }
+#line 2278 "build/parser.c"
+    break;
+
+  case 110: /* expr_list: non_empty_expr_list  */
+#line 442 "src/parser/parser.bison"
+                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 2284 "build/parser.c"
+    break;
+
+  case 111: /* expr_list: %empty  */
+#line 444 "src/parser/parser.bison"
+                    { (yyval.expr) = 0; }
+#line 2290 "build/parser.c"
+    break;
+
+  case 112: /* non_empty_expr_list: expr_list_init TOKEN_COMMA non_empty_expr_list  */
+#line 448 "src/parser/parser.bison"
+                            { (yyval.expr) = (yyvsp[-2].expr); (yyvsp[-2].expr)->right = (yyvsp[0].expr); }
+#line 2296 "build/parser.c"
+    break;
+
+  case 113: /* non_empty_expr_list: expr_list_init  */
+#line 450 "src/parser/parser.bison"
+                            { (yyval.expr) = (yyvsp[0].expr); }
+#line 2302 "build/parser.c"
+    break;
+
+  case 114: /* expr_list_init: expr  */
+#line 454 "src/parser/parser.bison"
+                            { (yyval.expr) = expr_create(EXPR_ARGS, (yyvsp[0].expr), 0); }
+#line 2308 "build/parser.c"
+    break;
+
+
+#line 2312 "build/parser.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (scanner, c, yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, scanner, c);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, c);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (scanner, c, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, scanner, c);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, c);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 457 "src/parser/parser.bison"
+
+/* C postamble code */
+
+int yyerror(yyscan_t scanner, Compiler *c, const char *s ) {
+    fprintf(c->out, "parse error at %d:  %s\n", yyget_lineno(scanner), s);
+    return 1;
+}
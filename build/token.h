@@ -0,0 +1,165 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_BUILD_TOKEN_H_INCLUDED
+# define YY_YY_BUILD_TOKEN_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 20 "src/parser/parser.bison"
+
+    #include "bminor_context.h"
+    #include "decl.h"
+    #include "expr.h"
+    #include "param_list.h"
+    #include "stmt.h"
+    #include "symbol.h"
+    #include "type.h"
+
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void *yyscan_t;
+    #endif
+
+#line 64 "build/token.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TOKEN_ERROR = 258,             /* TOKEN_ERROR  */
+    TOKEN_IDENTIFIER = 259,        /* TOKEN_IDENTIFIER  */
+    TOKEN_STRING_LITERAL = 260,    /* TOKEN_STRING_LITERAL  */
+    TOKEN_INTEGER_LITERAL = 261,   /* TOKEN_INTEGER_LITERAL  */
+    TOKEN_HEXIDECIMAL_LITERAL = 262, /* TOKEN_HEXIDECIMAL_LITERAL  */
+    TOKEN_BINARY_LITERAL = 263,    /* TOKEN_BINARY_LITERAL  */
+    TOKEN_DOUBLE_LITERAL = 264,    /* TOKEN_DOUBLE_LITERAL  */
+    TOKEN_DOUBLE_SCIENTIFIC_LITERAL = 265, /* TOKEN_DOUBLE_SCIENTIFIC_LITERAL  */
+    TOKEN_CHAR_LITERAL = 266,      /* TOKEN_CHAR_LITERAL  */
+    TOKEN_ARRAY = 267,             /* TOKEN_ARRAY  */
+    TOKEN_AUTO = 268,              /* TOKEN_AUTO  */
+    TOKEN_BOOLEAN = 269,           /* TOKEN_BOOLEAN  */
+    TOKEN_CARRAY = 270,            /* TOKEN_CARRAY  */
+    TOKEN_CHAR = 271,              /* TOKEN_CHAR  */
+    TOKEN_ELSE = 272,              /* TOKEN_ELSE  */
+    TOKEN_FALSE = 273,             /* TOKEN_FALSE  */
+    TOKEN_FLOAT = 274,             /* TOKEN_FLOAT  */
+    TOKEN_DOUBLE = 275,            /* TOKEN_DOUBLE  */
+    TOKEN_FOR = 276,               /* TOKEN_FOR  */
+    TOKEN_FUNCTION = 277,          /* TOKEN_FUNCTION  */
+    TOKEN_IF = 278,                /* TOKEN_IF  */
+    TOKEN_INTEGER = 279,           /* TOKEN_INTEGER  */
+    TOKEN_PRINT = 280,             /* TOKEN_PRINT  */
+    TOKEN_RETURN = 281,            /* TOKEN_RETURN  */
+    TOKEN_STRING = 282,            /* TOKEN_STRING  */
+    TOKEN_TRUE = 283,              /* TOKEN_TRUE  */
+    TOKEN_VOID = 284,              /* TOKEN_VOID  */
+    TOKEN_WHILE = 285,             /* TOKEN_WHILE  */
+    TOKEN_LPAREN = 286,            /* TOKEN_LPAREN  */
+    TOKEN_RPAREN = 287,            /* TOKEN_RPAREN  */
+    TOKEN_LBRACE = 288,            /* TOKEN_LBRACE  */
+    TOKEN_RBRACE = 289,            /* TOKEN_RBRACE  */
+    TOKEN_LBRACKET = 290,          /* TOKEN_LBRACKET  */
+    TOKEN_RBRACKET = 291,          /* TOKEN_RBRACKET  */
+    TOKEN_INCREMENT = 292,         /* TOKEN_INCREMENT  */
+    TOKEN_DECREMENT = 293,         /* TOKEN_DECREMENT  */
+    TOKEN_ARRAY_LEN = 294,         /* TOKEN_ARRAY_LEN  */
+    TOKEN_LOGICAL_NOT = 295,       /* TOKEN_LOGICAL_NOT  */
+    TOKEN_EXPONENTIATION = 296,    /* TOKEN_EXPONENTIATION  */
+    TOKEN_MULTIPLICATION = 297,    /* TOKEN_MULTIPLICATION  */
+    TOKEN_DIVISION = 298,          /* TOKEN_DIVISION  */
+    TOKEN_REMINDER = 299,          /* TOKEN_REMINDER  */
+    TOKEN_ADDITION = 300,          /* TOKEN_ADDITION  */
+    TOKEN_SUBTRACTION = 301,       /* TOKEN_SUBTRACTION  */
+    TOKEN_LESS_THAN = 302,         /* TOKEN_LESS_THAN  */
+    TOKEN_LESS_THAN_OR_EQUAL = 303, /* TOKEN_LESS_THAN_OR_EQUAL  */
+    TOKEN_GREATER_THAN = 304,      /* TOKEN_GREATER_THAN  */
+    TOKEN_GREATER_THAN_OR_EQUAL = 305, /* TOKEN_GREATER_THAN_OR_EQUAL  */
+    TOKEN_COMPARISON_EQUAL = 306,  /* TOKEN_COMPARISON_EQUAL  */
+    TOKEN_COMPARISON_NOT_EQUAL = 307, /* TOKEN_COMPARISON_NOT_EQUAL  */
+    TOKEN_LOGICAL_AND = 308,       /* TOKEN_LOGICAL_AND  */
+    TOKEN_LOGICAL_OR = 309,        /* TOKEN_LOGICAL_OR  */
+    TOKEN_ASSIGNMENT = 310,        /* TOKEN_ASSIGNMENT  */
+    TOKEN_SEMICOLON = 311,         /* TOKEN_SEMICOLON  */
+    TOKEN_COLON = 312,             /* TOKEN_COLON  */
+    TOKEN_COMMA = 313              /* TOKEN_COMMA  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 110 "src/parser/parser.bison"
+
+    Decl *decl;
+    Stmt *stmt;
+    Type *type;
+    Param_list *param_list;
+    Expr *expr;
+    Symbol *symbol;
+    const char *name;
+    char *string; 
+    long int_literal;
+    double double_lit; 
+
+#line 152 "build/token.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int yyparse (yyscan_t scanner, Compiler *c);
+
+
+#endif /* !YY_YY_BUILD_TOKEN_H_INCLUDED  */
@@ -0,0 +1,489 @@
+/* ast_bin.c: binary serialized AST (--emit-ast-bin, --load-ast-bin) */
+
+#include "ast_bin.h"
+#include "bminor_context.h"
+#include "decl.h"
+#include "expr.h"
+#include "param_list.h"
+#include "stmt.h"
+#include "type.h"
+#include "intern.h"
+#include "hash_table.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+/* Macros */
+
+#define AST_BIN_NODE(table, index)  ((index) ? &(table)[(index) - 1] : NULL)   // 1-based index -> node
+
+/* Structures */
+
+typedef struct Ast_bin_table Ast_bin_table;
+
+struct Ast_bin_table {
+    void *items;                // records, in index order
+    uint32_t count;
+    uint32_t capacity;
+    size_t size;                // bytes per record
+};
+
+typedef struct Ast_bin_writer Ast_bin_writer;
+
+struct Ast_bin_writer {
+    Ast_bin_table decls;
+    Ast_bin_table stmts;
+    Ast_bin_table exprs;
+    Ast_bin_table types;
+    Ast_bin_table params;
+    Ast_bin_table offsets;          // uint32_t offset of each string in text
+    struct hash_table *strings;     // string -> index
+    char *text;                     // string bytes
+    size_t text_size;
+    size_t text_capacity;
+};
+
+typedef struct Ast_bin_strings Ast_bin_strings;
+
+struct Ast_bin_strings {
+    const char *text;               // string bytes, copied into the arena
+    const uint32_t *offsets;        // offset of each string in text
+    const char **names;             // index -> interned string, filled in on first use
+};
+
+/* Forward declaration of static prototypes */
+
+static uint32_t ast_bin_reserve(Ast_bin_table *t);
+static uint32_t ast_bin_string(Ast_bin_writer *w, const char *s);
+static uint32_t ast_bin_decl(Ast_bin_writer *w, Decl *d);
+static uint32_t ast_bin_stmt(Ast_bin_writer *w, Stmt *s);
+static uint32_t ast_bin_expr(Ast_bin_writer *w, Expr *e);
+static uint32_t ast_bin_type(Ast_bin_writer *w, Type *t);
+static uint32_t ast_bin_param(Ast_bin_writer *w, Param_list *p);
+static size_t   ast_bin_align(size_t offset);
+static bool     ast_bin_section(FILE *f, const void *items, size_t size);
+static bool     ast_bin_link(uint8_t *parents, uint32_t index, uint32_t count);
+static const char *ast_bin_text(Ast_bin_strings *t, uint32_t index);
+static const char *ast_bin_name(Ast_bin_strings *t, uint32_t index);
+
+/* Helper Functions */
+
+/**
+ * Appends a zeroed record to a table
+ * @param   t       table to grow
+ * @return  1-based index of the new record
+ */
+static uint32_t ast_bin_reserve(Ast_bin_table *t){
+    if (t->count == t->capacity){
+        t->capacity = t->capacity ? t->capacity * 2 : 64;
+        t->items = realloc(t->items, t->size * t->capacity);
+        MALLOC_CHECK(t->items);
+    }
+    memset((char *)t->items + t->size * t->count, 0, t->size);
+    return ++t->count;
+}
+
+/**
+ * Adds a string to the string table once
+ * @param   w       writer
+ * @param   s       string (NULL allowed)
+ * @return  1-based index of the string, 0 for NULL
+ */
+static uint32_t ast_bin_string(Ast_bin_writer *w, const char *s){
+    if (!s) return 0;
+    uint32_t index = (uintptr_t)hash_table_lookup(w->strings, s);
+    if (index) return index;
+
+    size_t length = strlen(s) + 1;
+    while (w->text_size + length > w->text_capacity){
+        w->text_capacity = w->text_capacity ? w->text_capacity * 2 : BUFSIZ;
+        w->text = realloc(w->text, w->text_capacity);
+        MALLOC_CHECK(w->text);
+    }
+    index = ast_bin_reserve(&w->offsets);
+    ((uint32_t *)w->offsets.items)[index - 1] = w->text_size;
+    memcpy(w->text + w->text_size, s, length);
+    w->text_size += length;
+    hash_table_insert(w->strings, s, (void *)(uintptr_t)index);
+    return index;
+}
+
+/**
+ * Serializes a decl list. Children are written before the record is filled in,
+ * since growing a table moves its records.
+ * @param   w       writer
+ * @param   d       decl to write (NULL allowed)
+ * @return  index of the decl, 0 for NULL
+ */
+static uint32_t ast_bin_decl(Ast_bin_writer *w, Decl *d){
+    if (!d) return 0;
+    uint32_t index = ast_bin_reserve(&w->decls);
+    Ast_bin_decl record = {
+        .name = ast_bin_string(w, d->name),
+        .type = ast_bin_type(w, d->type),
+        .value = ast_bin_expr(w, d->value),
+        .code = ast_bin_stmt(w, d->code),
+        .next = ast_bin_decl(w, d->next),
+    };
+    ((Ast_bin_decl *)w->decls.items)[index - 1] = record;
+    return index;
+}
+
+/**
+ * Serializes a statement list
+ * @param   w       writer
+ * @param   s       statement to write (NULL allowed)
+ * @return  index of the statement, 0 for NULL
+ */
+static uint32_t ast_bin_stmt(Ast_bin_writer *w, Stmt *s){
+    if (!s) return 0;
+    uint32_t index = ast_bin_reserve(&w->stmts);
+    Ast_bin_stmt record = {
+        .kind = s->kind,
+        .decl = ast_bin_decl(w, s->decl),
+        .init_expr = ast_bin_expr(w, s->init_expr),
+        .expr = ast_bin_expr(w, s->expr),
+        .next_expr = ast_bin_expr(w, s->next_expr),
+        .body = ast_bin_stmt(w, s->body),
+        .else_body = ast_bin_stmt(w, s->else_body),
+        .next = ast_bin_stmt(w, s->next),
+    };
+    ((Ast_bin_stmt *)w->stmts.items)[index - 1] = record;
+    return index;
+}
+
+/**
+ * Serializes an expression
+ * @param   w       writer
+ * @param   e       expression to write (NULL allowed)
+ * @return  index of the expression, 0 for NULL
+ */
+static uint32_t ast_bin_expr(Ast_bin_writer *w, Expr *e){
+    if (!e) return 0;
+    uint32_t index = ast_bin_reserve(&w->exprs);
+    Ast_bin_expr record = { .kind = e->kind, .literal_value = e->literal_value };
+    switch (e->kind){
+        case EXPR_IDENT:
+            record.string = ast_bin_string(w, e->name);
+            break;
+        case EXPR_STR_LIT:
+        case EXPR_CHAR_LIT:
+            record.string = ast_bin_string(w, e->string_literal);
+            break;
+        case EXPR_DOUBLE_LIT:
+        case EXPR_DOUBLE_SCIENTIFIC_LIT:
+            record.double_value = e->double_literal_value;
+            break;
+        default:
+            break;
+    }
+    record.left = ast_bin_expr(w, e->left);
+    record.right = ast_bin_expr(w, e->right);
+    ((Ast_bin_expr *)w->exprs.items)[index - 1] = record;
+    return index;
+}
+
+/**
+ * Serializes a type
+ * @param   w       writer
+ * @param   t       type to write (NULL allowed)
+ * @return  index of the type, 0 for NULL
+ */
+static uint32_t ast_bin_type(Ast_bin_writer *w, Type *t){
+    if (!t) return 0;
+    uint32_t index = ast_bin_reserve(&w->types);
+    Ast_bin_type record = {
+        .kind = t->kind,
+        .params = ast_bin_param(w, t->params),
+        .subtype = ast_bin_type(w, t->subtype),
+        .arr_len = ast_bin_expr(w, t->arr_len),
+    };
+    ((Ast_bin_type *)w->types.items)[index - 1] = record;
+    return index;
+}
+
+/**
+ * Serializes a parameter list
+ * @param   w       writer
+ * @param   p       parameter to write (NULL allowed)
+ * @return  index of the parameter, 0 for NULL
+ */
+static uint32_t ast_bin_param(Ast_bin_writer *w, Param_list *p){
+    if (!p) return 0;
+    uint32_t index = ast_bin_reserve(&w->params);
+    Ast_bin_param record = {
+        .name = ast_bin_string(w, p->name),
+        .type = ast_bin_type(w, p->type),
+        .next = ast_bin_param(w, p->next),
+    };
+    ((Ast_bin_param *)w->params.items)[index - 1] = record;
+    return index;
+}
+
+/**
+ * Rounds an offset up to the section alignment
+ * @param   offset  offset in the file
+ * @return  aligned offset
+ */
+static size_t ast_bin_align(size_t offset){
+    return (offset + AST_BIN_ALIGN - 1) & ~(size_t)(AST_BIN_ALIGN - 1);
+}
+
+/**
+ * Writes a section followed by padding up to the section alignment
+ * @param   f       file being written
+ * @param   items   section bytes
+ * @param   size    number of bytes
+ * @return  true if written, otherwise false
+ */
+static bool ast_bin_section(FILE *f, const void *items, size_t size){
+    static const char padding[AST_BIN_ALIGN];
+    size_t pad = ast_bin_align(size) - size;
+    return (size == 0 || fwrite(items, 1, size, f) == size) && (pad == 0 || fwrite(padding, 1, pad, f) == pad);
+}
+
+/**
+ * Records a link to a node, rejecting out-of-range indices and nodes with two
+ * parents. With one parent per node and none for the root, what is reachable from
+ * the root is a tree.
+ * @param   parents     one byte per node of the table, set once linked
+ * @param   index       1-based index (0 -> NULL)
+ * @param   count       records in the table
+ * @return  true if the link is valid, otherwise false
+ */
+static bool ast_bin_link(uint8_t *parents, uint32_t index, uint32_t count){
+    if (index == 0) return true;
+    if (index > count || parents[index - 1]) return false;
+    parents[index - 1] = 1;
+    return true;
+}
+
+/**
+ * Looks up a string literal of a loaded binary AST
+ * @param   t       loaded string table
+ * @param   index   1-based string index (0 -> NULL)
+ * @return  string in the arena, NULL for 0
+ */
+static const char *ast_bin_text(Ast_bin_strings *t, uint32_t index){
+    return index ? t->text + t->offsets[index - 1] : NULL;
+}
+
+/**
+ * Looks up a name of a loaded binary AST, interning each string once
+ * @param   t       loaded string table
+ * @param   index   1-based string index (0 -> NULL)
+ * @return  interned string, NULL for 0
+ */
+static const char *ast_bin_name(Ast_bin_strings *t, uint32_t index){
+    if (!index) return NULL;
+    if (!t->names[index]) t->names[index] = intern(&b_ctx->names, ast_bin_text(t, index));
+    return t->names[index];
+}
+
+/* Functions */
+
+/**
+ * Writes a parsed program as a binary AST
+ * @param   root        global decl list
+ * @param   file_name   file to write
+ * @return  true if written, otherwise false (reported to b_ctx->err)
+ */
+bool ast_bin_write(Decl *root, const char *file_name){
+    Ast_bin_writer w = {
+        .decls = { .size = sizeof(Ast_bin_decl) },
+        .stmts = { .size = sizeof(Ast_bin_stmt) },
+        .exprs = { .size = sizeof(Ast_bin_expr) },
+        .types = { .size = sizeof(Ast_bin_type) },
+        .params = { .size = sizeof(Ast_bin_param) },
+        .offsets = { .size = sizeof(uint32_t) },
+        .strings = hash_table_create(0, 0),
+    };
+    MALLOC_CHECK(w.strings);
+
+    Ast_bin_header header = { .magic = AST_BIN_MAGIC, .version = AST_BIN_VERSION };
+    header.root = ast_bin_decl(&w, root);
+    header.decls = w.decls.count;
+    header.stmts = w.stmts.count;
+    header.exprs = w.exprs.count;
+    header.types = w.types.count;
+    header.params = w.params.count;
+    header.strings = w.offsets.count;
+    header.string_bytes = w.text_size;
+
+    FILE *f = fopen(file_name, "wb");
+    bool written = f && ast_bin_section(f, &header, sizeof(header));
+    Ast_bin_table *tables[] = { &w.decls, &w.stmts, &w.exprs, &w.types, &w.params, &w.offsets };
+    for (size_t i = 0; written && i < sizeof(tables) / sizeof(tables[0]); i++){
+        written = ast_bin_section(f, tables[i]->items, tables[i]->size * tables[i]->count);
+        free(tables[i]->items);
+    }
+    written = written && ast_bin_section(f, w.text, w.text_size);
+    if (f && fclose(f) != 0) written = false;
+    if (!written) fprintf(b_ctx->err, "%s %s\n", strerror(errno), file_name);
+
+    free(w.text);
+    hash_table_delete(w.strings);
+    return written;
+}
+
+/**
+ * Rebuilds a program from a binary AST, e.g. one mapped with mmap. Records are
+ * read in place and linked in one pass: nodes are allocated a table at a time in
+ * b_ctx->arena, string text is copied once, and names are interned. Files are
+ * checked for structure (sizes, indices, kinds, one parent per node), not grammar;
+ * they are expected to come from --emit-ast-bin.
+ * @param   data    file contents, aligned to AST_BIN_ALIGN
+ * @param   size    bytes of data
+ * @param   root    set to the global decl list
+ * @return  true if loaded, otherwise false (reported to b_ctx->err)
+ */
+bool ast_bin_load(const char *data, size_t size, Decl **root){
+    const Ast_bin_header *h = (const Ast_bin_header *)data;
+    if ((uintptr_t)data % AST_BIN_ALIGN || size < sizeof(*h) || memcmp(h->magic, AST_BIN_MAGIC, sizeof(h->magic)) != 0){
+        fprintf(b_ctx->err, "Error: not a binary AST\n");
+        return false;
+    }
+    if (h->version != AST_BIN_VERSION){
+        fprintf(b_ctx->err, "Error: binary AST version %u, expected %u\n", h->version, AST_BIN_VERSION);
+        return false;
+    }
+
+    // section offsets follow from the counts, and must add up to the file size
+    size_t offset = ast_bin_align(sizeof(*h));
+    size_t decls = offset;
+    size_t stmts = offset = ast_bin_align(offset + (size_t)h->decls * sizeof(Ast_bin_decl));
+    size_t exprs = offset = ast_bin_align(offset + (size_t)h->stmts * sizeof(Ast_bin_stmt));
+    size_t types = offset = ast_bin_align(offset + (size_t)h->exprs * sizeof(Ast_bin_expr));
+    size_t params = offset = ast_bin_align(offset + (size_t)h->types * sizeof(Ast_bin_type));
+    size_t offsets = offset = ast_bin_align(offset + (size_t)h->params * sizeof(Ast_bin_param));
+    size_t text = offset = ast_bin_align(offset + (size_t)h->strings * sizeof(uint32_t));
+    const uint32_t *string_offsets = (const uint32_t *)(data + offsets);
+    bool valid = h->string_bytes <= size && ast_bin_align(text + h->string_bytes) == size &&
+                 (h->strings == 0 || (h->string_bytes > 0 && data[text + h->string_bytes - 1] == '\0'));
+    for (uint32_t i = 0; valid && i < h->strings; i++) valid = string_offsets[i] < h->string_bytes;
+    if (!valid){
+        fprintf(b_ctx->err, "Error: binary AST is truncated or corrupt\n");
+        return false;
+    }
+
+    const Ast_bin_decl *decl_records = (const Ast_bin_decl *)(data + decls);
+    const Ast_bin_stmt *stmt_records = (const Ast_bin_stmt *)(data + stmts);
+    const Ast_bin_expr *expr_records = (const Ast_bin_expr *)(data + exprs);
+    const Ast_bin_type *type_records = (const Ast_bin_type *)(data + types);
+    const Ast_bin_param *param_records = (const Ast_bin_param *)(data + params);
+
+    // every link is checked before any node is built
+    size_t nodes = (size_t)h->decls + h->stmts + h->exprs + h->types + h->params;
+    uint8_t *parents = safe_calloc(sizeof(uint8_t), nodes ? nodes : 1);
+    uint8_t *decl_parents = parents, *stmt_parents = decl_parents + h->decls, *expr_parents = stmt_parents + h->stmts;
+    uint8_t *type_parents = expr_parents + h->exprs, *param_parents = type_parents + h->types;
+    valid = ast_bin_link(decl_parents, h->root, h->decls);
+    for (uint32_t i = 0; valid && i < h->decls; i++){
+        const Ast_bin_decl *r = &decl_records[i];
+        valid = r->name <= h->strings && ast_bin_link(type_parents, r->type, h->types) &&
+                ast_bin_link(expr_parents, r->value, h->exprs) && ast_bin_link(stmt_parents, r->code, h->stmts) &&
+                ast_bin_link(decl_parents, r->next, h->decls);
+    }
+    for (uint32_t i = 0; valid && i < h->stmts; i++){
+        const Ast_bin_stmt *r = &stmt_records[i];
+        valid = r->kind <= STMT_BLOCK && ast_bin_link(decl_parents, r->decl, h->decls) &&
+                ast_bin_link(expr_parents, r->init_expr, h->exprs) && ast_bin_link(expr_parents, r->expr, h->exprs) &&
+                ast_bin_link(expr_parents, r->next_expr, h->exprs) && ast_bin_link(stmt_parents, r->body, h->stmts) &&
+                ast_bin_link(stmt_parents, r->else_body, h->stmts) && ast_bin_link(stmt_parents, r->next, h->stmts);
+    }
+    for (uint32_t i = 0; valid && i < h->exprs; i++){
+        const Ast_bin_expr *r = &expr_records[i];
+        bool named = r->kind == EXPR_IDENT || r->kind == EXPR_STR_LIT || r->kind == EXPR_CHAR_LIT;
+        valid = r->kind < EXPR_COUNT && (named ? r->string >= 1 && r->string <= h->strings : r->string == 0) &&
+                ast_bin_link(expr_parents, r->left, h->exprs) && ast_bin_link(expr_parents, r->right, h->exprs);
+    }
+    for (uint32_t i = 0; valid && i < h->types; i++){
+        const Ast_bin_type *r = &type_records[i];
+        valid = r->kind <= TYPE_FUNCTION && ast_bin_link(param_parents, r->params, h->params) &&
+                ast_bin_link(type_parents, r->subtype, h->types) && ast_bin_link(expr_parents, r->arr_len, h->exprs);
+    }
+    for (uint32_t i = 0; valid && i < h->params; i++){
+        const Ast_bin_param *r = &param_records[i];
+        valid = r->name <= h->strings && ast_bin_link(type_parents, r->type, h->types) &&
+                ast_bin_link(param_parents, r->next, h->params);
+    }
+    free(parents);
+    if (!valid){
+        fprintf(b_ctx->err, "Error: binary AST is corrupt\n");
+        return false;
+    }
+
+    // one allocation per table; index i lives at table[i - 1]
+    Arena *arena = b_ctx->arena;
+    Decl *decl_nodes = arena_calloc(arena, sizeof(Decl) * h->decls);
+    Stmt *stmt_nodes = arena_calloc(arena, sizeof(Stmt) * h->stmts);
+    Expr *expr_nodes = arena_calloc(arena, sizeof(Expr) * h->exprs);
+    Type *type_nodes = arena_calloc(arena, sizeof(Type) * h->types);
+    Param_list *param_nodes = arena_calloc(arena, sizeof(Param_list) * h->params);
+    Ast_bin_strings strings = {
+        .text = memcpy(arena_alloc(arena, h->string_bytes), data + text, h->string_bytes),
+        .offsets = string_offsets,
+        .names = safe_calloc(sizeof(char *), h->strings + 1),
+    };
+
+    for (uint32_t i = 0; i < h->decls; i++){
+        const Ast_bin_decl *r = &decl_records[i];
+        Decl *d = &decl_nodes[i];
+        d->name = ast_bin_name(&strings, r->name);
+        d->type = AST_BIN_NODE(type_nodes, r->type);
+        d->value = AST_BIN_NODE(expr_nodes, r->value);
+        d->code = AST_BIN_NODE(stmt_nodes, r->code);
+        d->next = AST_BIN_NODE(decl_nodes, r->next);
+    }
+    for (uint32_t i = 0; i < h->stmts; i++){
+        const Ast_bin_stmt *r = &stmt_records[i];
+        Stmt *s = &stmt_nodes[i];
+        s->kind = r->kind;
+        s->decl = AST_BIN_NODE(decl_nodes, r->decl);
+        s->init_expr = AST_BIN_NODE(expr_nodes, r->init_expr);
+        s->expr = AST_BIN_NODE(expr_nodes, r->expr);
+        s->next_expr = AST_BIN_NODE(expr_nodes, r->next_expr);
+        s->body = AST_BIN_NODE(stmt_nodes, r->body);
+        s->else_body = AST_BIN_NODE(stmt_nodes, r->else_body);
+        s->next = AST_BIN_NODE(stmt_nodes, r->next);
+    }
+    for (uint32_t i = 0; i < h->exprs; i++){
+        const Ast_bin_expr *r = &expr_records[i];
+        Expr *e = &expr_nodes[i];
+        e->kind = r->kind;
+        e->left = AST_BIN_NODE(expr_nodes, r->left);
+        e->right = AST_BIN_NODE(expr_nodes, r->right);
+        e->literal_value = r->literal_value;
+        if (e->kind == EXPR_IDENT){
+            e->name = ast_bin_name(&strings, r->string);
+        } else if (e->kind == EXPR_STR_LIT || e->kind == EXPR_CHAR_LIT){
+            e->string_literal = ast_bin_text(&strings, r->string);
+        } else if (e->kind == EXPR_DOUBLE_LIT || e->kind == EXPR_DOUBLE_SCIENTIFIC_LIT){
+            e->double_literal_value = r->double_value;
+        }
+    }
+    for (uint32_t i = 0; i < h->types; i++){
+        const Ast_bin_type *r = &type_records[i];
+        Type *t = &type_nodes[i];
+        t->kind = r->kind;
+        t->params = AST_BIN_NODE(param_nodes, r->params);
+        t->subtype = AST_BIN_NODE(type_nodes, r->subtype);
+        t->arr_len = AST_BIN_NODE(expr_nodes, r->arr_len);
+    }
+    for (uint32_t i = 0; i < h->params; i++){
+        const Ast_bin_param *r = &param_records[i];
+        Param_list *p = &param_nodes[i];
+        p->name = ast_bin_name(&strings, r->name);
+        p->type = AST_BIN_NODE(type_nodes, r->type);
+        p->next = AST_BIN_NODE(param_nodes, r->next);
+    }
+
+    free(strings.names);
+    *root = AST_BIN_NODE(decl_nodes, h->root);
+    return true;
+}
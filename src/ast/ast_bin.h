@@ -0,0 +1,103 @@
+/* ast_bin.h: binary serialized AST (--emit-ast-bin, --load-ast-bin) */
+
+#ifndef AST_BIN_H
+#define AST_BIN_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Forward Declaration */
+
+typedef struct Decl Decl;
+
+/* Macros */
+
+#define AST_BIN_MAGIC       "BMNRAST"       // first 8 bytes of a binary AST (with its NUL)
+#define AST_BIN_VERSION     1               // bumped whenever a record layout changes
+#define AST_BIN_ALIGN       8               // alignment of every section
+
+/* Structure */
+
+/*
+ * Layout: header, then one section per node table (decls, stmts, exprs, types,
+ * params), then the string offsets and the string bytes. Records are fixed size and
+ * link to each other by 1-based index into their table (0 -> NULL); a child always
+ * has a larger index than its parent, so a loaded tree has no cycles. Strings are
+ * deduplicated and referenced the same way. Values are in native byte order; a file
+ * from a machine of the other order fails the version check.
+ */
+
+typedef struct Ast_bin_header Ast_bin_header;
+
+struct Ast_bin_header {
+    char magic[8];              // AST_BIN_MAGIC
+    uint32_t version;           // AST_BIN_VERSION
+    uint32_t root;              // first global decl
+    uint32_t decls;             // records per table
+    uint32_t stmts;
+    uint32_t exprs;
+    uint32_t types;
+    uint32_t params;
+    uint32_t strings;           // strings in the string table
+    uint64_t string_bytes;      // bytes of string text, each NUL-terminated
+};
+
+typedef struct Ast_bin_decl Ast_bin_decl;
+
+struct Ast_bin_decl {
+    uint32_t name;              // string
+    uint32_t type;
+    uint32_t value;             // expr
+    uint32_t code;              // stmt
+    uint32_t next;              // decl
+};
+
+typedef struct Ast_bin_stmt Ast_bin_stmt;
+
+struct Ast_bin_stmt {
+    uint32_t kind;              // stmt_t
+    uint32_t decl;
+    uint32_t init_expr;
+    uint32_t expr;
+    uint32_t next_expr;
+    uint32_t body;
+    uint32_t else_body;
+    uint32_t next;
+};
+
+typedef struct Ast_bin_expr Ast_bin_expr;
+
+struct Ast_bin_expr {
+    uint32_t kind;              // expr_t
+    uint32_t left;
+    uint32_t right;
+    uint32_t string;            // name or decoded literal text
+    int32_t literal_value;
+    uint32_t reserved;          // keeps double_value aligned, always 0
+    double double_value;        // EXPR_DOUBLE_LIT, EXPR_DOUBLE_SCIENTIFIC_LIT
+};
+
+typedef struct Ast_bin_type Ast_bin_type;
+
+struct Ast_bin_type {
+    uint32_t kind;              // type_t
+    uint32_t params;            // param
+    uint32_t subtype;           // type
+    uint32_t arr_len;           // expr
+};
+
+typedef struct Ast_bin_param Ast_bin_param;
+
+struct Ast_bin_param {
+    uint32_t name;              // string
+    uint32_t type;
+    uint32_t next;              // param
+};
+
+/* Functions */
+
+bool    ast_bin_write(Decl *root, const char *file_name);
+bool    ast_bin_load(const char *data, size_t size, Decl **root);
+
+#endif
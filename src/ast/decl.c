@@ -9,20 +9,55 @@
 #include "symbol.h"
 #include "type.h"
 #include "scope.h"
+#include "intern.h"
 #include "utils.h"
 #include "label.h"
 #include "scratch.h"
 #include "str_lit.h"
+#include "loop.h"
+#include "pool.h"
+#include "fingerprint.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include <setjmp.h>
 
 /* Globals */
 
 const char *int_args[MAX_INT_ARGS] = { "%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9"};
 const char *double_args[MAX_DOUBLE_ARGS] = {"%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4", "%xmm5", "%xmm6", "%xmm7"};
 
+/* Structures */
+
+typedef struct Decl_job Decl_job;
+
+struct Decl_job {
+    Decl *decl;             // function declaration to process 
+    Compiler *worker;       // context it was processed in, NULL once joined 
+    bool failed;            // phase aborted 
+    char *code;             // generated assembly 
+    size_t code_size;
+    char *out;              // buffered compiler stdout 
+    size_t out_size;
+    char *err;              // buffered compiler stderr 
+    size_t err_size;
+};
+
+typedef void (*Decl_work)(Decl *d, FILE *f);
+typedef void (*Decl_merge)(Decl *d, Decl_job *job, FILE *f);
+
+typedef struct Decl_batch Decl_batch;
+
+struct Decl_batch {
+    Compiler *unit;         // compiler the functions belong to 
+    Decl_job *jobs;         // one per function declaration, in source order 
+    size_t count;           // number of jobs 
+    Decl_work work;         // runs one function in a worker context 
+    Decl_merge merge;       // runs serially for each decl, in source order, before a job's output is written 
+};
+
 /* Forward declaration of prototypes */
 
 static void decl_resolve_typecheck_functions(Decl *d);
@@ -30,12 +65,25 @@ static void decl_resolve_non_functions(Decl *d, Symbol *sym);
 static void decl_resolve_functions(Decl *d, Symbol *sym);
 static void decl_typecheck_non_functions(Decl *d) ;
 static void decl_typecheck_functions(Decl *d);
-static void decl_codegen_preprocess_funcs(Decl *d, FILE *f);
+static bool decl_codegen_preprocess_funcs(Decl *d, FILE *f);
 static void decl_codegen_funcs(Decl *d, FILE *f);
-static void decl_codegen_preprocess_non_funcs(Decl *d, FILE *f);
+static bool decl_codegen_preprocess_non_funcs(Decl *d, FILE *f);
 static void decl_codegen_string(Decl *d, FILE *f);
 static void decl_codegen_array(Decl *d, FILE *f);
 static void decl_codegen_non_funcs(Decl *d, FILE *f);
+static bool decl_typecheck_has_auto(Type *t);
+static bool decl_typecheck_parallel(Decl *d);
+static void decl_typecheck_work(Decl *d, FILE *f);
+static void decl_typecheck_merge(Decl *d, Decl_job *job, FILE *f);
+static void decl_codegen_text(FILE *f);
+static bool decl_codegen_prepare(Decl *d);
+static uint64_t decl_fingerprint(Decl *d);
+static void decl_codegen_work(Decl *d, FILE *f);
+static void decl_codegen_merge(Decl *d, Decl_job *job, FILE *f);
+static void decl_batch_run(Decl *d, FILE *f, int threads, Decl_work work, Decl_merge merge);
+static void decl_batch_job(void *arg, size_t index);
+static void decl_batch_merge(Decl_batch *batch, Decl *d, FILE *f);
+static void decl_batch_release(Decl_job *job);
 
 
 /* Functions */
@@ -50,8 +98,8 @@ static void decl_codegen_non_funcs(Decl *d, FILE *f);
  * @return  Pointer to the newly created Decl structure
  **/
 Decl* decl_create(const char *name, Type *type, Expr *value, Stmt *code, Decl *next){
-    Decl *decl = safe_calloc(sizeof(Decl), 1);
-    decl->name = safe_strdup(name);
+    Decl *decl = arena_calloc(b_ctx->arena, sizeof(Decl));
+    decl->name = intern(&b_ctx->names, name);
     decl->type = type;
     decl->value = value;
     decl->code = code;
@@ -59,33 +107,6 @@ Decl* decl_create(const char *name, Type *type, Expr *value, Stmt *code, Decl *n
 	return decl;
 }
 
-/**
- * Frees the Decl Struct 
- * @param d pointer to the Decl struct 
- */
-void decl_destroy(Decl *d){
-    if (!d) return;
-
-    Decl *next = d->next;
-    d->next = NULL;
-
-    if (d->name){
-        free(d->name);
-        d->name = NULL;
-    }
-
-    type_destroy(d->type);
-    d->type = NULL;
-    expr_destroy(d->value);
-    d->type = NULL;
-    stmt_destroy(d->code);
-    d->code = NULL;
-    if (d->owner) symbol_destroy(d->symbol);
-    d->symbol = NULL;
-    free(d);
-    decl_destroy(next);
-}
-
 /**
  * Prints a declaration node and its contents to stdout.
  * @param   d           The declaration to print
@@ -94,18 +115,18 @@ void decl_destroy(Decl *d){
 void decl_print(Decl *d, int indent){
     if (!d) { return; }
     print_indent(indent); 
-    printf("%s:", d->name);
-    type_print(d->type, stdout);
+    fprintf(b_ctx->out, "%s:", d->name);
+    type_print(d->type, b_ctx->out);
 
     if (d->value){      // print decl expression 
-        printf(" = ");
-        expr_print(d->value, stdout);
-        printf(";\n");
+        fprintf(b_ctx->out, " = ");
+        expr_print(d->value, b_ctx->out);
+        fprintf(b_ctx->out, ";\n");
     } else if (d->code){ // function, print body 
-        printf(" = ");
+        fprintf(b_ctx->out, " = ");
         stmt_print(d->code, 0);
     } else {            // decl with no expression or body
-        printf(";\n");
+        fprintf(b_ctx->out, ";\n");
     }
 
     decl_print(d->next, 0);
@@ -121,7 +142,6 @@ Decl *decl_copy(Decl *d){
     if (!d) return NULL;
     Decl *new_d = decl_create(d->name, type_copy(d->type), expr_copy(d->value), stmt_copy(d->code), decl_copy(d->next));
     new_d->symbol = symbol_copy(d->symbol);
-    new_d->owner = 1;
     return new_d;
 }
 
@@ -132,24 +152,24 @@ Decl *decl_copy(Decl *d){
 static void decl_resolve_typecheck_functions(Decl *d){
     // Case 2a: functions returns don't match 
     if (!type_equals(d->type->subtype,d->symbol->type->subtype)){
-        fprintf(stderr, "Resolver error: Function return type mismatch.\n");
-        fprintf(stderr, "\tExpected:\n\t\t");
-        type_print(d->symbol->type, stderr);
-        fprintf(stderr, "\n\tActual:\n\t\t");
-        type_print(d->type, stderr);
-        fprintf(stderr, "\n");
-        b_ctx.typechecker_errors++;
+        fprintf(b_ctx->err, "Resolver error: Function return type mismatch.\n");
+        fprintf(b_ctx->err, "\tExpected:\n\t\t");
+        type_print(d->symbol->type, b_ctx->err);
+        fprintf(b_ctx->err, "\n\tActual:\n\t\t");
+        type_print(d->type, b_ctx->err);
+        fprintf(b_ctx->err, "\n");
+        b_ctx->typechecker_errors++;
     }
 
     // Case 2b: functions parameters don't match 
     if (!param_list_equals(d->type->params, d->symbol->type->params)){
-        fprintf(stderr, "Resolver error: Parameter list mismatch for function '%s'.\n", d->name);
-        fprintf(stderr, "\tExpected parameters:\n\t\t");
-        param_list_print(d->symbol->type->params, stderr);
-        fprintf(stderr, "\n\tDefined parameters:\n\t\t");
-        param_list_print(d->type->params, stderr);
-        fprintf(stderr, "\n");
-        b_ctx.typechecker_errors++;    
+        fprintf(b_ctx->err, "Resolver error: Parameter list mismatch for function '%s'.\n", d->name);
+        fprintf(b_ctx->err, "\tExpected parameters:\n\t\t");
+        param_list_print(d->symbol->type->params, b_ctx->err);
+        fprintf(b_ctx->err, "\n\tDefined parameters:\n\t\t");
+        param_list_print(d->type->params, b_ctx->err);
+        fprintf(b_ctx->err, "\n");
+        b_ctx->typechecker_errors++;    
     }
 }
 
@@ -164,15 +184,13 @@ static void decl_resolve_non_functions(Decl *d, Symbol *sym){
     if (sym) {
         // Error: Redeclaration or Variable/Function name collision
         if (sym->type->kind == TYPE_FUNCTION){
-            fprintf(stderr, "Resolver error: Declaring Identifier with function name '%s'\n", d->name);
+            fprintf(b_ctx->err, "Resolver error: Declaring Identifier with function name '%s'\n", d->name);
         } else{
-            fprintf(stderr, "Resolver error: Redeclaring an Identifier '%s' in the same scope\n", d->name);
+            fprintf(b_ctx->err, "Resolver error: Redeclaring an Identifier '%s' in the same scope\n", d->name);
         }
-        b_ctx.resolver_errors += 1;
-        symbol_destroy(d->symbol);
+        b_ctx->resolver_errors += 1;
         d->symbol = sym;
     } else{
-        d->owner = 1;
         // Case 1b: if array decl with init braces pass symbol to it 
         if ((d->type->kind == TYPE_ARRAY || d->type->kind == TYPE_CARRAY || d->type->kind == TYPE_AUTO) && d->value && d->value->kind == EXPR_BRACES){
             d->value->symbol = d->symbol;
@@ -199,38 +217,32 @@ static void decl_resolve_functions(Decl *d, Symbol *sym){
         int sym_is_prototype = sym->func_decl; // symbol is function prototype
         // Error: Function name conflicts with non-function symbol
         if (sym->type->kind != TYPE_FUNCTION){
-            fprintf(stderr, "Resolver error: Reusing Identifier '%s' for function name\n", d->name);
-            b_ctx.resolver_errors += 1;
-            symbol_destroy(d->symbol);
+            fprintf(b_ctx->err, "Resolver error: Reusing Identifier '%s' for function name\n", d->name);
+            b_ctx->resolver_errors += 1;
             d->symbol = sym;
         // Case 2a: New definition (not prototype) AND existing symbol is a prototype
         } else if (!is_prototype && sym_is_prototype){
             sym->func_decl = 0;     // function has been initialized 
-            symbol_destroy(d->symbol);
             d->symbol = sym;
             decl_resolve_typecheck_functions(d);
         // Case 2b: New definition AND existing symbol is already a definition
         } else if (!is_prototype && !sym_is_prototype){
-            fprintf(stderr, "Resolver error: redefinition of '%s'\n", d->name);
-            b_ctx.resolver_errors += 1;
-            symbol_destroy(d->symbol);
+            fprintf(b_ctx->err, "Resolver error: redefinition of '%s'\n", d->name);
+            b_ctx->resolver_errors += 1;
             d->symbol = sym;
             decl_resolve_typecheck_functions(d);
         // Case 2c: New prototype AND existing symbol is already defined
         } else if (is_prototype && !sym_is_prototype){
-            fprintf(stderr, "Resolver Warning: '%s' prototype already defined, using the first declaration as reference\n", d->name);
-            symbol_destroy(d->symbol);
+            fprintf(b_ctx->err, "Resolver Warning: '%s' prototype already defined, using the first declaration as reference\n", d->name);
             d->symbol = sym;
             decl_resolve_typecheck_functions(d);
         // Case 2d: New prototype AND existing symbol is also a prototype
         } else if (is_prototype && sym_is_prototype){ 
-            fprintf(stderr, "Resolver Warning: '%s' prototype already defined, using the first declaration as reference\n", d->name);
-            symbol_destroy(d->symbol);
+            fprintf(b_ctx->err, "Resolver Warning: '%s' prototype already defined, using the first declaration as reference\n", d->name);
             d->symbol = sym;
             decl_resolve_typecheck_functions(d);
         }
     } else{
-        d->owner = 1;
         scope_bind(d->name, d->symbol);    
     }
 
@@ -273,6 +285,70 @@ void decl_resolve(Decl *d){
     decl_resolve(d->next);
 }
 
+/**
+ * Marks the global symbols referenced by a single declaration (initializer, array 
+ * length, and function body) as reachable. Does not follow d->next.
+ * @param   d       ptr to decl to walk 
+ */
+void decl_mark_reachable(Decl *d){
+    if (!d) return;
+    expr_mark_reachable(d->value);
+    if (d->type) expr_mark_reachable(d->type->arr_len);
+    stmt_mark_reachable(d->code);
+}
+
+/**
+ * Performs whole-program reachability analysis starting from 'main' over the call graph 
+ * of resolved symbols. Globals that are never referenced stay unmarked and are skipped by 
+ * decl_codegen. If the program has no 'main' every global is kept.
+ * @param   d       ptr to the global decl list 
+ */
+void decl_reachability(Decl *d){
+    Decl *main_decl = NULL;
+
+    // link each global symbol to the decl that defines it (body or initializer)
+    for (Decl *curr = d; curr; curr = curr->next){
+        if (!curr->symbol) continue;
+        if (curr->code || curr->value || !curr->symbol->def){
+            curr->symbol->def = curr;
+        }
+        if (curr->code && curr->name == intern(&b_ctx->names, "main")){
+            main_decl = curr;
+        }
+    }
+
+    // case 1: no entry point (e.g library unit) -> everything is reachable
+    if (!main_decl){
+        for (Decl *curr = d; curr; curr = curr->next){
+            if (curr->symbol) curr->symbol->reachable = 1;
+        }
+        return;
+    }
+
+    // case 2: walk the call graph from main 
+    main_decl->symbol->reachable = 1;
+    decl_mark_reachable(main_decl);
+}
+
+/**
+ * Interns the string literals a single declaration's code generation uses: its 
+ * initializer, the empty string for strings without one or for the padding of string 
+ * arrays, and the literals of a function body. Does not follow d->next.
+ * @param   d       ptr to decl to walk 
+ */
+void decl_intern_strings(Decl *d){
+    if (!d) return;
+    if (d->type->kind == TYPE_STRING && !d->value) string_intern("");
+    expr_intern_strings(d->value);
+    if ((d->type->kind == TYPE_ARRAY || d->type->kind == TYPE_CARRAY) && d->type->subtype->kind == TYPE_STRING &&
+        d->type->arr_len && d->symbol->kind == SYMBOL_GLOBAL){
+        int count = 0;
+        for (Expr *curr = d->value ? d->value->right : NULL; curr; curr = curr->right) count++;
+        if (count < d->type->arr_len->literal_value) string_intern("");
+    }
+    stmt_intern_strings(d->code);
+}
+
 /**
  * Perform type checking for a declaration that is not a function.
  * @param d   Pointer to the declaration to type check.
@@ -285,17 +361,15 @@ static void decl_typecheck_non_functions(Decl *d) {
         if (d->type->kind == TYPE_AUTO){
             // case 1a-1: typechecker returns void cannot infer the type
             if (t->kind == TYPE_VOID || t->kind == TYPE_AUTO){
-                fprintf(stderr, "typechecker error: Declaration '%s' cannot infer type of (", d->name);
-                type_print(t, stderr);
-                fprintf(stderr, " )\n");
-                b_ctx.typechecker_errors++;
+                fprintf(b_ctx->err, "typechecker error: Declaration '%s' cannot infer type of (", d->name);
+                type_print(t, b_ctx->err);
+                fprintf(b_ctx->err, " )\n");
+                b_ctx->typechecker_errors++;
             // case 1a-2: typechecker replaces auto with inferred type 
             } else {
-                fprintf(stdout, "typechecker resolved: '%s' type set to (", d->name);
-                type_print(t, stdout);
-                fprintf(stdout, " )\n");
-                type_destroy(d->type);
-                type_destroy(d->symbol->type);
+                fprintf(b_ctx->out, "typechecker resolved: '%s' type set to (", d->name);
+                type_print(t, b_ctx->out);
+                fprintf(b_ctx->out, " )\n");
                 d->type = type_copy(t);
                 d->symbol->type = type_copy(t);
             }
@@ -303,33 +377,31 @@ static void decl_typecheck_non_functions(Decl *d) {
 
         // Case 1b: types don't match throw errors
         if (t && t->kind != d->type->kind){
-            fprintf(stderr, "typechecker error: Cannot assign value of type");
-            type_print(t, stderr);
-            fprintf(stderr, " to variable '%s' of type ", d->name);
-            type_print(d->type, stderr);
-            fprintf(stderr, ".\n");
-            b_ctx.typechecker_errors++;
+            fprintf(b_ctx->err, "typechecker error: Cannot assign value of type");
+            type_print(t, b_ctx->err);
+            fprintf(b_ctx->err, " to variable '%s' of type ", d->name);
+            type_print(d->type, b_ctx->err);
+            fprintf(b_ctx->err, ".\n");
+            b_ctx->typechecker_errors++;
         }
 
         // Case 1c: Global variable is not a constant value (e.g not Literal)
         if (d->symbol->kind == SYMBOL_GLOBAL){
             if (!expr_is_literal(d->value->kind) && !(d->value->kind == EXPR_NEGATION && expr_is_literal(d->value->left->kind))){
-                fprintf(stderr, "typechecker error: Global variable '%s' must be initialized with a constant value, (",d->name);
-                expr_print(d->value, stderr);
-                fprintf(stderr, ") is not constant.\n");
-                b_ctx.typechecker_errors++;
+                fprintf(b_ctx->err, "typechecker error: Global variable '%s' must be initialized with a constant value, (",d->name);
+                expr_print(d->value, b_ctx->err);
+                fprintf(b_ctx->err, ") is not constant.\n");
+                b_ctx->typechecker_errors++;
             }
         }
 
         // Case 1d: Local array is initialized with '{}', which are not allowed
         if (d->symbol->kind == SYMBOL_LOCAL){
             if ((d->type->kind == TYPE_ARRAY || d->type->kind == TYPE_CARRAY) && d->value->kind == EXPR_BRACES){
-                fprintf(stderr, "typechecker error: Local variable '%s' cannot have an array initializer '{}'\n", d->name);
-                b_ctx.typechecker_errors++;
+                fprintf(b_ctx->err, "typechecker error: Local variable '%s' cannot have an array initializer '{}'\n", d->name);
+                b_ctx->typechecker_errors++;
             }
         }
-        
-        type_destroy(t);
     }
     t = d->type;
     bool scope_lvl = d->symbol->kind == SYMBOL_GLOBAL ? true : false;
@@ -340,14 +412,14 @@ static void decl_typecheck_non_functions(Decl *d) {
             if ((t->kind == TYPE_ARRAY || t->kind == TYPE_CARRAY)){
                 // case 2a: array length is not integer 
                 if (t->arr_len && t->arr_len->kind != EXPR_INT_LIT){
-                    fprintf(stderr, "typechecker error: Array size must be constant 'integer literal', non-constant expression (");
-                    expr_print(t->arr_len, stderr);
-                    fprintf(stderr, ") used.\n");
-                    b_ctx.typechecker_errors++; 
+                    fprintf(b_ctx->err, "typechecker error: Array size must be constant 'integer literal', non-constant expression (");
+                    expr_print(t->arr_len, b_ctx->err);
+                    fprintf(b_ctx->err, ") used.\n");
+                    b_ctx->typechecker_errors++; 
                 // case 2b: array init is less than 0 throw error
                 } else if (t->arr_len && t->arr_len->literal_value <= 0){
-                    fprintf(stderr, "typechecker error: Array size must be larger than 0 for '%s'\n", d->name);
-                    b_ctx.typechecker_errors++; 
+                    fprintf(b_ctx->err, "typechecker error: Array size must be larger than 0 for '%s'\n", d->name);
+                    b_ctx->typechecker_errors++; 
                 }
             }
         // local scope type cases 
@@ -356,20 +428,17 @@ static void decl_typecheck_non_functions(Decl *d) {
             if ((t->kind == TYPE_ARRAY || t->kind == TYPE_CARRAY)){
                 Type *dummy_t = expr_typecheck(t->arr_len);
                 if (!dummy_t || dummy_t->kind != TYPE_INTEGER){
-                    fprintf(stderr, "typechecker error: Array '%s' must have array size of type integer not of type (", d->name);
-                    type_print(t, stderr);
-                    fprintf(stderr, " )\n");
-                    b_ctx.typechecker_errors++; 
+                    fprintf(b_ctx->err, "typechecker error: Array '%s' must have array size of type integer not of type (", d->name);
+                    type_print(t, b_ctx->err);
+                    fprintf(b_ctx->err, " )\n");
+                    b_ctx->typechecker_errors++; 
                 }
-                type_destroy(dummy_t);
-                
             }
         }
         t = t->subtype;
     }
     // case 1: decl resolve in expr_codegen never updated -> update
     if (!type_equals(d->type, d->symbol->type)){
-        type_destroy(d->type);
         d->type = type_copy(d->symbol->type);
     }
 }
@@ -387,19 +456,19 @@ static void decl_typecheck_functions(Decl *d){
 
     // Case 2b: check if function returns valid type (handled by parser)
     if (!type_valid_return(d->type->subtype)){
-        fprintf(stderr, "typechecker error: Cannot assign");
-        type_print(d->type->subtype, stderr);
-        fprintf(stderr, " as function return type\n");
-        b_ctx.typechecker_errors++;
+        fprintf(b_ctx->err, "typechecker error: Cannot assign");
+        type_print(d->type->subtype, b_ctx->err);
+        fprintf(b_ctx->err, " as function return type\n");
+        b_ctx->typechecker_errors++;
     }
 
     // Case 2c: function params cannot be of type auto or void or functions (handled by parser)
     if (!param_list_valid_type(d->type->params)){
-        fprintf(stderr, "typechecker error: Invalid type for parameters in function '%s'\n", d->name);
-        fprintf(stderr, "\tDeclared Parameters: \n\t\t");
-        param_list_print(d->type->params, stderr);
-        fprintf(stderr,"\n\tParameters cannot be of type 'void' or 'auto'\n");
-        b_ctx.typechecker_errors++;
+        fprintf(b_ctx->err, "typechecker error: Invalid type for parameters in function '%s'\n", d->name);
+        fprintf(b_ctx->err, "\tDeclared Parameters: \n\t\t");
+        param_list_print(d->type->params, b_ctx->err);
+        fprintf(b_ctx->err,"\n\tParameters cannot be of type 'void' or 'auto'\n");
+        b_ctx->typechecker_errors++;
     }
 
     // Case 2d: check if function has a return if non-void
@@ -407,13 +476,13 @@ static void decl_typecheck_functions(Decl *d){
         res = stmt_typecheck(d->code);
         // case 2d-1: reaches end of void function with auto type -> set type to auto 
         if (!res && d->type->subtype->kind == TYPE_AUTO){
-            fprintf(stdout, "typechecker resolved: function '%s' ( auto ) return type is set to ( void )\n", d->name);
+            fprintf(b_ctx->out, "typechecker resolved: function '%s' ( auto ) return type is set to ( void )\n", d->name);
             d->type->subtype->kind = TYPE_AUTO;
             d->symbol->type->subtype->kind = TYPE_AUTO;
         } 
         // case 2d-2: reaches end of non-void function throw a warning. 
         if (!res && d->type->subtype->kind != TYPE_VOID){
-            fprintf(stdout, "typechecker warning: control reaches end of non-void function '%s'\n", d->name);
+            fprintf(b_ctx->out, "typechecker warning: control reaches end of non-void function '%s'\n", d->name);
         }
         // return type auto was set in stmt_typecheck, update decl
         if (d->type->subtype->kind == TYPE_AUTO && d->symbol->type->subtype->kind != TYPE_AUTO){
@@ -429,13 +498,13 @@ static void decl_typecheck_functions(Decl *d){
 void decl_typecheck(Decl *d){
     if (!d) return;
     if (!d->type){
-        b_ctx.typechecker_errors += 1;
-        fprintf(stderr, "%s is not attached to type structure\n", d->name);
+        b_ctx->typechecker_errors += 1;
+        fprintf(b_ctx->err, "%s is not attached to type structure\n", d->name);
         return;
     }
     if (!d->symbol) {
-        b_ctx.typechecker_errors += 1;
-        fprintf(stderr, "%s is not attached to symbol structure\n", d->name);
+        b_ctx->typechecker_errors += 1;
+        fprintf(b_ctx->err, "%s is not attached to symbol structure\n", d->name);
         return;
     }
 
@@ -449,6 +518,73 @@ void decl_typecheck(Decl *d){
     decl_typecheck(d->next);
 }
 
+/**
+ * Checks if a type mentions auto anywhere (subtypes, return type, or parameters)
+ * @param   t       type to check 
+ * @return  true if auto appears in the type, otherwise false 
+ */
+static bool decl_typecheck_has_auto(Type *t){
+    for (; t; t = t->subtype){
+        if (t->kind == TYPE_AUTO) return true;
+        for (Param_list *p = t->params; p; p = p->next){
+            if (decl_typecheck_has_auto(p->type)) return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Checks if function bodies can be typechecked apart. Inference writes the types of 
+ * global symbols that later declarations read, so units with an auto global (or a 
+ * function with an auto return type) are checked serially.
+ * @param   d       global decl list 
+ * @return  true if the bodies only read global symbols, otherwise false 
+ */
+static bool decl_typecheck_parallel(Decl *d){
+    for (Decl *curr = d; curr; curr = curr->next){
+        if (!curr->type || !curr->symbol) return false;
+        if (decl_typecheck_has_auto(curr->type)) return false;
+    }
+    return true;
+}
+
+/**
+ * Batch work: typechecks one function in a worker context 
+ * @param   d       function declaration 
+ * @param   f       unused 
+ */
+static void decl_typecheck_work(Decl *d, FILE *f){
+    (void)f;
+    decl_typecheck_functions(d);
+}
+
+/**
+ * Batch merge: typechecks variable declarations in source order, between the 
+ * buffered output of the functions around them 
+ * @param   d       declaration being merged 
+ * @param   job     function job for d, NULL for variables 
+ * @param   f       unused 
+ */
+static void decl_typecheck_merge(Decl *d, Decl_job *job, FILE *f){
+    (void)f;
+    if (!job) decl_typecheck_non_functions(d);
+}
+
+/**
+ * Perform typechecking on the global decl list, checking function bodies on 
+ * b_ctx->options.threads threads. Diagnostics come out in source order, the same 
+ * as decl_typecheck, and each worker counts its own errors.
+ * @param   d       global decl list 
+ */
+void decl_typecheck_program(Decl *d){
+    int threads = b_ctx->options.threads;
+    if (threads <= 1 || !decl_typecheck_parallel(d)){
+        decl_typecheck(d);
+        return;
+    }
+    decl_batch_run(d, NULL, threads, decl_typecheck_work, decl_typecheck_merge);
+}
+
 /**
  * Preprocessing stage for decl codegen, this walks decl AST and determines if
  * function declarations follow the simplified requirements. 
@@ -458,31 +594,35 @@ void decl_typecheck(Decl *d){
  *          - No function calls with more than 6 arguments 
  * If requirements are not met the function fails 
  * @param   d       function declaration to preprocess 
- * @param   f       file ptr to write errors to 
+ * @param   f       file ptr to write errors to (NULL -> only report the result)
+ * @return  true if the requirements are met, otherwise false (only returns with f NULL)
  */
-static void decl_codegen_preprocess_funcs(Decl *d, FILE *f){
+static bool decl_codegen_preprocess_funcs(Decl *d, FILE *f){
     Param_list *params = d->type->params;
     int count = 0;
     while (params){
         type_t type_param = params->type->kind;
         // Case 1a: function has argument double -> not supported
         if (type_param == TYPE_DOUBLE){
-            fprintf(stderr, "codegen error: Double type not supported\n");
+            if (!f) return false;
+            fprintf(b_ctx->err, "codegen error: Double type not supported\n");
             fprintf(f, "codegen error: Double type not supported\n");
-            exit(EXIT_FAILURE);
+            compiler_abort();
         // Case 1b: Function has argument array 
         } else if (type_param == TYPE_ARRAY || type_param == TYPE_CARRAY){
             type_param = params->type->subtype->kind;
             // Case 1b-1: Function has argument of an array with subtype double -> not supported 
             if (type_param == TYPE_DOUBLE){
-                fprintf(stderr, "codegen error: Double type not supported for arrays \n");
+                if (!f) return false;
+                fprintf(b_ctx->err, "codegen error: Double type not supported for arrays \n");
                 fprintf(f, "codegen error: Double type not supported for arrays\n");
-                exit(EXIT_FAILURE);
+                compiler_abort();
             // Case 1b-2: Function has argument of multi-dim arrays -> not supported 
             } else if (type_param == TYPE_ARRAY || type_param == TYPE_CARRAY){
-                fprintf(stderr, "codegen error: Multi-dimensional arrays are not supported\n");
+                if (!f) return false;
+                fprintf(b_ctx->err, "codegen error: Multi-dimensional arrays are not supported\n");
                 fprintf(f, "codegen error: Multi-dimensional arrays are not supported\n");
-                exit(EXIT_FAILURE);
+                compiler_abort();
             }
         }
         params = params->next;
@@ -490,24 +630,28 @@ static void decl_codegen_preprocess_funcs(Decl *d, FILE *f){
     }
     // case 2a: function with too many arguments (more than 6) -> failure not implemented 
     if (count > 6){
-        fprintf(stderr, "codegen error: Function '%s' has more than 6 arguments, functions with more than 6 arguments are not implemented\n", d->name);
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Function '%s' has more than 6 arguments, functions with more than 6 arguments are not implemented\n", d->name);
         fprintf(f, "codegen error: Function '%s' has more than 6 arguments, functions with more than 6 arguments are not implemented\n", d->name);
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
 
     // case 2b: function return type never resolved -> failure cannot implement
     if (d->type->subtype->kind == TYPE_AUTO){
-        fprintf(stderr, "codegen error: Auto type never resolved\n");
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Auto type never resolved\n");
         fprintf(f, "codegen error: Auto type never resolved\n");
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
 
     // case 2c: function return type is double -> not supported
     if (d->type->subtype->kind == TYPE_DOUBLE){
-        fprintf(stderr, "codegen error: Double type not supported\n");
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Double type not supported\n");
         fprintf(f, "codegen error: Double type not supported\n");
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
+    return true;
 }
 
 /**
@@ -516,11 +660,10 @@ static void decl_codegen_preprocess_funcs(Decl *d, FILE *f){
  * @param   f       File ptr to generate code to 
  */
 static void decl_codegen_funcs(Decl *d, FILE *f){
-    if (!b_ctx.text_flag) {
-        b_ctx.data_flag = false;
-        b_ctx.text_flag = true;
-        fprintf(f, ".text\n");
-    }
+    // labels are numbered per function so functions can be generated on any thread 
+    b_ctx->label_prefix = d->name;
+    b_ctx->label_count = 0;
+
     fprintf(f, ".global %s\n"
                 "%s:\n", d->name, d->name);
     // save stack ptr 
@@ -561,6 +704,19 @@ static void decl_codegen_funcs(Decl *d, FILE *f){
     fprintf(f, "\tMOVQ %%rbp, %%rsp\n"
                 "\tPOPQ %%rbp\n"
                 "\tRET\n");
+    b_ctx->label_prefix = NULL;
+}
+
+/**
+ * Switches the output to the .text section unless it is already there 
+ * @param   f       File ptr to generate code to 
+ */
+static void decl_codegen_text(FILE *f){
+    if (!b_ctx->text_flag) {
+        b_ctx->data_flag = false;
+        b_ctx->text_flag = true;
+        fprintf(f, ".text\n");
+    }
 }
 
 /**
@@ -571,45 +727,52 @@ static void decl_codegen_funcs(Decl *d, FILE *f){
  *          - No double support 
  * If requirements are not met non-function decls it fails code generation  
  * @param   d       Non-function declaration to preprocess 
- * @param   f       file ptr to write errors to 
+ * @param   f       file ptr to write errors to (NULL -> only report the result)
+ * @return  true if the requirements are met, otherwise false (only returns with f NULL)
  */
-static void decl_codegen_preprocess_non_funcs(Decl *d, FILE *f){
+static bool decl_codegen_preprocess_non_funcs(Decl *d, FILE *f){
     // case 2a: declaration is a multi-dimensional array -> failure not implemented 
     if ((d->type->kind == TYPE_ARRAY || d->type->kind == TYPE_CARRAY) && 
         (d->type->subtype->kind == TYPE_ARRAY || d->type->subtype->kind == TYPE_CARRAY)){
-        fprintf(stderr, "codegen error: Multi-dimensional arrays are not supported\n");
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Multi-dimensional arrays are not supported\n");
         fprintf(f, "codegen error: Multi-dimensional arrays are not supported\n");
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
 
     // case 2b: local declaration is an array -> failure not implemented 
     if (d->symbol->kind == SYMBOL_LOCAL && (d->type->kind == TYPE_ARRAY || d->type->kind == TYPE_CARRAY)){
-        fprintf(stderr, "codegen error: Arrays at local scope are not implemented\n");
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Arrays at local scope are not implemented\n");
         fprintf(f, "codegen error: Arrays at local scope are not implemented\n");
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
 
     // case 2c: auto never resolved -> failure cannot implement 
     if (d->type->kind == TYPE_AUTO || ((d->type->kind == TYPE_ARRAY || d->type->kind == TYPE_CARRAY) && (d->type->subtype->kind == TYPE_AUTO))){
-        fprintf(stderr, "codegen error: Auto type never resolved\n");
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Auto type never resolved\n");
         fprintf(f, "codegen error: Auto type never resolved\n");
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
 
     // case 2d: double type not supported -> failure 
     if (d->type->kind == TYPE_DOUBLE){
-        fprintf(stderr, "codegen error: Double type not supported\n");
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Double type not supported\n");
         fprintf(f, "codegen error: Double type not supported\n");
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
 
     // case 2e: array of double type not supported -> failure
     if ((d->type->kind == TYPE_ARRAY || d->type->kind == TYPE_CARRAY) && 
         d->type->subtype->kind == TYPE_DOUBLE){
-        fprintf(stderr, "codegen error: Double type not supported for arrays \n");
+        if (!f) return false;
+        fprintf(b_ctx->err, "codegen error: Double type not supported for arrays \n");
         fprintf(f, "codegen error: Double type not supported for arrays\n");
-        exit(EXIT_FAILURE);
+        compiler_abort();
     }
+    return true;
 }
 
 /**
@@ -626,15 +789,13 @@ static void decl_codegen_string(Decl *d, FILE *f){
             // case 1a-1: expression is identifier, assign str_lit to decl
             if (d->value->kind == EXPR_IDENT){
                 d->symbol->str_lit = d->value->symbol->str_lit;
-            // case 1a-2: expression is literal -> create string label -> allocated str_lit to decl
+            // case 1a-2: expression is literal -> intern string literal -> assign str_lit to decl
             } else {
-                int label = string_label_create();
-                d->symbol->str_lit = string_alloc(d->value->string_literal, string_label_name(label));
+                d->symbol->str_lit = string_intern(d->value->string_literal);
             }
-        // case 1b: string decl has no expression -> create string label for empty string -> alloc str_lit to decl
+        // case 1b: string decl has no expression -> intern empty string -> assign str_lit to decl
         } else {
-            int label = string_label_create();
-            d->symbol->str_lit = string_alloc("", string_label_name(label));
+            d->symbol->str_lit = string_intern("");
         }
     // case 2: decl is local variable 
     } else {
@@ -643,19 +804,17 @@ static void decl_codegen_string(Decl *d, FILE *f){
             // case 2a-1: right side is identifier -> pass str_lit of right side to decl 
             if (d->value->kind == EXPR_IDENT){
                 d->symbol->str_lit = d->value->symbol->str_lit;
-            // case 2a-2: right side is string literal -> create label + str_lit 
+            // case 2a-2: right side is string literal -> intern str_lit 
             } else {
-                int label = string_label_create();
-                d->symbol->str_lit = string_alloc(d->value->string_literal, string_label_name(label));
+                d->symbol->str_lit = string_intern(d->value->string_literal);
             }
             d->value->symbol = d->symbol;
             expr_codegen(d->value, f);
             fprintf(f, "\tMOVQ %s, %s\n", scratch_name(d->value->reg), symbol_codegen(d->symbol));
             scratch_free(d->value->reg);
-        // case 2b: string decl has no expression -> create label + str_lit 
+        // case 2b: string decl has no expression -> intern empty str_lit 
         } else {
-            int label = string_label_create();
-            d->symbol->str_lit = string_alloc("", string_label_name(label));
+            d->symbol->str_lit = string_intern("");
             fprintf(f, "\tMOVQ $%s, %s\n", d->symbol->str_lit->label, symbol_codegen(d->symbol));
         }
     }
@@ -686,10 +845,7 @@ static void decl_codegen_array(Decl *d, FILE *f){
             else { fprintf(f, " "); }
 
             if (subtype == TYPE_STRING){
-                int label = string_label_create();
-                const char *label_name = string_label_name(label);
-                string_alloc(curr->left->string_literal, label_name);
-                fprintf(f, "%s", label_name);
+                fprintf(f, "%s", string_intern(curr->left->string_literal)->label);
             } else {
                 fprintf(f, "%d", curr->left->literal_value);
             }
@@ -698,19 +854,12 @@ static void decl_codegen_array(Decl *d, FILE *f){
         }
 
         // if array init it empty -> init with NULL
-        int label = 0;
         while (count < total_len){
             if (count > 0) { fprintf(f, ", "); } 
-            else {
-                fprintf(f, " ");
-                if (subtype == TYPE_STRING){ 
-                    label = string_label_create(); 
-                    string_alloc("", string_label_name(label));
-                }
-            }
+            else { fprintf(f, " "); }
 
             if (subtype == TYPE_STRING){
-                fprintf(f, "%s", string_label_name(label));
+                fprintf(f, "%s", string_intern("")->label);
             } else {
                 fprintf(f, "0");
             }
@@ -727,9 +876,9 @@ static void decl_codegen_array(Decl *d, FILE *f){
  */
 static void decl_codegen_non_funcs(Decl *d, FILE *f){
     symbol_t sym_type = d->symbol->kind;
-    if (sym_type == SYMBOL_GLOBAL && !b_ctx.data_flag){
-        b_ctx.data_flag = true;
-        b_ctx.text_flag = false;
+    if (sym_type == SYMBOL_GLOBAL && !b_ctx->data_flag){
+        b_ctx->data_flag = true;
+        b_ctx->text_flag = false;
         fprintf(f, ".data\n");
     }
     switch (d->type->kind){
@@ -753,9 +902,9 @@ static void decl_codegen_non_funcs(Decl *d, FILE *f){
             }
             break;
         case TYPE_DOUBLE:
-            fprintf(stderr, "codegen error: Double type not supported\n");
+            fprintf(b_ctx->err, "codegen error: Double type not supported\n");
             fprintf(f, "codegen error: Double type not supported\n");
-            exit(EXIT_FAILURE);
+            compiler_abort();
             break;
         case TYPE_STRING:
             decl_codegen_string(d, f);
@@ -765,8 +914,8 @@ static void decl_codegen_non_funcs(Decl *d, FILE *f){
             decl_codegen_array(d, f);
             break;
         default:
-            fprintf(stderr, "codegen error: Invalid type in variable declaration\n");
-            exit(EXIT_FAILURE);
+            fprintf(b_ctx->err, "codegen error: Invalid type in variable declaration\n");
+            compiler_abort();
             break;
     }
 }
@@ -779,17 +928,231 @@ static void decl_codegen_non_funcs(Decl *d, FILE *f){
 void decl_codegen(Decl *d, FILE *f){
     if (!d || !f) return;
 
+    // globals never reached from main are dead code -> only run the checks
+    bool dead = d->symbol->kind == SYMBOL_GLOBAL && !d->symbol->reachable;
+
     // case 1: code generation on function 
     if (d->type->kind == TYPE_FUNCTION){
         decl_codegen_preprocess_funcs(d, f);
-        if (d->code){
-            decl_codegen_funcs(d, f);
+        if (d->code && !dead){
+            decl_codegen_text(f);
+            long offset = ftell(f);
+            if (!fingerprints_reuse(b_ctx->fingerprints, d, f)) decl_codegen_funcs(d, f);
+            fingerprints_record(b_ctx->fingerprints, d, offset, ftell(f) - offset);
         }
     // case 2: code generation on variable declarations
     } else {
         decl_codegen_preprocess_non_funcs(d, f);
-        decl_codegen_non_funcs(d, f);
+        if (!dead) decl_codegen_non_funcs(d, f);
     }
 
     decl_codegen(d->next, f);
 }
+
+/**
+ * Serial work done before functions are generated: string literals of live decls are 
+ * interned in source order (fixing their labels), global strings get their literal, 
+ * and loops are analyzed along with the side-effect summaries they consult. Units that 
+ * fail a codegen check are generated serially, so nothing past the failing decl is 
+ * generated. For incremental codegen, live functions are then fingerprinted.
+ * @param   d       global decl list 
+ * @return  true if functions can be generated in parallel, otherwise false 
+ */
+static bool decl_codegen_prepare(Decl *d){
+    for (Decl *curr = d; curr; curr = curr->next){
+        bool supported = curr->type->kind == TYPE_FUNCTION ? decl_codegen_preprocess_funcs(curr, NULL) 
+                                                           : decl_codegen_preprocess_non_funcs(curr, NULL);
+        if (!supported) return false;
+    }
+
+    bool parallel = true;
+    for (Decl *curr = d; curr; curr = curr->next){
+        if (!curr->symbol->reachable) continue;
+        decl_intern_strings(curr);
+        if (curr->type->kind == TYPE_STRING){
+            decl_codegen_string(curr, NULL);
+        } else if (curr->type->kind == TYPE_FUNCTION && curr->code){
+            loop_analyze(curr->code);
+            if (stmt_assigns_global_string(curr->code)) parallel = false;
+        }
+    }
+
+    // a function assigning a global string changes code generated after it -> no reuse 
+    bool incremental = parallel && b_ctx->fingerprints;
+    for (Decl *curr = d; curr; curr = curr->next){
+        bool live = curr->symbol->reachable && curr->type->kind == TYPE_FUNCTION && curr->code;
+        curr->fingerprint = incremental && live ? decl_fingerprint(curr) : 0;
+    }
+    return parallel;
+}
+
+/**
+ * Fingerprints a function for incremental codegen: its signature, locals, and body 
+ * along with the globals, string labels, and callee summaries the body uses 
+ * @param   d       function declaration 
+ * @return  fingerprint of d (never 0)
+ */
+static uint64_t decl_fingerprint(Decl *d){
+    uint64_t hash = fingerprint_string(FINGERPRINT_SEED, d->name);
+    hash = type_fingerprint(d->type, hash);
+    hash = fingerprint_int(hash, d->local);
+    hash = stmt_fingerprint(d->code, hash);
+    return hash ? hash : 1;
+}
+
+/**
+ * Batch work: checks and generates one function in a worker context 
+ * @param   d       function declaration 
+ * @param   f       buffer to generate code to 
+ */
+static void decl_codegen_work(Decl *d, FILE *f){
+    decl_codegen_preprocess_funcs(d, f);
+    if (d->code && d->symbol->reachable && !fingerprints_reuse(compiler_unit()->fingerprints, d, f)){
+        decl_codegen_funcs(d, f);
+    }
+}
+
+/**
+ * Batch merge: generates variables in source order and switches to .text before 
+ * each generated function 
+ * @param   d       declaration being merged 
+ * @param   job     function job for d, NULL for variables 
+ * @param   f       file pointer to output code generation 
+ */
+static void decl_codegen_merge(Decl *d, Decl_job *job, FILE *f){
+    if (!job){
+        decl_codegen_preprocess_non_funcs(d, f);
+        if (d->symbol->reachable) decl_codegen_non_funcs(d, f);
+    } else if (d->code && d->symbol->reachable && decl_codegen_preprocess_funcs(d, NULL)){
+        decl_codegen_text(f);
+        fingerprints_record(b_ctx->fingerprints, d, ftell(f), job->code_size);
+    }
+}
+
+/**
+ * Perform code generation on the global decl list, generating function bodies on 
+ * b_ctx->options.threads threads. Output is the same for every thread count.
+ * @param   d       global decl list 
+ * @param   f       file pointer to output code generation 
+ */
+void decl_codegen_program(Decl *d, FILE *f){
+    if (!d || !f) return;
+
+    bool parallel = decl_codegen_prepare(d);
+    int threads = b_ctx->options.threads;
+    if (!parallel || threads <= 1){
+        decl_codegen(d, f);
+        return;
+    }
+    decl_batch_run(d, f, threads, decl_codegen_work, decl_codegen_merge);
+}
+
+/**
+ * Runs work on every function of the decl list on a pool of threads, each function 
+ * in its own worker context with buffered output, then merges the results into the 
+ * unit in source order. A failed function stops the merge there, like a serial pass.
+ * @param   d       global decl list 
+ * @param   f       file pointer the functions' buffered code is written to (may be NULL)
+ * @param   threads number of threads 
+ * @param   work    runs one function 
+ * @param   merge   runs for each decl in source order 
+ */
+static void decl_batch_run(Decl *d, FILE *f, int threads, Decl_work work, Decl_merge merge){
+    Decl_batch batch = { .unit = b_ctx, .work = work, .merge = merge };
+    for (Decl *curr = d; curr; curr = curr->next){
+        if (curr->type->kind == TYPE_FUNCTION) batch.count++;
+    }
+
+    batch.jobs = safe_calloc(sizeof(Decl_job), batch.count ? batch.count : 1);
+    Decl_job *job = batch.jobs;
+    for (Decl *curr = d; curr; curr = curr->next){
+        if (curr->type->kind == TYPE_FUNCTION) (job++)->decl = curr;
+    }
+    pool_run(threads, batch.count, decl_batch_job, &batch);
+
+    // merge under a local bail so jobs are released before the failure propagates 
+    jmp_buf bail;
+    jmp_buf *outer = b_ctx->bail;
+    b_ctx->bail = &bail;
+    bool failed = setjmp(bail) != 0;
+    if (!failed) decl_batch_merge(&batch, d, f);
+    b_ctx->bail = outer;
+
+    for (size_t i = 0; i < batch.count; i++) decl_batch_release(&batch.jobs[i]);
+    free(batch.jobs);
+    if (failed) compiler_abort();
+}
+
+/**
+ * Pool task: runs the batch work on one function in a worker context, buffering its 
+ * code and messages for decl_batch_merge 
+ * @param   arg     ptr to Decl_batch 
+ * @param   index   function to process 
+ */
+static void decl_batch_job(void *arg, size_t index){
+    Decl_batch *batch = arg;
+    Decl_job *job = &batch->jobs[index];
+    Compiler *worker = compiler_fork(batch->unit);
+    FILE *code = open_memstream(&job->code, &job->code_size);
+    worker->out = open_memstream(&job->out, &job->out_size);
+    worker->err = open_memstream(&job->err, &job->err_size);
+    if (!code || !worker->out || !worker->err){
+        fprintf(stderr, "Fatal Error: unable to buffer output for '%s'\n", job->decl->name);
+        exit(EXIT_FAILURE);
+    }
+
+    jmp_buf bail;
+    worker->bail = &bail;
+    Compiler *prev = compiler_bind(worker);
+    if (!setjmp(bail)){
+        batch->work(job->decl, code);
+    } else {
+        job->failed = true;
+    }
+    compiler_bind(prev);
+
+    fclose(code);
+    fclose(worker->out);
+    fclose(worker->err);
+    worker->out = worker->err = NULL;
+    worker->bail = NULL;
+    job->worker = worker;
+}
+
+/**
+ * Walks the decl list in source order: runs the batch merge for each decl, then 
+ * copies a function's buffered code and messages out and joins its worker. 
+ * @param   batch   finished batch 
+ * @param   d       global decl list 
+ * @param   f       file pointer to write buffered code to (may be NULL)
+ */
+static void decl_batch_merge(Decl_batch *batch, Decl *d, FILE *f){
+    Decl_job *job = batch->jobs;
+    for (Decl *curr = d; curr; curr = curr->next){
+        if (curr->type->kind != TYPE_FUNCTION){
+            batch->merge(curr, NULL, f);
+            continue;
+        }
+
+        batch->merge(curr, job, f);
+        if (f) fwrite(job->code, 1, job->code_size, f);
+        fwrite(job->out, 1, job->out_size, b_ctx->out);
+        fwrite(job->err, 1, job->err_size, b_ctx->err);
+        bool failed = job->failed;
+        decl_batch_release(job++);
+        if (failed) compiler_abort();
+    }
+}
+
+/**
+ * Joins a job's worker into the unit and frees its buffers 
+ * @param   job     job to release (ignored if already released)
+ */
+static void decl_batch_release(Decl_job *job){
+    if (!job->worker) return;
+    compiler_join(b_ctx, job->worker);
+    job->worker = NULL;
+    free(job->code);
+    free(job->out);
+    free(job->err);
+}
@@ -4,6 +4,7 @@
 #define DECL_H
 
 #include <stdio.h>
+#include <stdint.h>
 
 /* Forward declaration */
 
@@ -24,25 +25,29 @@ extern const char *double_args[MAX_DOUBLE_ARGS];
 typedef struct Decl Decl;
 
 struct Decl {
-	char *name;			// name of declaration 
+	const char *name;	// name of declaration (interned) 
 	Type *type;			// data type of decl 
 	Expr *value;		// associated value of decl
 	Stmt *code; 		// code associated with decl (funcs)
 	Symbol *symbol;     // include constants, vars, and funcs 
 	Decl *next;			// next decl (ptr)
-	int owner;			// flag for whose owner of the symbol 
 	int local;			// count of local params 
+	uint64_t fingerprint; // everything its code depends on (0 -> not fingerprinted)
 };
 
 /* Functions */
 
 Decl    *decl_create(const char *name, Type *type, Expr *value, Stmt *code, Decl *next);
-void	 decl_destroy(Decl *d);
 void 	 decl_print(Decl *d, int indent);
 Decl	*decl_copy(Decl *d);
 void     decl_resolve(Decl *d);
+void     decl_reachability(Decl *d);
+void     decl_mark_reachable(Decl *d);
+void     decl_intern_strings(Decl *d);
 void 	 decl_typecheck(Decl *d);
+void     decl_typecheck_program(Decl *d);
 void 	 decl_codegen(Decl *d, FILE *f);
+void     decl_codegen_program(Decl *d, FILE *f);
 
 #endif
 
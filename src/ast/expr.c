@@ -9,10 +9,13 @@
 #include "type.h"
 #include "encoder.h"
 #include "scope.h"
+#include "intern.h"
 #include "utils.h"
 #include "scratch.h"
 #include "label.h"
 #include "str_lit.h"
+#include "loop.h"
+#include "fingerprint.h"
 #include "utils.h"
 
 #include <stdio.h>
@@ -73,6 +76,7 @@ static const int expr_precedence[EXPR_COUNT] = {
 /* Forward declaration of static prototypes */
 
 static Expr *expr_unwrap_groups(Expr *e);
+static Symbol *expr_lvalue_symbol(Expr *e);
 static int 	expr_need_parens(Expr *parent, Expr *child, int is_left);
 static void expr_print_with_context(Expr *parent, Expr *child, int is_left, FILE *stream);
 static bool expr_valid_numeric_op(Type *lt, Type *rt);
@@ -84,7 +88,7 @@ static Type *expr_typecheck_logical_binary_op(Expr *e, Type *lt, Type *rt);
 static Type *expr_typecheck_logical_not(Expr *e, Type *lt);
 static Type *expr_typecheck_equality_op(Expr *e, Type *lt, Type *rt);
 static Type *expr_typecheck_comparison_op(Expr *e, Type *lt, Type *rt);
-static Type *expr_typecheck_array_length(Expr *e, Type *lt);
+static Type *expr_typecheck_array_length(Type *lt);
 static Type *expr_typecheck_function(Expr *e, Type *lt, Type *rt);
 static Type *expr_typecheck_array_index(Type *lt, Type *rt);
 static void expr_typecheck_non_array_nested_braces(Expr *e);
@@ -100,6 +104,7 @@ static void expr_codegen_comparison(Expr *e, FILE *f, const char *opcode);
 static void expr_codegen_string_cmp(Expr *e, FILE *f, const char *opcode);
 static void expr_codegen_not(Expr *e, FILE *f);
 static void expr_codegen_func(Expr *e, FILE *f);
+static int  expr_codegen_call(const char *name, Expr *args, bool evaluated, int result, FILE *f);
 static void expr_codegen_index(Expr *e, FILE *f);
 static void expr_codegen_literals(Expr *e, FILE *f);
 static void expr_codegen_ident(Expr *e, FILE *f);
@@ -114,46 +119,22 @@ static void expr_codegen_ident(Expr *e, FILE *f);
  * @return Pointer to the newly created Expr structure
  **/
 Expr* expr_create(expr_t kind, Expr *left, Expr *right){
-    Expr *expr = safe_calloc(sizeof(Expr), 1);
+    Expr *expr = arena_calloc(b_ctx->arena, sizeof(Expr));
 	expr->kind = kind;
 	expr->left = left;
 	expr->right = right;
 	return expr;
 }
 
-/** Frees the Expr struct 
- * @param e pointer to the Expr struct 
- */
-void expr_destroy(Expr *e){
-	if (!e) return;
-
-	Expr *left = e->left;
-	Expr *right = e->right;
-	if (e->name) {
-		free(e->name);
-		e->name = NULL;
-	}
-
-	if (e->string_literal) {
-		free(e->string_literal);
-		e->string_literal = NULL;
-	}
-	e->left = e->right = NULL;
-
-	free(e);
-	expr_destroy(left);
-	expr_destroy(right);
-}
-
 /**
  * Creates a name/identifier expression node.
  * @param    n          The identifier name
  * @return Pointer to the newly created Expr structure
  **/
 Expr* expr_create_name(const char *n){
-	Expr* expr_name = safe_calloc(sizeof(Expr), 1);
+	Expr* expr_name = arena_calloc(b_ctx->arena, sizeof(Expr));
 	expr_name->kind = EXPR_IDENT;
-	expr_name->name = safe_strdup(n);
+	expr_name->name = intern(&b_ctx->names, n);
 	return expr_name;
 }
 
@@ -163,7 +144,7 @@ Expr* expr_create_name(const char *n){
  * @return Pointer to the newly created Expr structure
  **/
 Expr* expr_create_integer_literal(int c){
-	Expr* expr_int_lit = safe_calloc(sizeof(Expr), 1);
+	Expr* expr_int_lit = arena_calloc(b_ctx->arena, sizeof(Expr));
 	expr_int_lit->kind = EXPR_INT_LIT;
 	expr_int_lit->literal_value = c;
 	return expr_int_lit;
@@ -176,7 +157,7 @@ Expr* expr_create_integer_literal(int c){
  * @return Pointer to the newly created Expr structure
  **/
 Expr* expr_create_boolean_literal(int c){
-	Expr* expr_bool_lit = safe_calloc(sizeof(Expr), 1);
+	Expr* expr_bool_lit = arena_calloc(b_ctx->arena, sizeof(Expr));
 	expr_bool_lit->kind = EXPR_BOOL_LIT;
 	expr_bool_lit->literal_value = c;
 	return expr_bool_lit;
@@ -188,9 +169,9 @@ Expr* expr_create_boolean_literal(int c){
  * @return Pointer to the newly created Expr structure
  **/
 Expr* expr_create_char_literal(char *c){
-	Expr* expr_char_lit = safe_calloc(sizeof(Expr), 1);
+	Expr* expr_char_lit = arena_calloc(b_ctx->arena, sizeof(Expr));
 	expr_char_lit->kind = EXPR_CHAR_LIT;
-	expr_char_lit->string_literal = safe_strdup(c);
+	expr_char_lit->string_literal = c;
 	expr_char_lit->literal_value = (int)*c;
 	return expr_char_lit;
 }
@@ -201,7 +182,7 @@ Expr* expr_create_char_literal(char *c){
  * @return Pointer to the newly created Expr structure
  **/
 Expr*	expr_create_double_literal(double c){
-	Expr* expr_double_lit = safe_calloc(sizeof(Expr), 1);
+	Expr* expr_double_lit = arena_calloc(b_ctx->arena, sizeof(Expr));
 	expr_double_lit->kind = EXPR_DOUBLE_LIT;
 	expr_double_lit->double_literal_value = c;
 	return expr_double_lit;
@@ -213,9 +194,9 @@ Expr*	expr_create_double_literal(double c){
  * @return Pointer to the newly created Expr structure
  */
 Expr* expr_create_string_literal(const char *str){
-	Expr* expr_str_lit = safe_calloc(sizeof(Expr), 1);
+	Expr* expr_str_lit = arena_calloc(b_ctx->arena, sizeof(Expr));
 	expr_str_lit->kind = EXPR_STR_LIT;
-	expr_str_lit->string_literal= safe_strdup(str);
+	expr_str_lit->string_literal = str;
 	return expr_str_lit;
 }
 
@@ -234,6 +215,28 @@ static Expr *expr_unwrap_groups(Expr *e){
 	return e;
 }
 
+/**
+ * Returns the variable an lvalue names, looking through a[i] as long as every
+ * subscript lands on an array level of the variable's declared type
+ * @param 	e		lvalue expression (identifier or index)
+ * @return 	symbol of the variable, otherwise NULL
+ */
+static Symbol *expr_lvalue_symbol(Expr *e){
+	int depth = 0;
+	while (e && e->kind == EXPR_INDEX){
+		e = e->left;
+		depth++;
+	}
+	if (!e || e->kind != EXPR_IDENT || !e->symbol) return NULL;
+
+	Type *t = e->symbol->type;
+	while (depth-- > 0){
+		if (!t || (t->kind != TYPE_ARRAY && t->kind != TYPE_CARRAY)) return NULL;
+		t = t->subtype;
+	}
+	return e->symbol;
+}
+
 /**
  * Checks if the child needs parenthesis based on precedence or associativity  
  * @param Parent 	ptr of parent or root of the child, holds the operation we are trying to check if child needs parenthesis 
@@ -477,8 +480,8 @@ void expr_print(Expr *e, FILE *stream){
 			fprintf(stream, "%s", e->name);
 			break;
 		default:						//  if not defined identifier then error 
-			fprintf(stderr, "Invalid Expression type\n");
-			exit(1);
+			fprintf(b_ctx->err, "Invalid Expression type\n");
+			compiler_abort();
 	}
 
 }
@@ -491,10 +494,8 @@ void expr_print(Expr *e, FILE *stream){
 Expr* expr_copy(Expr *e){
     if (!e) return NULL;
     Expr* new_e = expr_create(e->kind, expr_copy(e->left), expr_copy(e->right));
-	new_e->name = e->name ? safe_strdup(e->name) : NULL;
+	new_e->name = e->name;			// copies whichever payload member is active 
 	new_e->literal_value = e->literal_value;
-	new_e->double_literal_value = e->double_literal_value;
-	new_e->string_literal = e->string_literal ? safe_strdup(e->string_literal) : NULL;
 	return new_e;
 }
 
@@ -508,13 +509,13 @@ void expr_resolve(Expr *e){
         e->symbol = scope_lookup(e->name);
         if (e->symbol){
             if (e->symbol->kind == SYMBOL_GLOBAL){
-                printf("resolver: %s resolves to %s %s\n", e->name, sym_to_str[e->symbol->kind], e->symbol->name);
+                fprintf(b_ctx->out, "resolver: %s resolves to %s %s\n", e->name, sym_to_str[e->symbol->kind], e->symbol->name);
             } else {
-                printf("resolver: %s resolves to %s %d\n", e->name, sym_to_str[e->symbol->kind], e->symbol->which);            
+                fprintf(b_ctx->out, "resolver: %s resolves to %s %d\n", e->name, sym_to_str[e->symbol->kind], e->symbol->which);            
             }
         } else {
-            printf("resolver error: %s is not defined\n", e->name);
-            b_ctx.resolver_errors += 1;
+            fprintf(b_ctx->out, "resolver error: %s is not defined\n", e->name);
+            b_ctx->resolver_errors += 1;
         }
     } else {
         expr_resolve(e->left);
@@ -522,6 +523,110 @@ void expr_resolve(Expr *e){
     }
 }
 
+/**
+ * Marks every global symbol referenced by the expression as reachable, following 
+ * newly reached globals into their definitions (function bodies and initializers)
+ * @param   e       Expression structure to walk 
+ **/
+void expr_mark_reachable(Expr *e){
+	if (!e) return;
+	if (e->kind == EXPR_IDENT){
+		Symbol *sym = e->symbol;
+		if (sym && sym->kind == SYMBOL_GLOBAL && !sym->reachable){
+			sym->reachable = 1;
+			decl_mark_reachable(sym->def);
+		}
+		return;
+	}
+	expr_mark_reachable(e->left);
+	expr_mark_reachable(e->right);
+}
+
+/**
+ * Interns every string literal in the expression, left to right, so they get their 
+ * labels before functions are generated in parallel 
+ * @param   e       Expression structure to walk 
+ **/
+void expr_intern_strings(Expr *e){
+	if (!e) return;
+	if (e->kind == EXPR_STR_LIT){
+		string_intern(e->string_literal);
+		return;
+	}
+	expr_intern_strings(e->left);
+	expr_intern_strings(e->right);
+}
+
+/**
+ * Fingerprints a symbol an expression refers to. Globals are declared elsewhere, so 
+ * their signature, string label, and (for functions) side-effect summary are included.
+ * @param   sym     Symbol to fingerprint (NULL allowed)
+ * @param   hash    fingerprint so far 
+ * @return  fingerprint including the symbol 
+ **/
+static uint64_t expr_fingerprint_symbol(Symbol *sym, uint64_t hash){
+	if (!sym) return fingerprint_int(hash, -1);
+	hash = fingerprint_int(hash, sym->kind);
+	hash = fingerprint_int(hash, sym->which);
+	if (sym->kind != SYMBOL_GLOBAL) return hash;
+
+	hash = type_fingerprint(sym->type, hash);
+	if (sym->str_lit) hash = fingerprint_string(hash, sym->str_lit->label);
+	if (sym->type && sym->type->kind == TYPE_FUNCTION) hash = loop_summary_fingerprint(sym, hash);
+	return hash;
+}
+
+/**
+ * Fingerprints everything the code of an expression depends on: its normalized tree 
+ * (kinds, names, literals, resolved types), the symbols it uses, and the labels of its 
+ * string literals (numbered across the unit). Strings must be interned already.
+ * @param   e       Expression structure to walk 
+ * @param   hash    fingerprint so far 
+ * @return  fingerprint including the expression 
+ **/
+uint64_t expr_fingerprint(Expr *e, uint64_t hash){
+	if (!e) return fingerprint_int(hash, -1);
+	hash = fingerprint_int(hash, e->kind);
+	hash = fingerprint_int(hash, e->literal_value);
+	hash = fingerprint_int(hash, e->type ? (long)e->type->kind : -1);
+	switch (e->kind){
+		case EXPR_IDENT:
+			hash = fingerprint_string(hash, e->name);
+			break;
+		case EXPR_CHAR_LIT:
+			hash = fingerprint_string(hash, e->string_literal);
+			break;
+		case EXPR_STR_LIT:
+			hash = fingerprint_string(hash, e->string_literal);
+			hash = fingerprint_string(hash, string_intern(e->string_literal)->label);
+			break;
+		case EXPR_DOUBLE_LIT:
+		case EXPR_DOUBLE_SCIENTIFIC_LIT:
+			hash = fingerprint_bytes(hash, &e->double_literal_value, sizeof(e->double_literal_value));
+			break;
+		default:
+			break;
+	}
+	hash = expr_fingerprint_symbol(e->symbol, hash);
+	hash = expr_fingerprint(e->left, hash);
+	return expr_fingerprint(e->right, hash);
+}
+
+/**
+ * Checks if the expression assigns to a global string. Codegen follows the literal a 
+ * string variable holds in source order, so such functions cannot be generated apart.
+ * @param   e       Expression structure to walk 
+ * @return  true if a global string is assigned, otherwise false 
+ **/
+bool expr_assigns_global_string(Expr *e){
+	if (!e) return false;
+	if (e->kind == EXPR_ASSIGN && e->left->kind == EXPR_IDENT && e->left->symbol &&
+		e->left->symbol->kind == SYMBOL_GLOBAL && e->left->symbol->type->kind == TYPE_STRING){
+		return true;
+	}
+	return expr_assigns_global_string(e->left) || expr_assigns_global_string(e->right);
+}
+
 /**
  * Check if both operand types are numeric types (integer or double).
  * @param   lt      left-hand operand type
@@ -556,21 +661,20 @@ static Type *expr_typecheck_arithmetic_op(Expr *e, Type *lt, Type *rt){
 	bool valid = expr_valid_numeric_op(lt, rt);
 
 	if (!valid || ((valid && e->kind == EXPR_REM && lt->kind == TYPE_DOUBLE && rt->kind == TYPE_DOUBLE))){
-		fprintf(stderr, "typechecker error: Invalid operand types for '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "' operator. Got");
-		type_print(lt, stderr);
-		fprintf(stderr, " and");
-		type_print(rt, stderr);
+		fprintf(b_ctx->err, "typechecker error: Invalid operand types for '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "' operator. Got");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, " and");
+		type_print(rt, b_ctx->err);
 		if (e->kind == EXPR_REM){
-			fprintf(stderr, " but expected either (integer, integer).\n");
+			fprintf(b_ctx->err, " but expected either (integer, integer).\n");
 		} else {
-			fprintf(stderr, " but expected either (integer, integer) or (double, double).\n");
+			fprintf(b_ctx->err, " but expected either (integer, integer) or (double, double).\n");
 		}
-		b_ctx.typechecker_errors++;
+		b_ctx->typechecker_errors++;
 	}
-	expr_destroy(dummy_e);
-	return type_create(valid ? lt->kind : TYPE_INTEGER, 0, 0, 0);
+	return type_basic(valid ? lt->kind : TYPE_INTEGER);
 }
 
 /**
@@ -584,15 +688,14 @@ static Type *expr_typecheck_unary_numeric_op(Expr *e, Type *lt){
 	bool valid = expr_is_numeric_type(lt);
 
 	if (!valid){
-		fprintf(stderr, "typechecker error: Invalid operand type for '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "' operator. Got");
-		type_print(lt, stderr);
-		fprintf(stderr, " but expected either (integer) or (double).\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Invalid operand type for '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "' operator. Got");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, " but expected either (integer) or (double).\n");
+		b_ctx->typechecker_errors++;
 	}
-	expr_destroy(dummy_e);
-	return type_create(valid ? lt->kind : TYPE_INTEGER, 0, 0, 0);
+	return type_basic(valid ? lt->kind : TYPE_INTEGER);
 }
 
 /**
@@ -604,6 +707,8 @@ static Type *expr_typecheck_unary_numeric_op(Expr *e, Type *lt){
  */
 static Type *expr_typecheck_assignment(Expr *e, Type *lt, Type *rt){
 	Expr *dummy_e = expr_create(e->kind, 0, 0);
+	Symbol *sym = expr_lvalue_symbol(e->left);
+	type_t kind = lt->kind;
 	// case 1: check for auto subtype on the left assigned array on the right 
 	if ((lt->kind == TYPE_ARRAY && rt->kind == TYPE_ARRAY) || (lt->kind == TYPE_CARRAY || rt->kind == TYPE_CARRAY)){
 		// case 1a: check if array types are same and that left subtype is auto
@@ -615,15 +720,15 @@ static Type *expr_typecheck_assignment(Expr *e, Type *lt, Type *rt){
 		
 			// case 1a-1: check if right subtype is auto 
 			if (copy_type->kind == TYPE_AUTO){
-				fprintf(stderr, "typechecker error: Cannot infer operand types for operator '");
-				expr_print(dummy_e, stderr);
-				fprintf(stderr, "': both operands base types are 'auto'\n");	
-				b_ctx.typechecker_errors++;
+				fprintf(b_ctx->err, "typechecker error: Cannot infer operand types for operator '");
+				expr_print(dummy_e, b_ctx->err);
+				fprintf(b_ctx->err, "': both operands base types are 'auto'\n");	
+				b_ctx->typechecker_errors++;
 			// case 1a-2: valid type assign right array to left array
 			} else {
 				copy_type = rt;
-				type_print(copy_type, stdout); printf("\n");
-				Type *base_type = lt->symbol->type;
+				type_print(copy_type, b_ctx->out); fprintf(b_ctx->out, "\n");
+				Type *base_type = sym->type;
 				Type *dummy_t = lt;
 				// get correct base of the right subtype 
 				while (dummy_t->subtype){
@@ -635,72 +740,66 @@ static Type *expr_typecheck_assignment(Expr *e, Type *lt, Type *rt){
 					base_type = base_type->subtype;
 				}
 				// assign and finish
-				type_print(copy_type, stdout); printf("\n");
-				type_destroy(base_type->subtype);
+				type_print(copy_type, b_ctx->out); fprintf(b_ctx->out, "\n");
 				base_type->subtype = type_copy(copy_type);	
-				fprintf(stdout, "typechecker resolved: Variable '%s' type set to (", lt->symbol->name);
-				type_print(rt, stdout);
-				fprintf(stdout, " )\n");
+				fprintf(b_ctx->out, "typechecker resolved: Variable '%s' type set to (", sym->name);
+				type_print(rt, b_ctx->out);
+				fprintf(b_ctx->out, " )\n");
 			}
 
-			expr_destroy(dummy_e);
-			return type_create(lt->kind, 0, 0, 0);
+			return type_basic(kind);
 		}
 	}
 
 	// case 2: check left side is identifier or index 
     if (e->left->kind != EXPR_IDENT && e->left->kind != EXPR_INDEX) {
-        fprintf(stderr, "typechecker error: Cannot assign to non-lvalue (");
-        expr_print(e->left, stderr);
-        fprintf(stderr, ")\n");
-        b_ctx.typechecker_errors++;
-        expr_destroy(dummy_e);
-        return type_create(TYPE_INTEGER, 0, 0, 0);
+        fprintf(b_ctx->err, "typechecker error: Cannot assign to non-lvalue (");
+        expr_print(e->left, b_ctx->err);
+        fprintf(b_ctx->err, ")\n");
+        b_ctx->typechecker_errors++;
+        return type_basic(TYPE_INTEGER);
 	// case 3: both assignments are auto, can't infer type
     } else if (lt->kind == TYPE_AUTO && rt->kind == TYPE_AUTO){
-		fprintf(stderr, "typechecker error: Cannot infer operand types for operator '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "': both operands are 'auto'\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Cannot infer operand types for operator '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "': both operands are 'auto'\n");
+		b_ctx->typechecker_errors++;
 	// case 4: left child is auto, assign right type to left child
 	} else if (lt->kind == TYPE_AUTO && rt) { 
-		if (lt->symbol){
-			lt->kind = rt->kind;
+		if (sym){
+			kind = rt->kind;
 			// case 4a: child is array -> traverse array type and set base type to rt
-			if (lt->symbol->type->kind == TYPE_ARRAY || lt->symbol->type->kind == TYPE_CARRAY){
+			if (sym->type->kind == TYPE_ARRAY || sym->type->kind == TYPE_CARRAY){
 				// get array type (e.g array [5] integer -> arr_type = ptr to integer)
-				Type *base_type = lt->symbol->type;
+				Type *base_type = sym->type;
 				while (base_type && base_type->subtype && base_type->subtype->subtype){
 					base_type = base_type->subtype;
 				}
-				type_destroy(base_type->subtype);
 				base_type->subtype = type_copy(rt);
 			// case 4b: child is just auto, set the type
 			} else {
-				type_destroy(lt->symbol->type);
-				lt->symbol->type = type_copy(rt);
+				sym->type = type_copy(rt);
 			}
-			fprintf(stdout, "typechecker resolved: Variable '%s' type set to (", lt->symbol->name);
-			type_print(rt, stdout);
-			fprintf(stdout, " )\n");
+			fprintf(b_ctx->out, "typechecker resolved: Variable '%s' type set to (", sym->name);
+			type_print(rt, b_ctx->out);
+			fprintf(b_ctx->out, " )\n");
 		}
 	// case 5: the types don't match -> throw error
 	} else if (!type_equals(lt, rt)){
-		fprintf(stderr, "typechecker error: Invalid operand type for '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "' operator. Got");
-		type_print(lt, stderr);
-		fprintf(stderr, " and");
-		type_print(rt, stderr);
-		fprintf(stderr, " but expected (");
-		type_print(lt, stderr);
-		fprintf(stderr, ",");
-		type_print(lt, stderr);
-		fprintf(stderr,").\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Invalid operand type for '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "' operator. Got");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, " and");
+		type_print(rt, b_ctx->err);
+		fprintf(b_ctx->err, " but expected (");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, ",");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err,").\n");
+		b_ctx->typechecker_errors++;
 	}
-	expr_destroy(dummy_e);
-	return type_create(lt->kind, 0, 0, 0);
+	return type_basic(kind);
 }
 
 /**
@@ -713,17 +812,16 @@ static Type *expr_typecheck_assignment(Expr *e, Type *lt, Type *rt){
 static Type *expr_typecheck_logical_binary_op(Expr *e, Type *lt, Type *rt){
 	Expr *dummy_e = expr_create(e->kind, 0, 0);
 	if (lt->kind != TYPE_BOOLEAN || rt->kind != TYPE_BOOLEAN){
-		fprintf(stderr, "typechecker error: Invalid operand types for '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "' operator. Got");
-		type_print(lt, stderr);
-		fprintf(stderr, " and");
-		type_print(rt, stderr);
-		fprintf(stderr, " but expected (boolean).\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Invalid operand types for '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "' operator. Got");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, " and");
+		type_print(rt, b_ctx->err);
+		fprintf(b_ctx->err, " but expected (boolean).\n");
+		b_ctx->typechecker_errors++;
 	}
-	expr_destroy(dummy_e);
-	return type_create(TYPE_BOOLEAN, 0, 0, 0);
+	return type_basic(TYPE_BOOLEAN);
 }
 
 /**
@@ -735,15 +833,14 @@ static Type *expr_typecheck_logical_binary_op(Expr *e, Type *lt, Type *rt){
 static Type *expr_typecheck_logical_not(Expr *e, Type *lt){
 	Expr *dummy_e = expr_create(e->kind, 0, 0);
 	if (lt->kind != TYPE_BOOLEAN){
-		fprintf(stderr, "typechecker error: Invalid operand type for '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "' operator. Got");
-		type_print(lt, stderr);
-		fprintf(stderr, " but expected (boolean).\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Invalid operand type for '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "' operator. Got");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, " but expected (boolean).\n");
+		b_ctx->typechecker_errors++;
 	}
-	expr_destroy(dummy_e);
-	return type_create(TYPE_BOOLEAN, 0, 0, 0);
+	return type_basic(TYPE_BOOLEAN);
 }
 
 /**
@@ -757,17 +854,16 @@ static Type *expr_typecheck_equality_op(Expr *e, Type *lt, Type *rt){
 	Expr *dummy_e = expr_create(e->kind, 0, 0);
 	if (ILLEGAL_KIND_EQUALITY(lt->kind) || ILLEGAL_KIND_EQUALITY(rt->kind) ||
 		(lt->kind != rt->kind)){
-		fprintf(stderr, "type error: invalid types for equality operator '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "'. Left is '");
-		type_print(lt, stderr);
-		fprintf(stderr,"', right is '");
-		type_print(rt, stderr);
-		fprintf(stderr, "'. Equality requires matching types and cannot be applied to void, array, or function types.\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "type error: invalid types for equality operator '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "'. Left is '");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err,"', right is '");
+		type_print(rt, b_ctx->err);
+		fprintf(b_ctx->err, "'. Equality requires matching types and cannot be applied to void, array, or function types.\n");
+		b_ctx->typechecker_errors++;
 	} 
-	expr_destroy(dummy_e);
-	return type_create(TYPE_BOOLEAN, 0, 0, 0);
+	return type_basic(TYPE_BOOLEAN);
 }
 
 /**
@@ -781,35 +877,31 @@ static Type *expr_typecheck_comparison_op(Expr *e, Type *lt, Type *rt){
 	Expr *dummy_e = expr_create(e->kind, 0, 0);
 	bool valid = expr_valid_numeric_op(lt, rt);
 	if (!valid){
-		fprintf(stderr, "typechecker error: Invalid operand types for '");
-		expr_print(dummy_e, stderr);
-		fprintf(stderr, "' operator. Got");
-		type_print(lt, stderr);
-		fprintf(stderr, " and");
-		type_print(rt, stderr);
-		fprintf(stderr, ". Expected either (integer, integer) or (double, double).\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Invalid operand types for '");
+		expr_print(dummy_e, b_ctx->err);
+		fprintf(b_ctx->err, "' operator. Got");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, " and");
+		type_print(rt, b_ctx->err);
+		fprintf(b_ctx->err, ". Expected either (integer, integer) or (double, double).\n");
+		b_ctx->typechecker_errors++;
 	}
-	expr_destroy(dummy_e);
-	return type_create(TYPE_BOOLEAN, 0, 0, 0);
+	return type_basic(TYPE_BOOLEAN);
 }
 
 /**
  * Typecheck array length operator (#), requiring array operand.
- * @param   e       expression node representing length operator
  * @param   lt      operand type
  * @return  integer type
  */
-static Type *expr_typecheck_array_length(Expr *e, Type *lt){
-	Expr *dummy_e = expr_create(e->kind, 0, 0);
+static Type *expr_typecheck_array_length(Type *lt){
 	if (lt->kind != TYPE_ARRAY){
-		fprintf(stderr, "typechecker error: '#' operator requires an array, but got");
-		type_print(lt, stderr);
-		fprintf(stderr, ".\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: '#' operator requires an array, but got");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, ".\n");
+		b_ctx->typechecker_errors++;
 	}
-	expr_destroy(dummy_e);
-	return type_create(TYPE_INTEGER, 0, 0, 0);
+	return type_basic(TYPE_INTEGER);
 }
 
 /**
@@ -817,24 +909,22 @@ static Type *expr_typecheck_array_length(Expr *e, Type *lt){
  * @param  e   The function-call expression node.
  * @param  lt  The type of the function expression (left side of call).
  * @param  rt  The type of the argument list expression (right side of call).
- * @return  A newly allocated Type representing the function's return type.
+ * @return  A canonical Type representing the function's return type.
  *          Returns TYPE_VOID if a type error is detected.
  */
 static Type *expr_typecheck_function(Expr *e, Type *lt, Type *rt){
 	// Case 1: Calling function on non-function type
 	if (lt->kind != TYPE_FUNCTION){
-		fprintf(stderr, "typechecker error: Attempted to call a value of type");
-        type_print(lt, stderr);
-        fprintf(stderr, " which is not a function.\n");
-        b_ctx.typechecker_errors++;
-		Type *arg_type = NULL;
+		fprintf(b_ctx->err, "typechecker error: Attempted to call a value of type");
+        type_print(lt, b_ctx->err);
+        fprintf(b_ctx->err, " which is not a function.\n");
+        b_ctx->typechecker_errors++;
 		Expr *args = e->right;
 		while (args){
-			arg_type = expr_typecheck(args->left);
-			type_destroy(arg_type);
+			expr_typecheck(args->left);
 			args = args->right;
 		}
-		return type_create(TYPE_VOID, 0, 0, 0);
+		return type_basic(TYPE_VOID);
 	}
 
 	Symbol *func_def = e->left->symbol;
@@ -843,14 +933,13 @@ static Type *expr_typecheck_function(Expr *e, Type *lt, Type *rt){
 	Type *arg_type;
 	Expr *args = e->right;
 	if (!params && rt){
-		fprintf(stderr, "typechecker error: Function '%s' takes no parameters, but arguments were provided.\n", func_def->name);
-        b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Function '%s' takes no parameters, but arguments were provided.\n", func_def->name);
+        b_ctx->typechecker_errors++;
 		while (args){
-			arg_type = expr_typecheck(args->left);
-			type_destroy(arg_type);
+			expr_typecheck(args->left);
 			args = args->right;
 		}
-		return type_create(func_def->type->subtype->kind, 0, 0, 0);
+		return type_basic(func_def->type->subtype->kind);
 	}
 
 	arg_type = NULL;
@@ -861,84 +950,80 @@ static Type *expr_typecheck_function(Expr *e, Type *lt, Type *rt){
 		arg_type = expr_typecheck(args->left);
 		// Case 3a: arg_type is auto, resolve
 		if (arg_type->kind == TYPE_AUTO && arg_type){
-			fprintf(stderr, "typechecker error: Cannot infer auto type from function parameters.\n");
-            b_ctx.typechecker_errors++;
+			fprintf(b_ctx->err, "typechecker error: Cannot infer auto type from function parameters.\n");
+            b_ctx->typechecker_errors++;
 		// Case 3b: params don't match
 		} else if (!type_equals(params->type, arg_type)){
-			fprintf(stderr, "typechecker error: Argument type mismatch in call to '%s'.", func_def->name);
-			fprintf(stderr, "\n\tFunction params\n\t\t");
-			param_list_print(func_def->type->params, stderr);
-			fprintf(stderr, "\n\tExpected for argument %d:\n\t\t", count);
-			fprintf(stderr, " %s:", params->name);
-            type_print(params->type, stderr);
-            fprintf(stderr, "\n\tPassed in for argument %d:\n\t\t", count);
-            type_print(arg_type, stderr);
-            fprintf(stderr, "\n");
-            b_ctx.typechecker_errors++;
+			fprintf(b_ctx->err, "typechecker error: Argument type mismatch in call to '%s'.", func_def->name);
+			fprintf(b_ctx->err, "\n\tFunction params\n\t\t");
+			param_list_print(func_def->type->params, b_ctx->err);
+			fprintf(b_ctx->err, "\n\tExpected for argument %d:\n\t\t", count);
+			fprintf(b_ctx->err, " %s:", params->name);
+            type_print(params->type, b_ctx->err);
+            fprintf(b_ctx->err, "\n\tPassed in for argument %d:\n\t\t", count);
+            type_print(arg_type, b_ctx->err);
+            fprintf(b_ctx->err, "\n");
+            b_ctx->typechecker_errors++;
 		}
 		count++;
-		type_destroy(arg_type);
 		params = params->next;
 		args = args->right;
 	}
 
 	// Case 4a: Function has more Params than arguments passed
 	if (params && !args){
-		fprintf(stderr, "typechecker error: Too few arguments in call to '%s'.", func_def->name);
-		fprintf(stderr, "\n\tFunction params\n\t\t");
-		param_list_print(func_def->type->params, stderr);
-		fprintf(stderr, "\n\tNext Expected Param:\n\t\t");
-		fprintf(stderr, " %s:", params->name);
-		type_print(params->type, stderr);
-		fprintf(stderr, "\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Too few arguments in call to '%s'.", func_def->name);
+		fprintf(b_ctx->err, "\n\tFunction params\n\t\t");
+		param_list_print(func_def->type->params, b_ctx->err);
+		fprintf(b_ctx->err, "\n\tNext Expected Param:\n\t\t");
+		fprintf(b_ctx->err, " %s:", params->name);
+		type_print(params->type, b_ctx->err);
+		fprintf(b_ctx->err, "\n");
+		b_ctx->typechecker_errors++;
 	}
 
 	// Case 4b: Function has more arguments than params in function
 	if (!params && args){
-		fprintf(stderr, "typechecker error: Too many arguments in call to '%s'.\n", func_def->name);
-		fprintf(stderr, "\tExpected Function params\n\t\t");
-		param_list_print(func_def->type->params, stderr);
-		fprintf(stderr, "\n");
-        b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Too many arguments in call to '%s'.\n", func_def->name);
+		fprintf(b_ctx->err, "\tExpected Function params\n\t\t");
+		param_list_print(func_def->type->params, b_ctx->err);
+		fprintf(b_ctx->err, "\n");
+        b_ctx->typechecker_errors++;
 		arg_type = NULL;
 		args = e->right;
 		while (args){
-			arg_type = expr_typecheck(args->left);
-			type_destroy(arg_type);
+			expr_typecheck(args->left);
 			args = args->right;
 		}
 	}
 	
-	return type_create(func_def->type->subtype->kind, 0, 0, 0);
+	return type_basic(func_def->type->subtype->kind);
 }
 
 /**
  * Typecheck array indexing; left operand must be array and index integer.
  * @param   lt      array or carray type to index
  * @param   rt      index expression type
- * @return  copy of array element type, or input type on error
+ * @return  array element type, or input type on error
  */
 static Type *expr_typecheck_array_index(Type *lt, Type *rt){
 	// Case 1: Array index called on array 
 	if (lt->kind == TYPE_ARRAY || lt->kind == TYPE_CARRAY){
 		// Case 1a: Array idx is not integer throw error
 		if (rt->kind != TYPE_INTEGER){
-			fprintf(stderr, "typechecker error: Array index must be of type integer, but got");
-			type_print(rt, stderr);
-			fprintf(stderr, ".\n");
-			b_ctx.typechecker_errors++;
+			fprintf(b_ctx->err, "typechecker error: Array index must be of type integer, but got");
+			type_print(rt, b_ctx->err);
+			fprintf(b_ctx->err, ".\n");
+			b_ctx->typechecker_errors++;
 		}
-		Type *res = type_copy(lt->subtype);
-		res->symbol = lt->symbol;	
-		return res;
+		return lt->subtype;
 	// Case 2: tried to index on non-array type
 	} else {
-		fprintf(stderr, "typechecker error: Cannot index value of type");
-		type_print(lt, stderr);
-		fprintf(stderr, ". Only arrays support indexing.\n");
-		b_ctx.typechecker_errors++;
-		return type_copy(lt);
+		fprintf(b_ctx->err, "typechecker error: Cannot index value of type");
+		type_print(lt, b_ctx->err);
+		fprintf(b_ctx->err, ". Only arrays support indexing.\n");
+		b_ctx->typechecker_errors++;
+		return lt;
 	}	
 }
 
@@ -947,12 +1032,10 @@ static Type *expr_typecheck_array_index(Type *lt, Type *rt){
  * @param 	e		ptr to first EXPR_ARG to iterate over
  */
 static void expr_typecheck_non_array_nested_braces(Expr *e){
-	Type *t = NULL;
 	while (e && e->kind == EXPR_ARGS){
 		// case 1a: left side is literal expression
 		if (e->left && e->left->kind != EXPR_BRACES){
-			t = expr_typecheck(e->left);
-			type_destroy(t);
+			expr_typecheck(e->left);
 		// case 2a: left side is nested brace
 		} else {
 			expr_typecheck_non_array_nested_braces(e->left);
@@ -984,7 +1067,6 @@ static Type *expr_typecheck_infer_auto_array(Expr *e){
 				if (init){
 					element = type_copy(init);
 				}
-				type_destroy(init);
 			}
 		}
 		count++;
@@ -1026,40 +1108,39 @@ static void expr_typecheck_nested_braces(Expr *e, Type *t){
 	while (e && e->kind == EXPR_ARGS){
 		// case 1: left side is identifier -> cannot assign non-constant values in init
 		if (e->left->kind == EXPR_IDENT){
-			fprintf(stderr, "typechecker error: Array '%s' cannot be initialized with non-constant values (%s)\n", symbol->name, e->left->name);
-			b_ctx.typechecker_errors++;
+			fprintf(b_ctx->err, "typechecker error: Array '%s' cannot be initialized with non-constant values (%s)\n", symbol->name, e->left->name);
+			b_ctx->typechecker_errors++;
 		// case 2: left side is literal expression
 		} else if (e->left->kind != EXPR_BRACES){
 			init_t = expr_typecheck(e->left);
 			// case 2b: Initialize type is auto, set new type if valid
 			if (arr_type->kind == TYPE_AUTO && init_t){
 				if (init_t->kind == TYPE_AUTO || init_t->kind == TYPE_FUNCTION || init_t->kind == TYPE_VOID || init_t->kind == TYPE_ARRAY || init_t->kind == TYPE_CARRAY){
-					fprintf(stderr, "typechecker error: Cannot infer array element type from (");
-					type_print(init_t, stderr);
-					fprintf(stderr, " )\n");
-					b_ctx.typechecker_errors++;
+					fprintf(b_ctx->err, "typechecker error: Cannot infer array element type from (");
+					type_print(init_t, b_ctx->err);
+					fprintf(b_ctx->err, " )\n");
+					b_ctx->typechecker_errors++;
 				} else {
 					arr_type->kind = init_t->kind;
-					fprintf(stdout, "typechecker resolved: ( auto ) in array '%s' set to type (", symbol->name);
-					type_print(init_t, stdout);
-					fprintf(stdout, " )\n");
+					fprintf(b_ctx->out, "typechecker resolved: ( auto ) in array '%s' set to type (", symbol->name);
+					type_print(init_t, b_ctx->out);
+					fprintf(b_ctx->out, " )\n");
 				}
 			
 			// case 2b: Initialize type does not match array type 
 			} else if (!type_equals(init_t, arr_type)){
-				fprintf(stderr, "typechecker error: Array '%s' type mismatch expected (", symbol->name);
-				type_print(arr_type, stderr);
-				fprintf(stderr, ") but got (");
-				type_print(init_t, stderr);
-				fprintf(stderr, ")\n");
-				b_ctx.typechecker_errors++;
+				fprintf(b_ctx->err, "typechecker error: Array '%s' type mismatch expected (", symbol->name);
+				type_print(arr_type, b_ctx->err);
+				fprintf(b_ctx->err, ") but got (");
+				type_print(init_t, b_ctx->err);
+				fprintf(b_ctx->err, ")\n");
+				b_ctx->typechecker_errors++;
 			// case 2c: Expected higher dimension array but got literal throw error
 			} else if (curr_lvls){
-				fprintf(stderr, "typechecker error: Array '%s' uses non-initializer for array type\n", symbol->name);
-				b_ctx.typechecker_errors++;
+				fprintf(b_ctx->err, "typechecker error: Array '%s' uses non-initializer for array type\n", symbol->name);
+				b_ctx->typechecker_errors++;
 			}
 			
-			type_destroy(init_t);
 		// case 3: left side is nested brace (EXPR_BRACES)
 		} else {
 			curr_lvls++;	
@@ -1073,7 +1154,6 @@ static void expr_typecheck_nested_braces(Expr *e, Type *t){
 				Type *new_t = type_create(arr_type->kind, 0, 0, expr_create_integer_literal(1));
 				new_t->orig_type = t->orig_type;
 				expr_typecheck_nested_braces(e->left->right, new_t);
-				type_destroy(new_t);
 			}
 		}
 		e = e->right;
@@ -1082,19 +1162,19 @@ static void expr_typecheck_nested_braces(Expr *e, Type *t){
 
 	// Case 1: Number of elements in the array exceeds the amount allocated
 	if (count && count < curr_count){
-		fprintf(stderr, "typechecker error: Array '%s' has too many initializers for array [%d] (expected %d, got %d)\n", symbol->name, count, count, curr_count);
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Array '%s' has too many initializers for array [%d] (expected %d, got %d)\n", symbol->name, count, count, curr_count);
+		b_ctx->typechecker_errors++;
 	// Case 2: Number of elements in the array is short the amount allocated
 	} else if (count && count > curr_count){
-		fprintf(stderr, "typechecker error: Array '%s' not enough initializers for array [%d] (expected %d, got %d)\n", symbol->name, count, count, curr_count);
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Array '%s' not enough initializers for array [%d] (expected %d, got %d)\n", symbol->name, count, count, curr_count);
+		b_ctx->typechecker_errors++;
 	// Case 3: Number of elements is not defined, define it;
 	} else if (!count && t && !t->arr_len) {
 		t->arr_len = expr_create_integer_literal(curr_count);
-		fprintf(stdout, "typechecker resolved: Array '%s' set to length %d\n", symbol->name, curr_count);
-		fprintf(stdout, "\tFull type:\n\t\t");
-		type_print(symbol->type, stdout);
-		fprintf(stdout, "\n");
+		fprintf(b_ctx->out, "typechecker resolved: Array '%s' set to length %d\n", symbol->name, curr_count);
+		fprintf(b_ctx->out, "\tFull type:\n\t\t");
+		type_print(symbol->type, b_ctx->out);
+		fprintf(b_ctx->out, "\n");
 	}
 }
 
@@ -1121,7 +1201,7 @@ static Type *expr_typecheck_braces(Expr *e){
 	// case 3: braces init is assigned to array, typecheck initializers + size
 	arr_sym->type->orig_type = arr_sym->type;
 	expr_typecheck_nested_braces(e->right, arr_sym->type);
-	return type_copy(arr_sym->type);
+	return arr_sym->type;
 }
 
 /**
@@ -1134,16 +1214,16 @@ static Type *expr_typecheck_literal(expr_t Kind){
 		case EXPR_INT_LIT:				//  integer literal 21321 
 		case EXPR_HEX_LIT:				//  hexadecimal literal 0x2123
 		case EXPR_BIN_LIT:				//  binary literal 0b1010
-			return type_create(TYPE_INTEGER, 0, 0, 0);
+			return type_basic(TYPE_INTEGER);
 		case EXPR_DOUBLE_LIT:			//  double literal 123131 
 		case EXPR_DOUBLE_SCIENTIFIC_LIT://  double scientific literal 6e10 
-			return type_create(TYPE_DOUBLE, 0, 0, 0);
+			return type_basic(TYPE_DOUBLE);
 		case EXPR_CHAR_LIT: 			//  char literal 'a'
-			return type_create(TYPE_CHARACTER, 0, 0, 0);
+			return type_basic(TYPE_CHARACTER);
 		case EXPR_STR_LIT:				//  string literal "hello"
-			return type_create(TYPE_STRING, 0, 0, 0);
+			return type_basic(TYPE_STRING);
 		case EXPR_BOOL_LIT:				//  boolean literal 'true' 'false'
-			return type_create(TYPE_BOOLEAN, 0, 0, 0);
+			return type_basic(TYPE_BOOLEAN);
 		default:
 			return NULL;
 	}
@@ -1152,9 +1232,8 @@ static Type *expr_typecheck_literal(expr_t Kind){
 /**
  * Perform semantic type checking on an expression tree node.
  * @param 	e 		 Pointer to the expression node to typecheck.
- * @return  A newly allocated `struct type *` representing the expression’s
- *         resulting type. Caller takes ownership and must free it with
- *         `type_delete()`. Never returns NULL (TYPE_ERROR on failure).
+ * @return  The expression's type, either a canonical type from type_basic or
+ *         the declared type of the symbol it reads. Callers must not modify it.
  */
 Type *expr_typecheck(Expr *e){
 	if (!e) return NULL;
@@ -1198,17 +1277,16 @@ Type *expr_typecheck(Expr *e){
 			result = expr_typecheck_comparison_op(e, lt, rt);
 			break;
 		case EXPR_ARR_LEN:			    //  array len #
-			result = expr_typecheck_array_length(e, lt);
+			result = expr_typecheck_array_length(lt);
 			break;
 		case EXPR_GROUPS:				//  grouping ()
-			result = type_copy(lt);
+			result = lt;
 			break;
 		case EXPR_FUNC:					//  function call f()
 			result = expr_typecheck_function(e, lt, rt);
 			break;
 		case EXPR_ARGS:					//  function arguments a, b, c, d 
-			result = type_copy(lt);
-			result->symbol = lt->symbol;
+			result = lt;
 			break;
 		case EXPR_INDEX:				//  subscripts, indexes a[0] or a[b]
 			result = expr_typecheck_array_index(lt, rt);
@@ -1227,17 +1305,14 @@ Type *expr_typecheck(Expr *e){
 			result = expr_typecheck_literal(e->kind);
 			break;
 		case EXPR_IDENT:				//  identifier    my_function 
-			result = type_copy(e->symbol->type);
-			result->symbol = e->symbol;
+			result = e->symbol->type;
 			break;
 		default:
-			fprintf(stderr, "Invalid Expression type\n");
-			exit(1);
+			fprintf(b_ctx->err, "Invalid Expression type\n");
+			compiler_abort();
 	}
 
-	type_destroy(lt);
-	type_destroy(rt);
-
+	e->type = result;
 	return result;
 }
 
@@ -1308,10 +1383,7 @@ static void expr_codegen_binary_math(Expr *e, FILE *f, const char *opcode){
 								  expr_create(EXPR_ARGS, e->left, \
 								  expr_create(EXPR_ARGS, e->right, NULL)));
 		expr_codegen(dummy_e, f);
-		dummy_e->right->left = NULL;
-		dummy_e->right->right->left = NULL;
 		e->reg = dummy_e->reg;
-		expr_destroy(dummy_e);
 	}
 }
 
@@ -1349,7 +1421,6 @@ static void expr_codegen_unary_operator(Expr *e, FILE *f, const char *opcode){
 		}
 		fprintf(f, "\tMOVQ (%s, %s, 8), %s\n", scratch_name(e->reg), scratch_name(dummy_e->reg), scratch_name(e->reg));
 		scratch_free(dummy_e->reg);
-		expr_destroy(dummy_e);
 	}
 }
 
@@ -1359,19 +1430,26 @@ static void expr_codegen_unary_operator(Expr *e, FILE *f, const char *opcode){
  * @param	f		file ptr to write x86 code for 
  */
 static void expr_codegen_assign(Expr *e, FILE *f){
-	// case 1a: left side is string -> allocated new str_literal for string assignment 
+	// case 1a: left side is string -> literal on the right is interned, otherwise the 
+	// left side takes whatever literal the right side is known to hold 
 	if (e->left->symbol && e->left->symbol->type->kind == TYPE_STRING){
-		int label = string_label_create();
-		e->left->symbol->str_lit = string_alloc(e->right->string_literal, string_label_name(label));
-		e->right->symbol = e->left->symbol;
+		if (e->right->kind == EXPR_STR_LIT){
+			e->left->symbol->str_lit = string_intern(e->right->string_literal);
+			e->right->symbol = e->left->symbol;
+		} else {
+			e->left->symbol->str_lit = e->right->symbol ? e->right->symbol->str_lit : NULL;
+		}
 	} 
 	if (e->left->kind == EXPR_INDEX){
 		expr_codegen(e->left, f);
 		scratch_free(e->left->reg);
 	}
 	expr_codegen(e->right, f);
-	// case 1b: left side is array index -> index into array 
-	if (e->left->kind == EXPR_INDEX){
+	// case 1b: left side is array index through induction pointer 
+	if (e->left->kind == EXPR_INDEX && e->left->strength_reduced){
+		fprintf(f, "\tMOVQ %s, (%s)\n", scratch_name(e->right->reg), scratch_name(e->left->pointer_reg));
+	// case 1c: left side is array index -> index into array 
+	} else if (e->left->kind == EXPR_INDEX){
 		Expr *dummy_e = NULL;
 		dummy_e = e->left;
 		expr_codegen(dummy_e->right, f);
@@ -1386,7 +1464,7 @@ static void expr_codegen_assign(Expr *e, FILE *f){
 		fprintf(f, "\tMOVQ %s, (%s, %s, 8)\n", scratch_name(e->right->reg), scratch_name(dummy_e->reg), scratch_name(dummy_e->right->reg));
 		scratch_free(dummy_e->right->reg);
 		scratch_free(dummy_e->reg);
-	// case 1c: left side is regular type -> alloc value to type
+	// case 1d: left side is regular type -> alloc value to type
 	} else {
 		fprintf(f, "\tMOVQ %s, %s\n", scratch_name(e->right->reg), symbol_codegen(e->left->symbol));
 	}
@@ -1434,17 +1512,33 @@ static void expr_codegen_comparison(Expr *e, FILE *f, const char *opcode){
 }
 
 /** 
- * Handles string comparisons codegen in x86
+ * Handles string comparisons codegen in x86. String literals are interned, so 
+ * identical pointers are checked first and the library call is only made when 
+ * the pointers differ.
  * @param	e		expr node containing string comparison 
  * @param	f		file ptr to write code generation 
  * @param	opcode	str to distinguish which function call to call 
  */
 static void expr_codegen_string_cmp(Expr *e, FILE *f, const char *opcode){
-	Expr *res_e = expr_create(EXPR_FUNC, expr_create_name(opcode), expr_create(EXPR_ARGS, e->left, expr_create(EXPR_ARGS, e->right, 0)));
-	expr_codegen(res_e, f);
-	e->reg = res_e->reg;
-	res_e->right->left = NULL;
-	res_e->right->right->left = NULL;
+	int label_call = label_create();
+	int label_done = label_create();
+	expr_codegen(e->left, f);
+	expr_codegen(e->right, f);
+
+	// fast path: same pointer -> strings are equal 
+	fprintf(f, "\tCMPQ %s, %s\n", scratch_name(e->right->reg), scratch_name(e->left->reg));
+	fprintf(f, "\tJNE %s\n", label_name(label_call));
+	fprintf(f, "\tMOVQ $%d, %s\n", streq(opcode, "str_equal") ? 1 : 0, scratch_name(e->left->reg));
+	fprintf(f, "\tJMP %s\n", label_name(label_done));
+
+	// slow path: call into library to compare contents, result in the same register 
+	fprintf(f, "%s:\n", label_name(label_call));
+	Expr *args = expr_create(EXPR_ARGS, e->left, expr_create(EXPR_ARGS, e->right, NULL));
+	expr_codegen_call(opcode, args, true, e->left->reg, f);
+	fprintf(f, "%s:\n", label_name(label_done));
+
+	e->reg = e->left->reg;
+	scratch_free(e->right->reg);
 }
 
 /**
@@ -1475,33 +1569,44 @@ static void expr_codegen_not(Expr *e, FILE *f){
  * @param	f		file ptr to write x86 code to
  */
 static void expr_codegen_func(Expr *e, FILE *f){
-	Expr *dummy_e = e->right;	
-	Type *dummy_t = NULL;
+	e->reg = expr_codegen_call(e->left->name, e->right, false, -1, f);
+}
+
+/**
+ * Emits a call following the calling convention: saves the argument registers, loads
+ * the arguments into them, saves r10 and r11 around the CALL, restores everything and
+ * copies %rax into the result register. Every call codegen emits goes through here.
+ * @param	name		function to call 
+ * @param	args		EXPR_ARGS list of arguments 
+ * @param	evaluated	arguments already hold their value in ->reg (the caller frees them),
+ * 						otherwise each one is generated and freed as it is loaded 
+ * @param	result		scratch register to leave the return value in (-1 -> a new one)
+ * @param	f			file ptr to write x86 code to
+ * @return	scratch register holding the return value 
+ */
+static int expr_codegen_call(const char *name, Expr *args, bool evaluated, int result, FILE *f){
 	int int_count = 0;
 	for (int i = 0; i < MAX_INT_ARGS; i++){
 		fprintf(f, "\tPUSHQ %s\n", int_args[i]);
 	}
 
-	while (dummy_e){
+	for (Expr *arg = args; arg; arg = arg->right){
 		if (int_count > 6){
-			fprintf(stderr, "codegen error: Does not Function '%s' has more than 6 arguments, functions with more than 6 arguments are not implemented\n", e->left->name);
-			exit(EXIT_FAILURE);
+			fprintf(b_ctx->err, "codegen error: Does not Function '%s' has more than 6 arguments, functions with more than 6 arguments are not implemented\n", name);
+			compiler_abort();
 		}
-		expr_codegen(dummy_e->left, f);
-		dummy_t = expr_typecheck(dummy_e->left);
-		if (dummy_t->kind == TYPE_DOUBLE){
-			fprintf(stderr, "codegen error: double type not supported\n");
-			exit(EXIT_FAILURE);
+		if (!evaluated) expr_codegen(arg->left, f);
+		if (arg->left->type->kind == TYPE_DOUBLE){
+			fprintf(b_ctx->err, "codegen error: double type not supported\n");
+			compiler_abort();
 		}
-		fprintf(f, "\tMOVQ %s, %s\n", scratch_name(dummy_e->left->reg), int_args[int_count++]);
-		scratch_free(dummy_e->left->reg);
-		dummy_e = dummy_e->right;
-		type_destroy(dummy_t);
+		fprintf(f, "\tMOVQ %s, %s\n", scratch_name(arg->left->reg), int_args[int_count++]);
+		if (!evaluated) scratch_free(arg->left->reg);
 	}
 
 	fprintf(f, "\tPUSHQ %%r10\n"
 				"\tPUSHQ %%r11\n"
-				"\tCALL %s\n", e->left->name);
+				"\tCALL %s\n", name);
 	fprintf(f, "\tPOPQ %%r11\n"
 				"\tPOPQ %%r10\n");
 
@@ -1509,9 +1614,10 @@ static void expr_codegen_func(Expr *e, FILE *f){
 		fprintf(f, "\tPOPQ %s\n", int_args[i]);
 	}
 
-	e->reg = scratch_alloc();
-	fprintf(f, "\tMOVQ %%rax, %s\n", scratch_name(e->reg));
+	if (result < 0) result = scratch_alloc();
+	fprintf(f, "\tMOVQ %%rax, %s\n", scratch_name(result));
 	fprintf(f, "\tMOVQ $0, %%rax\n");
+	return result;
 }
 
 /**
@@ -1520,13 +1626,19 @@ static void expr_codegen_func(Expr *e, FILE *f){
  * @param	f		file ptr to write x86 code to 
  */
 static void expr_codegen_index(Expr *e, FILE *f){
-	// check bounds + clean up 
-	Expr *dummy_e = expr_create(EXPR_FUNC, expr_create_name("check_bounds"), expr_create(EXPR_ARGS, e->left, expr_create(EXPR_ARGS, e->right, NULL)));
-	expr_codegen(dummy_e, f);
-	scratch_free(dummy_e->reg);
-	dummy_e->right->left = NULL;
-	dummy_e->right->right->left = NULL;
-	expr_destroy(dummy_e);
+	// check bounds + clean up (skipped when the loop proves the index in bounds)
+	if (!e->in_bounds){
+		Expr *dummy_e = expr_create(EXPR_FUNC, expr_create_name("check_bounds"), expr_create(EXPR_ARGS, e->left, expr_create(EXPR_ARGS, e->right, NULL)));
+		expr_codegen(dummy_e, f);
+		scratch_free(dummy_e->reg);
+	}
+
+	// strength reduced: pointer already addresses a[i] 
+	if (e->strength_reduced){
+		e->reg = scratch_alloc();
+		fprintf(f, "\tMOVQ (%s), %s\n", scratch_name(e->pointer_reg), scratch_name(e->reg));
+		return;
+	}
 
 	expr_codegen(e->right, f);
 	e->reg = scratch_alloc();
@@ -1553,25 +1665,21 @@ static void expr_codegen_index(Expr *e, FILE *f){
  */
 static void expr_codegen_literals(Expr *e, FILE *f){
 	e->reg = scratch_alloc();
-	Type *dummy_t = expr_typecheck(e);
 
 	// case 1: literal is string 
-	if (dummy_t->kind == TYPE_STRING){
+	if (e->kind == EXPR_STR_LIT){
 		// case 1-a: symbol associated with string -> pull str_literal associated with it 
 		if (e->symbol){
 			fprintf(f, "\tMOVQ $%s, %s\n", e->symbol->str_lit->label, scratch_name(e->reg));
-		// case 1-b: string has no symbol;
+		// case 1-b: string has no symbol -> intern literal and use its shared label
 		} else {
-			int label = string_label_create();
-			e->label = string_label_name(label);
-			string_alloc(e->string_literal, e->label);
+			e->label = string_intern(e->string_literal)->label;
 			fprintf(f, "\tMOVQ $%s, %s\n", e->label, scratch_name(e->reg));
 		}
 	// case 2: literal is not string 
 	} else {
 		fprintf(f, "\tMOVQ $%d, %s\n", e->literal_value, scratch_name(e->reg));
 	}
-	type_destroy(dummy_t);
 }
 
 /**
@@ -1598,7 +1706,13 @@ static void expr_codegen_ident(Expr *e, FILE *f){
 void expr_codegen(Expr *e, FILE *f){
 	if (!e || !f) return;
 
-	Type *dummy_t = NULL;
+	// loop invariant: value was computed in the loop preheader 
+	if (e->hoisted){
+		e->reg = scratch_alloc();
+		fprintf(f, "\tMOVQ %s, %s\n", scratch_name(e->hoist_reg), scratch_name(e->reg));
+		return;
+	}
+
 	switch (e->kind){
 		case EXPR_ADD:					//	addition +
 			expr_codegen_binary_math(e, f, "ADDQ");
@@ -1625,22 +1739,18 @@ void expr_codegen(Expr *e, FILE *f){
 			expr_codegen_logic_short_circuit(e, f, 1);
 			break;
 		case EXPR_EQ:					//  comparison equal  ==
-			dummy_t = expr_typecheck(e->left);
-			if (dummy_t->kind == TYPE_STRING){
+			if (e->left->type->kind == TYPE_STRING){
 				expr_codegen_string_cmp(e, f, "str_equal");
 			} else {
 				expr_codegen_comparison(e, f, "JE");
 			}
-			type_destroy(dummy_t);
 			break;
 		case EXPR_NOT_EQ:				//  comparison not equal  !=
-			dummy_t = expr_typecheck(e->left);
-			if (dummy_t->kind == TYPE_STRING){
+			if (e->left->type->kind == TYPE_STRING){
 				expr_codegen_string_cmp(e, f, "str_not_equal");
 			} else {
 				expr_codegen_comparison(e, f, "JNE");
 			}
-			type_destroy(dummy_t);
 			break;
 		case EXPR_LT:					//  comparison less than  <
 			expr_codegen_comparison(e, f, "JL");
@@ -1694,8 +1804,8 @@ void expr_codegen(Expr *e, FILE *f){
 			break;
 		case EXPR_DOUBLE_LIT:			//  double literal 123131 
 		case EXPR_DOUBLE_SCIENTIFIC_LIT://  double scientific literal 6e10 
-			fprintf(stderr, "codegen error: Double type not supported\n");
-			exit(EXIT_FAILURE);
+			fprintf(b_ctx->err, "codegen error: Double type not supported\n");
+			compiler_abort();
 			break;
 		case EXPR_STR_LIT:				//  string literal "hello"
 		case EXPR_INT_LIT:				//  integer literal 21321 
@@ -1709,7 +1819,7 @@ void expr_codegen(Expr *e, FILE *f){
 			expr_codegen_ident(e, f);
 			break;
 		default:
-			fprintf(stderr, "codegen error: Unknown expression type\n");
-			exit(EXIT_FAILURE);
+			fprintf(b_ctx->err, "codegen error: Unknown expression type\n");
+			compiler_abort();
 	}
 }
@@ -4,6 +4,7 @@
 #define EXPR_H
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 /* Forward Declaration */
@@ -53,22 +54,29 @@ typedef enum {
 typedef struct Expr Expr;
 
 struct Expr {
-	expr_t kind;  					// expr kind from above (e.g +)
 	Expr *left;						// left child of expr kind (e.g 5+4, left child is 5)
 	Expr *right;					// right child of expr kind (e.g 5+4, right child is 4)
-	char *name;						// identifier (e.g a[b], a is name)
-	int literal_value;				// literal value (char, int, hex, bin, bool)
-	double double_literal_value;	// double lit val (double & double scientific)
-	char *string_literal;			// string literal 
+	union {							// payload, selected by kind 
+		const char *name;				// EXPR_IDENT: identifier (e.g a[b], a is name), interned
+		const char *string_literal;		// EXPR_STR_LIT, EXPR_CHAR_LIT: decoded text, owned by b_ctx->arena 
+		double double_literal_value;	// EXPR_DOUBLE_LIT, EXPR_DOUBLE_SCIENTIFIC_LIT
+	};
 	Symbol *symbol;					// include const, vars, and funcs 
-	int reg;						// scratch register associated with expr
-	const char *label;						// label associated with expression 
+	Type *type;						// resolved type, recorded by expr_typecheck for codegen
+	const char *label;				// label associated with expression 
+	int literal_value;				// literal value (char, int, hex, bin, bool)
+	expr_t kind : 8;				// expr kind from above (e.g +)
+	int reg : 4;					// scratch register associated with expr
+	int hoist_reg : 4;				// scratch register holding the hoisted value
+	int pointer_reg : 4;			// scratch register holding &a[i]
+	bool hoisted : 1;				// value pinned to hoist_reg by loop-invariant code motion
+	bool strength_reduced : 1;		// a[i] addressed through an induction pointer
+	bool in_bounds : 1;				// index proven in bounds, skip check_bounds
 };
 
 /* Functions */
 
 Expr   *expr_create(expr_t kind, Expr *left, Expr *right);
-void	expr_destroy(Expr *e);
 Expr   *expr_create_name(const char *n);
 Expr   *expr_create_integer_literal(int c);
 Expr   *expr_create_boolean_literal(int c);
@@ -78,6 +86,10 @@ Expr   *expr_create_string_literal(const char *str);
 void 	expr_print(Expr *e, FILE *stream);
 Expr   *expr_copy(Expr *e);
 void    expr_resolve(Expr *e);
+void	expr_mark_reachable(Expr *e);
+void	expr_intern_strings(Expr *e);
+bool	expr_assigns_global_string(Expr *e);
+uint64_t expr_fingerprint(Expr *e, uint64_t hash);
 Type   *expr_typecheck(Expr *e);
 bool	expr_is_literal(expr_t type);
 void	expr_codegen(Expr *e, FILE *f);
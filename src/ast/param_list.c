@@ -8,6 +8,8 @@
 #include "symbol.h"
 #include "type.h"
 #include "scope.h"
+#include "intern.h"
+#include "fingerprint.h"
 #include "utils.h"
 
 #include <stdio.h>
@@ -24,36 +26,13 @@
  * @return Pointer to the newly created Param_list structure
  **/
 Param_list* param_list_create(const char *name, Type *type, Param_list *next){
-	Param_list *param_list = safe_calloc(sizeof(Param_list), 1);
-	param_list->name = safe_strdup(name);
+	Param_list *param_list = arena_calloc(b_ctx->arena, sizeof(Param_list));
+	param_list->name = intern(&b_ctx->names, name);
 	param_list->type = type;
 	param_list->next = next;
 	return param_list;
 }
 
-/**
- * Frees the Param_list struct 
- * @param a pointer to the Param_list struct 
- */
-void param_list_destroy(Param_list *a){
-	if (!a) return;
-	if (a->name) {
-		free(a->name);
-		a->name = NULL;
-	}
-
-	type_destroy(a->type);
-	a->type = NULL;
-	symbol_destroy(a->symbol);
-	a->symbol = NULL;
-
-	Param_list *next = a->next;
-	a->next = NULL;
-	free(a);
-
-	param_list_destroy(next);
-}
-
 /**
  * Prints a parameter list to stdout.
  * @param a The parameter list to print
@@ -93,8 +72,8 @@ void param_list_resolve(Param_list *a){
     a->symbol = symbol_create(SYMBOL_PARAM, a->type, a->name);
     
     if (scope_lookup_current(a->name)){
-        fprintf(stderr, "resolver error: Redeclaring the same parameter Identifier %s\n", a->name);
-		b_ctx.resolver_errors += 1;
+        fprintf(b_ctx->err, "resolver error: Redeclaring the same parameter Identifier %s\n", a->name);
+		b_ctx->resolver_errors += 1;
     } else {
         scope_bind(a->name, a->symbol);    
     }
@@ -125,9 +104,9 @@ bool param_list_equals(Param_list *a, Param_list *b){
 bool param_list_valid_type(Param_list *a){
 	if (!a) return true;
 	if (!a->type){
-		fprintf(stderr, "Param %s is not assigned a type\n", a->name);
+		fprintf(b_ctx->err, "Param %s is not assigned a type\n", a->name);
 		return false;
-		b_ctx.typechecker_errors++;
+		b_ctx->typechecker_errors++;
 	}
 	if (a->type->kind == TYPE_VOID || a->type->kind == TYPE_AUTO || a->type->kind == TYPE_FUNCTION) return false;
 	if (a->type->kind == TYPE_CARRAY || a->type->kind == TYPE_ARRAY){
@@ -139,4 +118,18 @@ bool param_list_valid_type(Param_list *a){
 	}
 	if (!param_list_valid_type(a->next)) return false;
 	return true;
-}
\ No newline at end of file
+}
+
+/**
+ * Fingerprints a parameter list: names and types in order 
+ * @param 	a 		ptr to Param_list structure (NULL allowed)
+ * @param 	hash 	fingerprint so far 
+ * @return 	fingerprint including the parameters 
+ */
+uint64_t param_list_fingerprint(Param_list *a, uint64_t hash){
+	for (; a; a = a->next){
+		hash = fingerprint_string(hash, a->name);
+		hash = type_fingerprint(a->type, hash);
+	}
+	return fingerprint_int(hash, -1);
+}
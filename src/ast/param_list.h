@@ -4,6 +4,7 @@
 #define PARAM_LIST_H
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 /* Forward Declaration */
@@ -16,7 +17,7 @@ typedef struct Symbol Symbol;
 typedef struct Param_list Param_list; 
 
 struct Param_list {
-	char *name;			// identifier of arg
+	const char *name;	// identifier of arg (interned)
 	Type *type;			// data type of arg 
 	Symbol *symbol;		// include consts, vars, and funcs 
 	Param_list *next;	// ptr to next arg
@@ -25,11 +26,11 @@ struct Param_list {
 /* Functions */
 
 Param_list	    *param_list_create(const char *name, Type *type, Param_list *next);
-void			 param_list_destroy(Param_list *a);
 void 			 param_list_print(Param_list *a, FILE *stream);
 Param_list      *param_list_copy(Param_list *a);
 void             param_list_resolve(Param_list *a);
 bool			 param_list_equals(Param_list *a, Param_list *b);
 bool			 param_list_valid_type(Param_list *a);
+uint64_t		 param_list_fingerprint(Param_list *a, uint64_t hash);
 
 #endif
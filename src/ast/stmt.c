@@ -10,6 +10,8 @@
 #include "scope.h"
 #include "label.h"
 #include "scratch.h"
+#include "loop.h"
+#include "fingerprint.h"
 #include "utils.h"
 
 #include <stdio.h>
@@ -23,9 +25,11 @@ static void 	  stmt_typecheck_print(Stmt *s);
 static bool 	  stmt_typecheck_return(Stmt *s);
 static void 	  stmt_codegen_if_else(Stmt *s, FILE *f);
 static void 	  stmt_codegen_for(Stmt *s, FILE *f);
+static void 	  stmt_codegen_for_unrolled(Loop *l, int exit_label, FILE *f);
 static const char *stmt_codegen_get_func_name(Type *t);
 static void  	  stmt_codegen_print(Stmt *s, FILE *f);
 static void 	  stmt_codegen_return(Stmt *s, FILE *f);
+static bool 	  stmt_codegen_returns(Stmt *s);
 
 /* Functions */
 
@@ -42,7 +46,7 @@ static void 	  stmt_codegen_return(Stmt *s, FILE *f);
  * @return Pointer to the newly created Stmt structure
  **/
 Stmt* stmt_create(stmt_t kind, Decl *decl, Expr *init_expr, Expr *expr, Expr *next_expr, Stmt *body, Stmt *else_body, Stmt *next){
-	Stmt *stmt = safe_calloc(sizeof(Stmt), 1);
+	Stmt *stmt = arena_calloc(b_ctx->arena, sizeof(Stmt));
 	stmt->kind = kind;
 	stmt->decl = decl;
 	stmt->init_expr = init_expr;
@@ -54,31 +58,6 @@ Stmt* stmt_create(stmt_t kind, Decl *decl, Expr *init_expr, Expr *expr, Expr *ne
 	return stmt;
 }
 
-/**
- * Frees the Stmt struct 
- * @param s pointer to Stmt struct 
- */
-void stmt_destroy(Stmt *s){
-	if (!s) return;
-	decl_destroy(s->decl);
-	s->decl = NULL;
-	expr_destroy(s->init_expr);
-	s->init_expr = NULL;
-	expr_destroy(s->expr);
-	s->expr = NULL;
-	expr_destroy(s->next_expr);
-	s->next_expr = NULL;
-	stmt_destroy(s->body);
-	s->body = NULL;
-	stmt_destroy(s->else_body);
-	s->else_body = NULL;
-	Stmt *next = s->next;
-	s->next = NULL;
-	free(s);
-
-	stmt_destroy(next);
-}
-
 /**
  * Prints a statement tree to stdout.
  * @param s The statement to print
@@ -92,87 +71,87 @@ void stmt_print(Stmt *s, int indent){
 			break;
 		case STMT_EXPR:
 			print_indent(indent);
-			expr_print(s->expr, stdout);
-			printf(";\n");
+			expr_print(s->expr, b_ctx->out);
+			fprintf(b_ctx->out, ";\n");
 			break;
 		case STMT_IF_ELSE:
 			print_indent(indent);
-			printf("if (");
-			expr_print(s->expr, stdout);
-			printf(") ");
+			fprintf(b_ctx->out, "if (");
+			expr_print(s->expr, b_ctx->out);
+			fprintf(b_ctx->out, ") ");
 			
 			if (s->body && s->body->kind == STMT_BLOCK){
-				printf("{\n");
+				fprintf(b_ctx->out, "{\n");
 				stmt_print(s->body->body, indent + 1);
 				print_indent(indent);
-				putchar('}');
+				fputc('}', b_ctx->out);
 			} else {
-				printf("{\n");
+				fprintf(b_ctx->out, "{\n");
 				stmt_print(s->body, indent + 1);
 				print_indent(indent);
-				putchar('}');
+				fputc('}', b_ctx->out);
 			}
 			
 			if (s->else_body){
-				printf(" else ");
+				fprintf(b_ctx->out, " else ");
 				if (s->else_body->kind == STMT_BLOCK){
-					printf("{\n");
+					fprintf(b_ctx->out, "{\n");
 					stmt_print(s->else_body->body, indent + 1);
 					print_indent(indent);
-					printf("}\n");
+					fprintf(b_ctx->out, "}\n");
 				} else {
-					printf("{\n");
+					fprintf(b_ctx->out, "{\n");
 					stmt_print(s->else_body, indent + 1);
 					print_indent(indent);
-					printf("}\n");
+					fprintf(b_ctx->out, "}\n");
 				}
 			} else {
-				printf("\n");
+				fprintf(b_ctx->out, "\n");
 			}
 			break;
 		case STMT_FOR:
 			print_indent(indent);
-			printf("for (");
-			expr_print(s->init_expr, stdout);
-			putchar(';');
-			expr_print(s->expr, stdout);
-			putchar(';');
-			expr_print(s->next_expr, stdout);
-			printf(")");
+			fprintf(b_ctx->out, "for (");
+			expr_print(s->init_expr, b_ctx->out);
+			fputc(';', b_ctx->out);
+			expr_print(s->expr, b_ctx->out);
+			fputc(';', b_ctx->out);
+			expr_print(s->next_expr, b_ctx->out);
+			fprintf(b_ctx->out, ")");
 			
 			if (s->body && s->body->kind == STMT_BLOCK){
-				printf(" {\n");
+				fprintf(b_ctx->out, " {\n");
 				stmt_print(s->body->body, indent + 1);
 				print_indent(indent);
-				printf("}\n");
+				fprintf(b_ctx->out, "}\n");
 			} else {
-				printf(" {\n");
+				fprintf(b_ctx->out, " {\n");
 				stmt_print(s->body, indent + 1);
 				print_indent(indent);
-				printf("}\n");
+				fprintf(b_ctx->out, "}\n");
 			}
 			break;
 		case STMT_PRINT:
 			print_indent(indent);
-			printf("print ");
-			expr_print(s->expr, stdout);
-			printf(";\n");
+			fprintf(b_ctx->out, "print ");
+			expr_print(s->expr, b_ctx->out);
+			fprintf(b_ctx->out, ";\n");
 			break;
 		case STMT_RETURN:
 			print_indent(indent);
-			printf("return");
+			fprintf(b_ctx->out, "return");
 			if (s->expr){
-				putchar(' ');
-				expr_print(s->expr, stdout);
+				fputc(' ', b_ctx->out);
+				expr_print(s->expr, b_ctx->out);
 			}
-			printf(";\n");
+			fprintf(b_ctx->out, ";\n");
 			break;
 		case STMT_BLOCK:
 			print_indent(indent);
-			printf("{\n");
+			fprintf(b_ctx->out, "{\n");
 			stmt_print(s->body, indent + 1);
 			print_indent(indent);
-			printf("}\n");
+			fprintf(b_ctx->out, "}\n");
 			break;
 	}
 
@@ -211,9 +190,9 @@ void stmt_resolve(Stmt *s){
     } else if (s->kind == STMT_FOR || s->kind == STMT_IF_ELSE){ 
 		// Case 2a: stmt body is decl which is not allowed in single line for or if
 		if(s->body && s->body->kind == STMT_DECL){
-			fprintf(stderr, "resolver error: '%s' can not be declared in a single-line %s\n", s->body->decl->name, s->kind == STMT_FOR ? "for loop" : "if statement");
+			fprintf(b_ctx->err, "resolver error: '%s' can not be declared in a single-line %s\n", s->body->decl->name, s->kind == STMT_FOR ? "for loop" : "if statement");
 			decl_resolve(s->body->decl);
-			b_ctx.resolver_errors += 1;
+			b_ctx->resolver_errors += 1;
 		// Case 2b: stmt is not a STMT_DECL recurse down
 		} else {
 			if (s->body) s->body->func_sym = s->func_sym;
@@ -229,9 +208,9 @@ void stmt_resolve(Stmt *s){
 	if (s->else_body){
 		// Case 3a: If body is decl throw error, single line decls aren't allowed
 		if (s->else_body->kind == STMT_DECL) {  
-			fprintf(stderr, "resolver error: '%s' can not be declared in a single-line %s\n", s->else_body->decl->name, "else statement");
+			fprintf(b_ctx->err, "resolver error: '%s' can not be declared in a single-line %s\n", s->else_body->decl->name, "else statement");
 			decl_resolve(s->body->decl);
-			b_ctx.resolver_errors += 1;
+			b_ctx->resolver_errors += 1;
 		// Case 3b: else boyd is not decl, recurse down and enter new scope
 		} else{
 			s->else_body->func_sym = s->func_sym;
@@ -243,6 +222,71 @@ void stmt_resolve(Stmt *s){
     stmt_resolve(s->next);
 }
 
+/**
+ * Marks every global symbol referenced in the statement list as reachable 
+ * @param   s       Statement structure to walk 
+ **/
+void stmt_mark_reachable(Stmt *s){
+	if (!s) return;
+	decl_mark_reachable(s->decl);
+	expr_mark_reachable(s->init_expr);
+	expr_mark_reachable(s->expr);
+	expr_mark_reachable(s->next_expr);
+	stmt_mark_reachable(s->body);
+	stmt_mark_reachable(s->else_body);
+	stmt_mark_reachable(s->next);
+}
+
+/**
+ * Interns the string literals the statement list's code generation uses 
+ * @param   s       Statement structure to walk 
+ **/
+void stmt_intern_strings(Stmt *s){
+	if (!s) return;
+	decl_intern_strings(s->decl);
+	expr_intern_strings(s->init_expr);
+	expr_intern_strings(s->expr);
+	expr_intern_strings(s->next_expr);
+	stmt_intern_strings(s->body);
+	stmt_intern_strings(s->else_body);
+	stmt_intern_strings(s->next);
+}
+
+/**
+ * Checks if the statement list assigns to a global string 
+ * @param   s       Statement structure to walk 
+ * @return  true if a global string is assigned, otherwise false 
+ **/
+bool stmt_assigns_global_string(Stmt *s){
+	if (!s) return false;
+	return expr_assigns_global_string(s->init_expr) || expr_assigns_global_string(s->expr) ||
+		   expr_assigns_global_string(s->next_expr) || stmt_assigns_global_string(s->body) ||
+		   stmt_assigns_global_string(s->else_body) || stmt_assigns_global_string(s->next);
+}
+
+/**
+ * Fingerprints everything the code of a statement list depends on (see expr_fingerprint)
+ * @param   s       Statement structure to walk 
+ * @param   hash    fingerprint so far 
+ * @return  fingerprint including the statement list 
+ **/
+uint64_t stmt_fingerprint(Stmt *s, uint64_t hash){
+	if (!s) return fingerprint_int(hash, -1);
+	hash = fingerprint_int(hash, s->kind);
+	if (s->decl){
+		hash = fingerprint_string(hash, s->decl->name);
+		hash = type_fingerprint(s->decl->type, hash);
+		hash = fingerprint_int(hash, s->decl->symbol ? s->decl->symbol->which : -1);
+		hash = expr_fingerprint(s->decl->value, hash);
+	}
+	hash = expr_fingerprint(s->init_expr, hash);
+	hash = expr_fingerprint(s->expr, hash);
+	hash = expr_fingerprint(s->next_expr, hash);
+	hash = stmt_fingerprint(s->body, hash);
+	hash = stmt_fingerprint(s->else_body, hash);
+	return stmt_fingerprint(s->next, hash);
+}
+
 /**
  * Handle if else stmt typechecking 
  * @param	s		stmt if else node to type check
@@ -250,13 +294,15 @@ void stmt_resolve(Stmt *s){
 static bool stmt_typecheck_if_else(Stmt *s){
 	Type *t = expr_typecheck(s->expr);
 	if (!t || t->kind != TYPE_BOOLEAN) {
-		fprintf(stderr, "typechecker error: Condition in 'if' statement must be of type boolean, but got");
-		type_print(t, stderr);
-		fprintf(stderr, ".\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Condition in 'if' statement must be of type boolean, but got");
+		type_print(t, b_ctx->err);
+		fprintf(b_ctx->err, ".\n");
+		b_ctx->typechecker_errors++;
 	}
-	type_destroy(t);
-	return stmt_typecheck(s->body) && stmt_typecheck(s->else_body);
+	// both branches are checked, even when the first one does not return 
+	bool body = stmt_typecheck(s->body);
+	bool else_body = stmt_typecheck(s->else_body);
+	return body && else_body;
 }
 
 /**
@@ -265,17 +311,14 @@ static bool stmt_typecheck_if_else(Stmt *s){
  */
 static bool stmt_typecheck_for(Stmt *s){
 	Type *t = expr_typecheck(s->init_expr);
-	type_destroy(t);
 	t = expr_typecheck(s->next_expr);
-	type_destroy(t);
 	t = expr_typecheck(s->expr);
 	if (t && t->kind != TYPE_BOOLEAN) {
-		fprintf(stderr, "typechecker error: Condition in 'for' loop must be of type boolean, but got");
-		type_print(t, stderr);
-		fprintf(stderr, ".\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Condition in 'for' loop must be of type boolean, but got");
+		type_print(t, b_ctx->err);
+		fprintf(b_ctx->err, ".\n");
+		b_ctx->typechecker_errors++;
 	}
-	type_destroy(t);
 	return stmt_typecheck(s->body);
 }
 
@@ -288,12 +331,11 @@ static void stmt_typecheck_print(Stmt *s){
 	while (e){
 		Type *t = expr_typecheck(e->left);
 		if (t && (t->kind == TYPE_VOID || t->kind == TYPE_FUNCTION || t->kind == TYPE_AUTO)){
-			fprintf(stderr, "Typechecker error: Cannot print type (");
-			type_print(t, stderr);
-			fprintf(stderr, ")\n");
-			b_ctx.typechecker_errors++;
+			fprintf(b_ctx->err, "Typechecker error: Cannot print type (");
+			type_print(t, b_ctx->err);
+			fprintf(b_ctx->err, ")\n");
+			b_ctx->typechecker_errors++;
 		}
-		type_destroy(t);
 		e = e->right;
 	}
 }
@@ -304,33 +346,32 @@ static void stmt_typecheck_print(Stmt *s){
  */
 static bool stmt_typecheck_return(Stmt *s){
 	Type *t = expr_typecheck(s->expr);
-	if (!t) t = type_create(TYPE_VOID, 0, 0, 0);
+	if (!t) t = type_basic(TYPE_VOID);
 	Type *func_return_type = s->func_sym->type->subtype;
 	// Case 1: return type not set
 	if (func_return_type->kind == TYPE_AUTO){
 		// Case 1b: retuning non valid return type 
 		if (!type_valid_return(t) || t->kind == TYPE_AUTO){
-			fprintf(stderr, "typechecker error: Invalid return type got (");
-			type_print(t, stderr);
-			fprintf(stderr, " ) but expected either (integer, double, string, char, boolean, or nothing)\n");
-			b_ctx.typechecker_errors++;
+			fprintf(b_ctx->err, "typechecker error: Invalid return type got (");
+			type_print(t, b_ctx->err);
+			fprintf(b_ctx->err, " ) but expected either (integer, double, string, char, boolean, or nothing)\n");
+			b_ctx->typechecker_errors++;
 		// Case 1c: return type valid set return type
 		} else {
 			func_return_type->kind = t->kind;	
-			fprintf(stdout, "typechecker resolved: return type for function '%s' set to (", s->func_sym->name);
-			type_print(t, stdout);
-			fprintf(stdout, " )\n");
+			fprintf(b_ctx->out, "typechecker resolved: return type for function '%s' set to (", s->func_sym->name);
+			type_print(t, b_ctx->out);
+			fprintf(b_ctx->out, " )\n");
 		}
 	// Case 2: return type set, check if equals
 	} else if (t->kind != func_return_type->kind){
-		fprintf(stderr, "typechecker error: Return type mismatch. Expected (");
-		type_print(s->func_sym->type->subtype, stderr);
-		fprintf(stderr, " ), but got (");
-		type_print(t, stderr);
-		fprintf(stderr, " ).\n");
-		b_ctx.typechecker_errors++;
+		fprintf(b_ctx->err, "typechecker error: Return type mismatch. Expected (");
+		type_print(s->func_sym->type->subtype, b_ctx->err);
+		fprintf(b_ctx->err, " ), but got (");
+		type_print(t, b_ctx->err);
+		fprintf(b_ctx->err, " ).\n");
+		b_ctx->typechecker_errors++;
 	}
-	type_destroy(t);
 	return true;
 }
 
@@ -341,15 +382,13 @@ static bool stmt_typecheck_return(Stmt *s){
  */
 bool stmt_typecheck(Stmt *s){
 	if (!s) return false;
-	Type *t;
 	bool res = false;
 	switch(s->kind){
 		case STMT_DECL:
 			decl_typecheck(s->decl);
 			break;
 		case STMT_EXPR:
-			t = expr_typecheck(s->expr);
-			type_destroy(t);
+			expr_typecheck(s->expr);
 			break;
 		case STMT_IF_ELSE:
 			res = stmt_typecheck_if_else(s);
@@ -401,22 +440,64 @@ static void stmt_codegen_for(Stmt *s, FILE *f){
 
 	expr_codegen(s->init_expr, f);
 	if (s->init_expr) scratch_free(s->init_expr->reg);
-	fprintf(f, "%s:\n", label_name(for_label));
-	if (s->expr){
-		expr_codegen(s->expr, f);
-		reg = s->expr->reg;
-	} else {
-		reg = scratch_alloc();
-		fprintf(f, "\tMOVQ $1, %s\n", scratch_name(reg));
+
+	// preheader: evaluate loop-invariant expressions once 
+	Loop *l = loop_create(s);
+	loop_hoist(l, f);
+
+	// counted loops run unrolled first, leftover iterations fall into the original loop 
+	loop_unroll_plan(l, b_ctx->options.unroll_factor);
+	loop_strength_reduce(l, f);
+	if (l->unroll) stmt_codegen_for_unrolled(l, l->remainder ? for_label : done_label, f);
+
+	if (!l->unroll || l->remainder){
+		fprintf(f, "%s:\n", label_name(for_label));
+		if (s->expr){
+			expr_codegen(s->expr, f);
+			reg = s->expr->reg;
+		} else {
+			reg = scratch_alloc();
+			fprintf(f, "\tMOVQ $1, %s\n", scratch_name(reg));
+		}
+		fprintf(f, "\tCMPQ $0, %s\n", scratch_name(reg));
+		scratch_free(reg);
+		fprintf(f, "\tJE %s\n", label_name(done_label));
+		stmt_codegen(s->body, f);
+		expr_codegen(s->next_expr, f);
+		if (s->next_expr) scratch_free(s->next_expr->reg);
+		loop_advance(l, f);
+		fprintf(f, "\tJMP %s\n", label_name(for_label));
 	}
-	fprintf(f, "\tCMPQ $0, %s\n", scratch_name(reg));
-	scratch_free(reg);
-	fprintf(f, "\tJE %s\n", label_name(done_label));
-	stmt_codegen(s->body, f);
-	expr_codegen(s->next_expr, f);
-	if (s->next_expr) scratch_free(s->next_expr->reg);
-	fprintf(f, "\tJMP %s\n", label_name(for_label));
 	fprintf(f, "%s:\n", label_name(done_label));
+
+	loop_unhoist(l);
+	loop_destroy(l);
+}
+
+/**
+ * Handle the unrolled copy of a counted for loop in x86. Each iteration checks that
+ * l->unroll more iterations remain, then runs the body and step l->unroll times.
+ * @param	l			loop structure with unroll plan 
+ * @param	exit_label	label to jump to once fewer than l->unroll iterations remain 
+ * @param	f			FILE ptr to generate x86 code to
+ */
+static void stmt_codegen_for_unrolled(Loop *l, int exit_label, FILE *f){
+	Stmt *s = l->stmt;
+	int top_label = label_create();
+	Expr *cond = loop_unroll_cond(l);
+
+	fprintf(f, "%s:\n", label_name(top_label));
+	expr_codegen(cond, f);
+	fprintf(f, "\tCMPQ $0, %s\n", scratch_name(cond->reg));
+	scratch_free(cond->reg);
+	fprintf(f, "\tJE %s\n", label_name(exit_label));
+	for (int i = 0; i < l->unroll; i++){
+		stmt_codegen(s->body, f);
+		expr_codegen(s->next_expr, f);
+		scratch_free(s->next_expr->reg);
+		loop_advance(l, f);
+	}
+	fprintf(f, "\tJMP %s\n", label_name(top_label));
 }
 
 /**
@@ -441,8 +522,8 @@ static const char *stmt_codegen_get_func_name(Type *t){
 			break;
 		case TYPE_CARRAY: return "print_carray";
 		default:
-			fprintf(stderr, "codegen error: Printing type that is not allowed\n");
-			exit(EXIT_FAILURE);
+			fprintf(b_ctx->err, "codegen error: Printing type that is not allowed\n");
+			compiler_abort();
 	}
 	return "";
 }
@@ -455,17 +536,12 @@ static const char *stmt_codegen_get_func_name(Type *t){
 static void stmt_codegen_print(Stmt *s, FILE *f){
 	Expr *e = s->expr;
 	while (e){
-		Type *t = expr_typecheck(e->left);
-		const char *func_name = stmt_codegen_get_func_name(t);
+		const char *func_name = stmt_codegen_get_func_name(e->left->type);
 		Expr *res_e = expr_create(EXPR_FUNC, expr_create_name(func_name), expr_create(EXPR_ARGS, e->left, NULL));
 
 		expr_codegen(res_e, f);
 		scratch_free(res_e->reg);
 
-		type_destroy(t);
-		res_e->right->left = NULL;
-		expr_destroy(res_e);
-
 		e = e->right;
 	}
 }
@@ -486,6 +562,29 @@ static void stmt_codegen_return(Stmt *s, FILE *f){
 	fprintf(f, "\tJMP .%s_epilogue\n", s->func_sym->name);
 }
 
+/**
+ * Checks if control never falls through the stmt (return, block that returns, 
+ * or if-else where both branches return)
+ * @param 	s 		Stmt structure to check 
+ * @return 	true if every path through the stmt returns, otherwise false 
+ */
+static bool stmt_codegen_returns(Stmt *s){
+	if (!s) return false;
+	switch (s->kind){
+		case STMT_RETURN:
+			return true;
+		case STMT_BLOCK:
+			for (Stmt *curr = s->body; curr; curr = curr->next){
+				if (stmt_codegen_returns(curr)) return true;
+			}
+			return false;
+		case STMT_IF_ELSE:
+			return s->else_body && stmt_codegen_returns(s->body) && stmt_codegen_returns(s->else_body);
+		default:
+			return false;
+	}
+}
+
 /**
  * Perform code generation on stmt structure 
  * @param 	s 		Stmt structure to perform code generation 
@@ -517,5 +616,8 @@ void stmt_codegen(Stmt *s, FILE *f){
 			stmt_codegen(s->body, f);
 			break;
 	}
+
+	// stmts after an unconditional return are unreachable -> skip them
+	if (stmt_codegen_returns(s)) return;
 	stmt_codegen(s->next, f);
 }
\ No newline at end of file
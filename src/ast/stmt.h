@@ -4,11 +4,13 @@
 #define STMT_H
 
 #include <stdio.h>
+#include <stdint.h>
 
 /* Forward Declaration */
 
 typedef struct Decl Decl;
 typedef struct Expr Expr;
+typedef struct Loop_info Loop_info;
 
 /* Structure */
 
@@ -34,15 +36,19 @@ struct Stmt {
 	Stmt *else_body;	// else body 
 	Stmt *next;			// ptr to next stmt
 	Symbol *func_sym;	// symbol associated with function above it 
+	Loop_info *loop_info;	// for loop analysis, filled in by loop_analyze before codegen 
 };
 
 /* Function */
 
 Stmt       *stmt_create(stmt_t kind, Decl *decl, Expr *init_expr, Expr *expr, Expr *next_expr, Stmt *body, Stmt *else_body, Stmt *next);
-void		stmt_destroy(Stmt *s);
 void 		stmt_print(Stmt *s, int indent);
 Stmt	   *stmt_copy(Stmt *s);
 void        stmt_resolve(Stmt *s);
+void		stmt_mark_reachable(Stmt *s);
+void		stmt_intern_strings(Stmt *s);
+bool		stmt_assigns_global_string(Stmt *s);
+uint64_t	stmt_fingerprint(Stmt *s, uint64_t hash);
 bool 	    stmt_typecheck(Stmt *s);
 void		stmt_codegen(Stmt *s, FILE *f);
 
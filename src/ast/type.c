@@ -6,6 +6,8 @@
 #include "stmt.h"
 #include "symbol.h"
 #include "type.h"
+#include "bminor_context.h"
+#include "fingerprint.h"
 #include "utils.h"
 
 #include <stdio.h>
@@ -22,7 +24,7 @@
  * @return Pointer to the newly created Type structure
  **/
 Type* type_create(type_t kind, Type *subtype, Param_list *params, Expr *arr_len){
-	Type *type = safe_calloc(sizeof(Type), 1);
+	Type *type = arena_calloc(b_ctx->arena, sizeof(Type));
 	type->kind = kind;
 	type->subtype = subtype;
 	type->params = params;
@@ -31,18 +33,25 @@ Type* type_create(type_t kind, Type *subtype, Param_list *params, Expr *arr_len)
 }
 
 /**
- * Frees the Type structure 
- * @param t pointer to t struct 
+ * Returns the shared, immutable instance of a kind with no subtype, params or length.
+ * The typechecker hands these out instead of allocating, so they must never be modified.
+ * @param kind The type category
+ * @return Pointer to the canonical Type for kind
  **/
-void type_destroy(Type *t){
-	if (!t) return; 
-	param_list_destroy(t->params); 
-	t->params = NULL;
-	type_destroy(t->subtype); 
-	t->subtype = NULL;
-	expr_destroy(t->arr_len);
-	t->arr_len = NULL;
-	free(t);
+Type* type_basic(type_t kind){
+	static Type basic[] = {
+		[TYPE_VOID]		 = { .kind = TYPE_VOID },
+		[TYPE_BOOLEAN]	 = { .kind = TYPE_BOOLEAN },
+		[TYPE_CHARACTER] = { .kind = TYPE_CHARACTER },
+		[TYPE_INTEGER]	 = { .kind = TYPE_INTEGER },
+		[TYPE_DOUBLE]	 = { .kind = TYPE_DOUBLE },
+		[TYPE_STRING]	 = { .kind = TYPE_STRING },
+		[TYPE_ARRAY]	 = { .kind = TYPE_ARRAY },
+		[TYPE_CARRAY]	 = { .kind = TYPE_CARRAY },
+		[TYPE_AUTO]		 = { .kind = TYPE_AUTO },
+		[TYPE_FUNCTION]	 = { .kind = TYPE_FUNCTION },
+	};
+	return &basic[kind];
 }
 
 /**
@@ -124,7 +133,7 @@ Type* type_copy(Type *t){
  * @return  true if both type structs are equal, otherwise false
  */
 bool type_equals(Type *a,  Type *b){
-	if (!a && !b) return true;
+	if (a == b) return true;
 	if (!a || !b) return false;
 	if (a->kind != b->kind) return false;
 	if (!type_equals(a->subtype, b->subtype)) return false;
@@ -166,4 +175,18 @@ bool type_valid_return(Type *a){
 	if (!a) return false;
 	if (a->kind == TYPE_FUNCTION || a->kind == TYPE_ARRAY || a->kind == TYPE_CARRAY) return false;
 	return true;
-}
\ No newline at end of file
+}
+
+/**
+ * Fingerprints a type: kinds, parameters, subtypes, and array lengths 
+ * @param 	t 		ptr to Type structure (NULL allowed)
+ * @param 	hash 	fingerprint so far 
+ * @return 	fingerprint including the type 
+ */
+uint64_t type_fingerprint(Type *t, uint64_t hash){
+	if (!t) return fingerprint_int(hash, -1);
+	hash = fingerprint_int(hash, t->kind);
+	hash = param_list_fingerprint(t->params, hash);
+	hash = expr_fingerprint(t->arr_len, hash);
+	return type_fingerprint(t->subtype, hash);
+}
@@ -4,6 +4,7 @@
 #define TYPE_H
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 /* Forward Declaration */
@@ -34,7 +35,6 @@ struct Type {
 	Type *subtype;			// subtypes for functions and arrays 
 	Expr *arr_len;			// get array len 
 	Type *orig_type; 		// original type 
-	Symbol *symbol;			// symbol associated with type
 };
 
 /* Macros */
@@ -46,11 +46,12 @@ struct Type {
 /* Functions */
 
 Type	     *type_create(type_t kind, Type *subtype, Param_list *params, Expr *arr_len);
-void		  type_destroy(Type *t);
+Type         *type_basic(type_t kind);
 void          type_print(Type *t, FILE *stream);
 Type         *type_copy(Type *t);
 bool 		  type_equals(Type *a,  Type *b);
 bool		  type_arrays_equals(Type *a, Type *b);
 bool		  type_valid_return(Type *a);
+uint64_t	  type_fingerprint(Type *t, uint64_t hash);
 
 #endif
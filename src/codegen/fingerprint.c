@@ -0,0 +1,236 @@
+/* fingerprint.c: per-function fingerprints for incremental code generation */
+
+#include "fingerprint.h"
+#include "decl.h"
+#include "hash_table.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Forward declaration of static prototypes */
+
+static char *fingerprints_read(const char *file_name, size_t *size);
+static void  fingerprints_clear(Fingerprints *fp);
+
+/* Helper Functions */
+
+/**
+ * Reads a whole file into memory
+ * @param   file_name   file to read
+ * @param   size        set to the number of bytes read
+ * @return  malloc'd contents, NULL if the file cannot be read
+ */
+static char *fingerprints_read(const char *file_name, size_t *size){
+    FILE *f = fopen(file_name, "r");
+    if (!f) return NULL;
+    long length = fseek(f, 0, SEEK_END) == 0 ? ftell(f) : -1;
+    char *data = length >= 0 && fseek(f, 0, SEEK_SET) == 0 ? safe_malloc(sizeof(char), length + 1) : NULL;
+    if (data && fread(data, 1, length, f) != (size_t)length){
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *size = data ? (size_t)length : 0;
+    return data;
+}
+
+/**
+ * Forgets the previous build, so no function is reused
+ * @param   fp      fingerprints to clear
+ */
+static void fingerprints_clear(Fingerprints *fp){
+    char *name;
+    void *value;
+    hash_table_firstkey(fp->previous);
+    while (hash_table_nextkey(fp->previous, &name, &value)){
+        Fingerprint *prev = value;
+        free(prev->name);
+        free(prev);
+    }
+    hash_table_clear(fp->previous);
+    free(fp->code);
+    fp->code = NULL;
+    fp->code_size = 0;
+}
+
+/* Functions */
+
+/**
+ * Hashes bytes into a running fingerprint (64-bit FNV-1a)
+ * @param   hash    fingerprint so far
+ * @param   data    bytes to hash
+ * @param   size    number of bytes
+ * @return  fingerprint including the bytes
+ */
+uint64_t fingerprint_bytes(uint64_t hash, const void *data, size_t size){
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++){
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Hashes a string (and its end, so "ab","c" and "a","bc" differ)
+ * @param   hash    fingerprint so far
+ * @param   s       string to hash (NULL allowed)
+ * @return  fingerprint including the string
+ */
+uint64_t fingerprint_string(uint64_t hash, const char *s){
+    if (!s) return fingerprint_int(hash, -1);
+    return fingerprint_bytes(hash, s, strlen(s) + 1);
+}
+
+/**
+ * Hashes an integer
+ * @param   hash    fingerprint so far
+ * @param   value   integer to hash
+ * @return  fingerprint including the integer
+ */
+uint64_t fingerprint_int(uint64_t hash, long value){
+    return fingerprint_bytes(hash, &value, sizeof(value));
+}
+
+/**
+ * Loads the fingerprints stored next to file_output by the previous build. They are
+ * only used if that build had the same compiler key and the assembly is unchanged
+ * since, since reused code is copied out of it.
+ * @param   file_output     assembly file about to be generated
+ * @param   key             compiler and options of this build
+ * @return  fingerprints to reuse from and record into
+ */
+Fingerprints *fingerprints_load(const char *file_output, uint64_t key){
+    Fingerprints *fp = safe_calloc(sizeof(Fingerprints), 1);
+    fp->key = key;
+    fp->previous = hash_table_create(0, 0);
+    MALLOC_CHECK(fp->previous);
+
+    char path[BUFSIZ];
+    snprintf(path, sizeof(path), "%s%s", file_output, FINGERPRINT_SUFFIX);
+    FILE *sidecar = fopen(path, "r");
+    if (!sidecar) return fp;
+
+    unsigned long long file_key = 0, code_hash = 0;
+    size_t count = 0;
+    bool valid = fscanf(sidecar, FINGERPRINT_HEADER "\n", &file_key, &code_hash, &count) == 3 && file_key == key;
+    if (valid) fp->code = fingerprints_read(file_output, &fp->code_size);
+    valid = valid && fp->code && fingerprint_bytes(FINGERPRINT_SEED, fp->code, fp->code_size) == code_hash;
+
+    for (size_t i = 0; valid && i < count; i++){
+        Fingerprint *prev = safe_calloc(sizeof(Fingerprint), 1);
+        unsigned long long hash = 0;
+        valid = fscanf(sidecar, "%ms %llx %ld %ld\n", &prev->name, &hash, &prev->offset, &prev->size) == 4 &&
+                prev->offset >= 0 && prev->size >= 0 && (size_t)(prev->offset + prev->size) <= fp->code_size;
+        prev->hash = hash;
+        if (!valid || !hash_table_insert(fp->previous, prev->name, prev)){
+            free(prev->name);
+            free(prev);
+        }
+    }
+    fclose(sidecar);
+
+    if (!valid) fingerprints_clear(fp);
+    return fp;
+}
+
+/**
+ * Copies the code of a function from the previous build if its fingerprint is unchanged
+ * @param   fp      fingerprints of the unit (NULL -> incremental codegen is off)
+ * @param   d       function declaration with its fingerprint
+ * @param   f       file ptr to write the code to
+ * @return  true if the code was reused, otherwise false (the function must be generated)
+ */
+bool fingerprints_reuse(Fingerprints *fp, Decl *d, FILE *f){
+    if (!fp || !fp->code || !d->fingerprint) return false;
+    Fingerprint *prev = hash_table_lookup(fp->previous, d->name);
+    if (!prev || prev->hash != d->fingerprint) return false;
+
+    fwrite(fp->code + prev->offset, 1, prev->size, f);
+    __sync_fetch_and_add(&fp->reused, 1);
+    return true;
+}
+
+/**
+ * Records where a function's code went in this build's assembly
+ * @param   fp      fingerprints of the unit (NULL -> incremental codegen is off)
+ * @param   d       function declaration with its fingerprint
+ * @param   offset  start of its code in the assembly
+ * @param   size    bytes of code
+ */
+void fingerprints_record(Fingerprints *fp, Decl *d, long offset, long size){
+    if (!fp || !d->fingerprint) return;
+    if (fp->count == fp->capacity){
+        fp->capacity = fp->capacity ? fp->capacity * 2 : 16;
+        fp->current = realloc(fp->current, sizeof(Fingerprint) * fp->capacity);
+        MALLOC_CHECK(fp->current);
+    }
+    fp->current[fp->count++] = (Fingerprint){ safe_strdup(d->name), d->fingerprint, offset, size };
+}
+
+/**
+ * Writes this build's fingerprints next to file_output. The sidecar is renamed into
+ * place, so a build that dies midway leaves the old one (which no longer matches the
+ * assembly, so nothing is reused from it).
+ * @param   fp              fingerprints of the unit
+ * @param   file_output     assembly file that was generated
+ */
+void fingerprints_save(Fingerprints *fp, const char *file_output){
+    size_t size = 0;
+    char *code = fingerprints_read(file_output, &size);
+    if (!code){
+        fingerprints_remove(file_output);
+        return;
+    }
+    unsigned long long code_hash = fingerprint_bytes(FINGERPRINT_SEED, code, size);
+    free(code);
+
+    char path[BUFSIZ], temp[BUFSIZ + 8];
+    snprintf(path, sizeof(path), "%s%s", file_output, FINGERPRINT_SUFFIX);
+    snprintf(temp, sizeof(temp), "%s.XXXXXX", path);
+    int fd = mkstemp(temp);
+    FILE *sidecar = fd >= 0 ? fdopen(fd, "w") : NULL;
+    if (!sidecar){
+        if (fd >= 0) close(fd);
+        fingerprints_remove(file_output);
+        return;
+    }
+
+    fprintf(sidecar, FINGERPRINT_HEADER "\n", (unsigned long long)fp->key, code_hash, fp->count);
+    for (size_t i = 0; i < fp->count; i++){
+        Fingerprint *curr = &fp->current[i];
+        fprintf(sidecar, "%s %llx %ld %ld\n", curr->name, (unsigned long long)curr->hash, curr->offset, curr->size);
+    }
+    if (fclose(sidecar) != 0 || rename(temp, path) != 0){
+        unlink(temp);
+        fingerprints_remove(file_output);
+    }
+}
+
+/**
+ * Removes the fingerprints stored next to file_output
+ * @param   file_output     assembly file
+ */
+void fingerprints_remove(const char *file_output){
+    char path[BUFSIZ];
+    snprintf(path, sizeof(path), "%s%s", file_output, FINGERPRINT_SUFFIX);
+    unlink(path);
+}
+
+/**
+ * Frees fingerprints
+ * @param   fp      fingerprints to free (NULL allowed)
+ */
+void fingerprints_destroy(Fingerprints *fp){
+    if (!fp) return;
+    fingerprints_clear(fp);
+    hash_table_delete(fp->previous);
+    for (size_t i = 0; i < fp->count; i++) free(fp->current[i].name);
+    free(fp->current);
+    free(fp);
+}
@@ -0,0 +1,57 @@
+/* fingerprint.h: per-function fingerprints for incremental code generation */
+
+#ifndef FINGERPRINT_H
+#define FINGERPRINT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Forward Declaration */
+
+typedef struct Decl Decl;
+struct hash_table;
+
+/* Macros */
+
+#define FINGERPRINT_SEED    14695981039346656037ULL         // FNV-1a offset basis
+#define FINGERPRINT_SUFFIX  ".fp"                           // sidecar written next to the assembly
+#define FINGERPRINT_HEADER  "bminor-fingerprints %llx %llx %zu" // compiler key, assembly hash, functions
+
+/* Structure */
+
+typedef struct Fingerprint Fingerprint;
+
+struct Fingerprint {
+    char *name;             // function name
+    uint64_t hash;          // fingerprint of the function
+    long offset;            // start of its code in the assembly
+    long size;              // bytes of code
+};
+
+typedef struct Fingerprints Fingerprints;
+
+struct Fingerprints {
+    uint64_t key;                   // compiler and options the assembly was generated with
+    char *code;                     // previous assembly (NULL if nothing can be reused)
+    size_t code_size;
+    struct hash_table *previous;    // function name -> Fingerprint of the previous build
+    Fingerprint *current;           // functions of this build, in output order
+    size_t count;
+    size_t capacity;
+    int reused;                     // functions copied from the previous build
+};
+
+/* Functions */
+
+uint64_t        fingerprint_bytes(uint64_t hash, const void *data, size_t size);
+uint64_t        fingerprint_string(uint64_t hash, const char *s);
+uint64_t        fingerprint_int(uint64_t hash, long value);
+Fingerprints   *fingerprints_load(const char *file_output, uint64_t key);
+bool            fingerprints_reuse(Fingerprints *fp, Decl *d, FILE *f);
+void            fingerprints_record(Fingerprints *fp, Decl *d, long offset, long size);
+void            fingerprints_save(Fingerprints *fp, const char *file_output);
+void            fingerprints_remove(const char *file_output);
+void            fingerprints_destroy(Fingerprints *fp);
+
+#endif
@@ -1,42 +1,44 @@
 /* label.h: create labels for codegen */
 
 #include "label.h"
+#include "bminor_context.h"
 #include "utils.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
-/* Globals */
-static int label_count = 0;
-static int string_count = 0;
-
 /* Functions */
 
 /**
- * Increates label global count and returns the number 
+ * Increates the compiler's label count and returns the number 
  * @return  integer corresponding to the current label number 
  */
 int label_create(){
-    return label_count++;
+    return b_ctx->label_count++;
 }
 
 /**
- * Takes in label number, then creates and returns the name of the label 
+ * Takes in label number, then creates and returns the name of the label. Labels made 
+ * while generating a function carry its name, so functions can be numbered separately.
  * @param   label       Integer for the specified label to create 
  * @return  static string corresponding to the label created 
  */
 const char *label_name(int label){
-    static char name[MAX_NAME] = {0};
-    sprintf(name, ".L%d", label);
+    static __thread char name[(MAX_NAME) + 16] = {0};
+    if (b_ctx->label_prefix){
+        snprintf(name, sizeof(name), ".L%s_%d", b_ctx->label_prefix, label);
+    } else {
+        sprintf(name, ".L%d", label);
+    }
     return name;
 }
 
 /**
- * Increates string label global count and returns the number 
+ * Increates the unit's string label count and returns the number 
  * @return  integer corresponding to the current label number 
  */
 int string_label_create(){
-    return string_count++;
+    return compiler_unit()->string_count++;
 }
 
 /**
@@ -45,7 +47,7 @@ int string_label_create(){
  * @return  static string corresponding to the label created 
  */
 const char *string_label_name(int label){
-    static char name[MAX_NAME] = {0};
+    static __thread char name[MAX_NAME] = {0};
     sprintf(name, "str%d", label);
     return name;
 }
\ No newline at end of file
@@ -0,0 +1,828 @@
+/* loop.c: loop analysis and loop optimizations for codegen */
+
+#include "loop.h"
+#include "bminor_context.h"
+#include "decl.h"
+#include "expr.h"
+#include "stmt.h"
+#include "symbol.h"
+#include "type.h"
+#include "scratch.h"
+#include "hash_table.h"
+#include "fingerprint.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Structure */
+
+typedef struct Loop_nest Loop_nest;
+
+struct Loop_nest {
+    Loop_info *info;        // loop being analyzed 
+    Symbol *var;            // variable its condition tests (NULL if none)
+    Loop_nest *outer;       // enclosing loop being analyzed (NULL -> outermost)
+};
+
+/* Forward declaration of static prototypes */
+
+static Symbol    **symbol_set_slot(Symbol **slots, int slot_count, Symbol *sym);
+static void        symbol_set_add(Symbol_set *set, Symbol *sym);
+static void        symbol_set_union(Symbol_set *dst, Symbol_set *src);
+static bool        symbol_set_contains(Symbol_set *set, Symbol *sym);
+static void        symbol_set_free(Symbol_set *set);
+static Symbol_set *loop_summary(Symbol *func);
+static void        loop_collect_expr(Expr *e, Symbol_set *set, bool globals_only);
+static void        loop_collect_stmt(Stmt *s, Symbol_set *set, bool globals_only);
+static void        loop_index_expr(Expr *e, Loop_nest *nest);
+static void        loop_analyze_for(Stmt *s, Loop_nest *outer);
+static int         loop_analyze_stmt(Stmt *s, Symbol_set *set, Loop_nest *nest);
+static bool        loop_expr_pure(expr_t kind);
+static bool        loop_expr_hoistable(Expr *e);
+static void        loop_hoist_one(Loop *l, Expr *e, FILE *f);
+static bool        loop_hoist_walk(Loop *l, Expr *e, FILE *f);
+static void        loop_hoist_expr(Loop *l, Expr *e, FILE *f);
+static void        loop_hoist_stmt(Loop *l, Stmt *s, FILE *f);
+static bool        loop_int_literal(Expr *e, int *value);
+static int         loop_step(Expr *e, Symbol *iv);
+static int         loop_expr_size(Expr *e);
+static int         loop_trip_count(Loop *l);
+static bool        loop_bounds_safe(Loop *l, Symbol *array);
+static void        loop_reduce_index(Loop *l, Expr *e, FILE *f);
+
+/* Functions */
+
+/**
+ * Finds the slot holding sym, or the empty slot ending its probe run
+ * @param   slots       open-addressing table
+ * @param   slot_count  size of table (power of two)
+ * @param   sym         symbol to look for
+ * @return  ptr to slot
+ */
+static Symbol **symbol_set_slot(Symbol **slots, int slot_count, Symbol *sym){
+    unsigned mask = slot_count - 1;
+    unsigned index = (unsigned)(((uintptr_t)sym >> 4) * 2654435761u) & mask;
+    while (slots[index] && slots[index] != sym) index = (index + 1) & mask;
+    return &slots[index];
+}
+
+/**
+ * Adds symbol to the set if it is not already in it
+ * @param   set     ptr to symbol set
+ * @param   sym     symbol to add
+ */
+static void symbol_set_add(Symbol_set *set, Symbol *sym){
+    if (!sym || symbol_set_contains(set, sym)) return;
+    if (set->count == set->capacity){
+        set->capacity = set->capacity ? set->capacity * 2 : 8;
+        set->items = realloc(set->items, sizeof(Symbol *) * set->capacity);
+        MALLOC_CHECK(set->items);
+    }
+    set->items[set->count++] = sym;
+
+    // keep the table at most half full, rebuilding it from items when it grows
+    if (set->count * 2 > set->slot_count){
+        free(set->slots);
+        set->slot_count = set->slot_count ? set->slot_count * 2 : 16;
+        set->slots = safe_calloc(sizeof(Symbol *), set->slot_count);
+        for (int i = 0; i < set->count; i++){
+            *symbol_set_slot(set->slots, set->slot_count, set->items[i]) = set->items[i];
+        }
+    } else {
+        *symbol_set_slot(set->slots, set->slot_count, sym) = sym;
+    }
+}
+
+/**
+ * Adds every symbol of src into dst
+ * @param   dst     ptr to symbol set to add to
+ * @param   src     ptr to symbol set to add from
+ */
+static void symbol_set_union(Symbol_set *dst, Symbol_set *src){
+    if (src->all_globals) dst->all_globals = true;
+    for (int i = 0; i < src->count; i++){
+        symbol_set_add(dst, src->items[i]);
+    }
+}
+
+/**
+ * Checks if the set contains the symbol
+ * @param   set     ptr to symbol set
+ * @param   sym     symbol to look for
+ * @return  true if symbol in set, otherwise false
+ */
+static bool symbol_set_contains(Symbol_set *set, Symbol *sym){
+    if (!set->count) return false;
+    return *symbol_set_slot(set->slots, set->slot_count, sym) != NULL;
+}
+
+/**
+ * Frees the storage of a symbol set (not the set itself)
+ * @param   set     ptr to symbol set
+ */
+static void symbol_set_free(Symbol_set *set){
+    free(set->items);
+    free(set->slots);
+}
+
+/**
+ * Returns the side-effect summary (globals written) for a function, computing and
+ * caching it on first use. Prototypes without a body and recursive cycles are
+ * treated as writing every global.
+ * @param   func    symbol of the function being called
+ * @return  ptr to cached summary
+ */
+static Symbol_set *loop_summary(Symbol *func){
+    static Symbol_set unknown = { .all_globals = true };
+    if (!func || !func->def || !func->def->code) return &unknown;
+
+    // function name -> Symbol_set of globals the function may write (side-effect summary)
+    Compiler *unit = compiler_unit();
+    if (!unit->loop_summaries){
+        unit->loop_summaries = hash_table_create_interned(0);
+        MALLOC_CHECK(unit->loop_summaries);
+    }
+
+    Symbol_set *set = hash_table_lookup(unit->loop_summaries, func->name);
+    if (set) return set->in_progress ? &unknown : set;
+
+    set = safe_calloc(sizeof(Symbol_set), 1);
+    set->in_progress = true;
+    hash_table_insert(unit->loop_summaries, func->name, set);
+    loop_collect_stmt(func->def->code, set, true);
+    set->in_progress = false;
+    return set;
+}
+
+/**
+ * Collects symbols written by an expression (assignment and increment targets, plus
+ * the side-effect summaries of any calls)
+ * @param   e               expression to walk
+ * @param   set             set to add written symbols to
+ * @param   globals_only    only record global symbols (function summaries)
+ */
+static void loop_collect_expr(Expr *e, Symbol_set *set, bool globals_only){
+    if (!e) return;
+    switch (e->kind){
+        case EXPR_ASSIGN:
+        case EXPR_INCREMENT:
+        case EXPR_DECREMENT:
+            // writes to a[i] change array contents, not the array symbol itself
+            if (e->left && e->left->kind == EXPR_IDENT && e->left->symbol &&
+                (!globals_only || e->left->symbol->kind == SYMBOL_GLOBAL)){
+                symbol_set_add(set, e->left->symbol);
+            }
+            break;
+        case EXPR_FUNC:
+            if (e->left) symbol_set_union(set, loop_summary(e->left->symbol));
+            break;
+        default:
+            break;
+    }
+    loop_collect_expr(e->left, set, globals_only);
+    loop_collect_expr(e->right, set, globals_only);
+}
+
+/**
+ * Collects symbols written by a statement list
+ * @param   s               statement to walk
+ * @param   set             set to add written symbols to
+ * @param   globals_only    only record global symbols (function summaries)
+ */
+static void loop_collect_stmt(Stmt *s, Symbol_set *set, bool globals_only){
+    if (!s) return;
+    if (s->decl){
+        if (!globals_only) symbol_set_add(set, s->decl->symbol);
+        loop_collect_expr(s->decl->value, set, globals_only);
+    }
+    loop_collect_expr(s->init_expr, set, globals_only);
+    loop_collect_expr(s->expr, set, globals_only);
+    loop_collect_expr(s->next_expr, set, globals_only);
+    loop_collect_stmt(s->body, set, globals_only);
+    loop_collect_stmt(s->else_body, set, globals_only);
+    loop_collect_stmt(s->next, set, globals_only);
+}
+
+/**
+ * Records every a[v] in an expression with each enclosing loop whose condition tests 
+ * v, in the order strength reduction visits them
+ * @param   e       expression to walk
+ * @param   nest    innermost loop being analyzed (NULL -> none)
+ */
+static void loop_index_expr(Expr *e, Loop_nest *nest){
+    if (!e || !nest) return;
+    loop_index_expr(e->left, nest);
+    loop_index_expr(e->right, nest);
+    if (e->kind != EXPR_INDEX || e->left->kind != EXPR_IDENT || !e->right || e->right->kind != EXPR_IDENT) return;
+
+    for (; nest; nest = nest->outer){
+        Loop_info *info = nest->info;
+        if (!nest->var || nest->var != e->right->symbol) continue;
+        if (info->index_count == info->index_capacity){
+            info->index_capacity = info->index_capacity ? info->index_capacity * 2 : 8;
+            info->indexes = realloc(info->indexes, sizeof(Expr *) * info->index_capacity);
+            MALLOC_CHECK(info->indexes);
+        }
+        info->indexes[info->index_count++] = e;
+    }
+}
+
+/**
+ * Analyzes a for loop and every loop nested in it: the symbols each one modifies, its 
+ * body size, whether the body writes the condition's variable, and the a[v] it may 
+ * strength reduce. Inner loops are analyzed first and their sets unioned into the 
+ * outer set, so each statement is walked once however deep the nesting.
+ * @param   s       STMT_FOR to analyze
+ * @param   outer   enclosing loop being analyzed (NULL -> outermost)
+ */
+static void loop_analyze_for(Stmt *s, Loop_nest *outer){
+    Compiler *unit = compiler_unit();
+    if (unit->loop_count == unit->loop_capacity){
+        unit->loop_capacity = unit->loop_capacity ? unit->loop_capacity * 2 : 16;
+        unit->loops = realloc(unit->loops, sizeof(Stmt *) * unit->loop_capacity);
+        MALLOC_CHECK(unit->loops);
+    }
+    unit->loops[unit->loop_count++] = s;
+
+    Loop_info *info = safe_calloc(sizeof(Loop_info), 1);
+    Expr *cond = s->expr;
+    Symbol *iv = cond && cond->left && cond->left->kind == EXPR_IDENT ? cond->left->symbol : NULL;
+    Loop_nest nest = { .info = info, .var = iv, .outer = outer };
+
+    // the step runs in this loop but is not searched by its own strength reduction 
+    loop_index_expr(s->expr, &nest);
+    loop_index_expr(s->next_expr, outer);
+    int body = loop_analyze_stmt(s->body, &info->modified, &nest);
+
+    // the body alone decides whether this can be a counted loop of the condition's variable
+    info->iv_written = iv && (symbol_set_contains(&info->modified, iv) ||
+                              (iv->kind == SYMBOL_GLOBAL && info->modified.all_globals));
+
+    loop_collect_expr(s->expr, &info->modified, false);
+    loop_collect_expr(s->next_expr, &info->modified, false);
+    info->size = body < 0 ? -1 : body + loop_expr_size(s->next_expr);
+    s->loop_info = info;
+}
+
+/**
+ * Collects the symbols a statement list writes into set, analyzing any for loops in
+ * it on the way and taking their sets instead of walking their bodies again
+ * @param   s       statement to walk
+ * @param   set     set to add written symbols to (NULL -> only find the loops)
+ * @param   nest    innermost loop being analyzed (NULL -> none)
+ * @return  number of expression nodes, -1 if statements contain a for loop
+ */
+static int loop_analyze_stmt(Stmt *s, Symbol_set *set, Loop_nest *nest){
+    int size = 0;
+    bool nested = false;
+    for (; s; s = s->next){
+        loop_index_expr(s->init_expr, nest);
+        if (s->kind == STMT_FOR){
+            loop_analyze_for(s, nest);
+            nested = true;
+            if (set){
+                loop_collect_expr(s->init_expr, set, false);
+                symbol_set_union(set, &s->loop_info->modified);
+            }
+            continue;
+        }
+
+        if (s->decl){
+            size += 1 + loop_expr_size(s->decl->value);
+            loop_index_expr(s->decl->value, nest);
+        }
+        size += loop_expr_size(s->expr);
+        loop_index_expr(s->expr, nest);
+        loop_index_expr(s->next_expr, nest);
+        if (set){
+            if (s->decl){
+                symbol_set_add(set, s->decl->symbol);
+                loop_collect_expr(s->decl->value, set, false);
+            }
+            loop_collect_expr(s->init_expr, set, false);
+            loop_collect_expr(s->expr, set, false);
+            loop_collect_expr(s->next_expr, set, false);
+        }
+        int body = loop_analyze_stmt(s->body, set, nest);
+        int else_body = loop_analyze_stmt(s->else_body, set, nest);
+        if (body < 0 || else_body < 0) nested = true;
+        size += body + else_body;
+    }
+    return nested ? -1 : size;
+}
+
+/**
+ * Creates loop structure for a for loop. The symbols it modifies come from
+ * loop_analyze, which runs before codegen; a loop codegen reaches without that
+ * (a unit generated serially after a failed check) is analyzed here.
+ * @param   s       STMT_FOR to generate
+ * @return  ptr to loop structure
+ */
+Loop *loop_create(Stmt *s){
+    if (!s->loop_info) loop_analyze_for(s, NULL);
+    Loop *l = safe_calloc(sizeof(Loop), 1);
+    l->stmt = s;
+    l->info = s->loop_info;
+    return l;
+}
+
+/**
+ * Analyzes every for loop in a function body (see loop_analyze_for) and computes the
+ * summaries of the functions they call, in the order codegen reaches them. Function
+ * workers then only read the results.
+ * @param   s       function body to walk 
+ */
+void loop_analyze(Stmt *s){
+    loop_analyze_stmt(s, NULL, NULL);
+}
+
+/**
+ * Fingerprints the side-effect summary of a function, so callers whose loops were 
+ * optimized around it are regenerated when the globals it writes change
+ * @param   func    symbol of the function being called 
+ * @param   hash    fingerprint so far 
+ * @return  fingerprint including the summary 
+ */
+uint64_t loop_summary_fingerprint(Symbol *func, uint64_t hash){
+    Symbol_set *set = loop_summary(func);
+    hash = fingerprint_int(hash, set->all_globals);
+    for (int i = 0; i < set->count; i++) hash = fingerprint_string(hash, set->items[i]->name);
+    return fingerprint_int(hash, set->count);
+}
+
+/**
+ * Frees the loop structure
+ * @param   l       ptr to loop structure
+ */
+void loop_destroy(Loop *l){
+    if (!l) return;
+    free(l->reduced);
+    free(l);
+}
+
+/**
+ * Checks if the symbol may be written while the loop runs
+ * @param   l       ptr to loop structure
+ * @param   sym     symbol to check
+ * @return  true if the loop may modify symbol, otherwise false
+ */
+bool loop_modifies(Loop *l, Symbol *sym){
+    if (!sym) return true;
+    if (sym->kind == SYMBOL_GLOBAL && l->info->modified.all_globals) return true;
+    return symbol_set_contains(&l->info->modified, sym);
+}
+
+/**
+ * Checks if expression computes the same value on every iteration of the loop.
+ * Only side-effect free, non-trapping operators qualify (no calls, indexing, division).
+ * @param   l       ptr to loop structure
+ * @param   e       expression to check
+ * @return  true if loop invariant, otherwise false
+ */
+bool loop_expr_invariant(Loop *l, Expr *e){
+    if (!e) return true;
+    switch (e->kind){
+        case EXPR_IDENT:
+            return !loop_modifies(l, e->symbol);
+        case EXPR_INT_LIT:
+        case EXPR_HEX_LIT:
+        case EXPR_BIN_LIT:
+        case EXPR_CHAR_LIT:
+        case EXPR_STR_LIT:
+        case EXPR_BOOL_LIT:
+            return true;
+        default:
+            return loop_expr_pure(e->kind) && loop_expr_invariant(l, e->left) &&
+                   loop_expr_invariant(l, e->right);
+    }
+}
+
+/**
+ * Checks if an operator is side-effect free and cannot trap, so its value depends
+ * only on its operands
+ * @param   kind    expression kind
+ * @return  true if operator qualifies for hoisting, otherwise false
+ */
+static bool loop_expr_pure(expr_t kind){
+    switch (kind){
+        case EXPR_ADD:
+        case EXPR_SUB:
+        case EXPR_MUL:
+        case EXPR_NEGATION:
+        case EXPR_ARR_LEN:
+        case EXPR_NOT:
+        case EXPR_AND:
+        case EXPR_OR:
+        case EXPR_EQ:
+        case EXPR_NOT_EQ:
+        case EXPR_LT:
+        case EXPR_LTE:
+        case EXPR_GT:
+        case EXPR_GTE:
+        case EXPR_GROUPS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Checks if the expression is worth pinning to a register (not a plain leaf)
+ * @param   e       expression to check
+ * @return  true if expression does work each time it is evaluated, otherwise false
+ */
+static bool loop_expr_hoistable(Expr *e){
+    if (!e || e->hoisted) return false;
+    return !(e->kind == EXPR_IDENT || expr_is_literal(e->kind));
+}
+
+/**
+ * Evaluates an invariant expression into the preheader and pins it to a register,
+ * if it is worth it and registers and hoist slots are left
+ * @param   l       ptr to loop structure
+ * @param   e       loop-invariant expression
+ * @param   f       file ptr to write preheader code to
+ */
+static void loop_hoist_one(Loop *l, Expr *e, FILE *f){
+    if (!loop_expr_hoistable(e) || l->hoist_count >= LOOP_MAX_HOIST) return;
+    if (scratch_available() <= LOOP_MIN_FREE_REGS) return;
+    expr_codegen(e, f);
+    e->hoist_reg = e->reg;
+    e->hoisted = true;
+    l->hoisted[l->hoist_count++] = e;
+}
+
+/**
+ * Computes invariance bottom-up in one pass. An invariant subtree is left for its
+ * parent to decide on; once a node varies, its invariant children are maximal and
+ * are hoisted on the way back up.
+ * @param   l       ptr to loop structure
+ * @param   e       expression to search
+ * @param   f       file ptr to write preheader code to
+ * @return  true if e is loop invariant (and not hoisted yet), otherwise false
+ */
+static bool loop_hoist_walk(Loop *l, Expr *e, FILE *f){
+    if (!e) return true;
+    if (l->hoist_count >= LOOP_MAX_HOIST) return false;
+    // pinned by an enclosing loop: its value may still be invariant here
+    if (e->hoisted) return loop_expr_invariant(l, e);
+
+    // left side of an assignment is an lvalue -> only search the right side
+    bool left = e->kind == EXPR_ASSIGN || loop_hoist_walk(l, e->left, f);
+    bool right = loop_hoist_walk(l, e->right, f);
+    switch (e->kind){
+        case EXPR_IDENT:
+            return !loop_modifies(l, e->symbol);
+        case EXPR_INT_LIT:
+        case EXPR_HEX_LIT:
+        case EXPR_BIN_LIT:
+        case EXPR_CHAR_LIT:
+        case EXPR_STR_LIT:
+        case EXPR_BOOL_LIT:
+            return true;
+        default:
+            if (left && right && loop_expr_pure(e->kind)) return true;
+            break;
+    }
+
+    if (e->kind != EXPR_ASSIGN && left) loop_hoist_one(l, e->left, f);
+    if (right) loop_hoist_one(l, e->right, f);
+    return false;
+}
+
+/**
+ * Finds maximal loop-invariant subexpressions and evaluates them into the preheader
+ * @param   l       ptr to loop structure
+ * @param   e       expression to search
+ * @param   f       file ptr to write preheader code to
+ */
+static void loop_hoist_expr(Loop *l, Expr *e, FILE *f){
+    if (loop_hoist_walk(l, e, f)) loop_hoist_one(l, e, f);
+}
+
+/**
+ * Walks a statement list looking for loop-invariant expressions to hoist. The body of
+ * a nested loop is left to that loop's own preheader, so no body is searched twice.
+ * @param   l       ptr to loop structure
+ * @param   s       statement to search
+ * @param   f       file ptr to write preheader code to
+ */
+static void loop_hoist_stmt(Loop *l, Stmt *s, FILE *f){
+    if (!s) return;
+    if (s->decl) loop_hoist_expr(l, s->decl->value, f);
+    loop_hoist_expr(l, s->init_expr, f);
+    loop_hoist_expr(l, s->expr, f);
+    loop_hoist_expr(l, s->next_expr, f);
+    if (s->kind != STMT_FOR) loop_hoist_stmt(l, s->body, f);
+    loop_hoist_stmt(l, s->else_body, f);
+    loop_hoist_stmt(l, s->next, f);
+}
+
+/**
+ * Loop-invariant code motion: evaluates invariant expressions of the condition, step,
+ * and body once before the loop and pins them to scratch registers. expr_codegen
+ * copies the pinned register whenever a hoisted expression is reached.
+ * @param   l       ptr to loop structure
+ * @param   f       file ptr to write preheader code to
+ */
+void loop_hoist(Loop *l, FILE *f){
+    loop_hoist_expr(l, l->stmt->expr, f);
+    loop_hoist_expr(l, l->stmt->next_expr, f);
+    loop_hoist_stmt(l, l->stmt->body, f);
+}
+
+/**
+ * Releases the registers pinned by loop_hoist and loop_strength_reduce once the loop is done
+ * @param   l       ptr to loop structure
+ */
+void loop_unhoist(Loop *l){
+    for (int i = 0; i < l->hoist_count; i++){
+        scratch_free(l->hoisted[i]->hoist_reg);
+        l->hoisted[i]->hoisted = false;
+    }
+    l->hoist_count = 0;
+
+    for (int i = 0; i < l->reduced_count; i++){
+        l->reduced[i]->strength_reduced = false;
+        l->reduced[i]->in_bounds = false;
+    }
+    l->reduced_count = 0;
+
+    for (int i = 0; i < l->pointer_count; i++){
+        scratch_free(l->pointer_reg[i]);
+    }
+    l->pointer_count = 0;
+}
+
+/**
+ * Frees the sets loop_analyze cached on for loops and the function side-effect summaries
+ */
+void loop_analysis_destroy(){
+    for (int i = 0; i < b_ctx->loop_count; i++){
+        Stmt *s = b_ctx->loops[i];
+        symbol_set_free(&s->loop_info->modified);
+        free(s->loop_info->indexes);
+        free(s->loop_info);
+        s->loop_info = NULL;
+    }
+    free(b_ctx->loops);
+    b_ctx->loops = NULL;
+    b_ctx->loop_count = b_ctx->loop_capacity = 0;
+
+    if (!b_ctx->loop_summaries) return;
+    char *key;
+    void *value;
+    hash_table_firstkey(b_ctx->loop_summaries);
+    while (hash_table_nextkey(b_ctx->loop_summaries, &key, &value)){
+        Symbol_set *set = value;
+        symbol_set_free(set);
+        free(set);
+    }
+    hash_table_delete(b_ctx->loop_summaries);
+    b_ctx->loop_summaries = NULL;
+}
+
+/**
+ * Checks if expression is an integer literal (decimal, hex, or binary)
+ * @param   e       expression to check
+ * @param   value   set to the literal value if it is one
+ * @return  true if integer literal, otherwise false
+ */
+static bool loop_int_literal(Expr *e, int *value){
+    if (!e) return false;
+    switch (e->kind){
+        case EXPR_INT_LIT:
+        case EXPR_HEX_LIT:
+        case EXPR_BIN_LIT:
+            *value = e->literal_value;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Returns the constant step of an induction update: i++, i--, i = i + k, i = k + i, i = i - k
+ * @param   e       step expression of the for loop
+ * @param   iv      induction variable
+ * @return  signed step, 0 if expression is not a constant step of iv
+ */
+static int loop_step(Expr *e, Symbol *iv){
+    int k = 0;
+    if (!e || !e->left || e->left->kind != EXPR_IDENT || e->left->symbol != iv) return 0;
+    switch (e->kind){
+        case EXPR_INCREMENT: return 1;
+        case EXPR_DECREMENT: return -1;
+        case EXPR_ASSIGN:
+            break;
+        default:
+            return 0;
+    }
+
+    Expr *r = e->right;
+    if (!r || !r->left || !r->right) return 0;
+    bool left_iv = r->left->kind == EXPR_IDENT && r->left->symbol == iv;
+    bool right_iv = r->right->kind == EXPR_IDENT && r->right->symbol == iv;
+    if (r->kind == EXPR_ADD && left_iv && loop_int_literal(r->right, &k)) return k;
+    if (r->kind == EXPR_ADD && right_iv && loop_int_literal(r->left, &k)) return k;
+    if (r->kind == EXPR_SUB && left_iv && loop_int_literal(r->right, &k)) return -k;
+    return 0;
+}
+
+/**
+ * Counts the nodes in an expression tree
+ * @param   e       expression to count
+ * @return  number of nodes
+ */
+static int loop_expr_size(Expr *e){
+    if (!e) return 0;
+    return 1 + loop_expr_size(e->left) + loop_expr_size(e->right);
+}
+
+/**
+ * Detects a counted loop: 'i <op> bound' tested against an invariant bound, i stepped by a
+ * constant in the step expression and not written anywhere else in the loop
+ * @param   l       ptr to loop structure (iv and step set on success)
+ * @return  true if loop is a counted loop, otherwise false
+ */
+bool loop_induction(Loop *l){
+    Stmt *s = l->stmt;
+    Expr *cond = s->expr;
+    l->iv = NULL;
+    l->step = 0;
+    if (!cond || !cond->left || cond->left->kind != EXPR_IDENT || !cond->left->symbol) return false;
+
+    Symbol *iv = cond->left->symbol;
+    int step = loop_step(s->next_expr, iv);
+    if (step == 0) return false;
+
+    // condition must move towards the bound 
+    switch (cond->kind){
+        case EXPR_LT:
+        case EXPR_LTE:
+            if (step < 0) return false;
+            break;
+        case EXPR_GT:
+        case EXPR_GTE:
+            if (step > 0) return false;
+            break;
+        default:
+            return false;
+    }
+    if (!loop_expr_invariant(l, cond->right)) return false;
+
+    // the body must leave iv alone 
+    if (s->loop_info->iv_written) return false;
+
+    l->iv = iv;
+    l->step = step;
+    return true;
+}
+
+/**
+ * Computes the trip count of a counted loop with literal start and bound 
+ * @param   l       ptr to loop structure with induction info
+ * @return  number of iterations, -1 if not known at compile time
+ */
+static int loop_trip_count(Loop *l){
+    Stmt *s = l->stmt;
+    int start, bound;
+    if (!s->init_expr || s->init_expr->kind != EXPR_ASSIGN || !s->init_expr->left ||
+        s->init_expr->left->symbol != l->iv || !loop_int_literal(s->init_expr->right, &start) ||
+        !loop_int_literal(s->expr->right, &bound)) return -1;
+
+    long distance = l->step > 0 ? (long)bound - start : (long)start - bound;
+    long step = l->step > 0 ? l->step : -(long)l->step;
+    if (s->expr->kind == EXPR_LTE || s->expr->kind == EXPR_GTE) distance++;
+    if (distance <= 0) return 0;
+    return (int)((distance + step - 1) / step);
+}
+
+/**
+ * Decides whether and how to unroll a loop. Only innermost counted loops with small
+ * bodies are unrolled; a remainder loop is skipped when the trip count is a known
+ * multiple of the factor.
+ * @param   l       ptr to loop structure (unroll and remainder set)
+ * @param   factor  copies of the body per unrolled iteration
+ */
+void loop_unroll_plan(Loop *l, int factor){
+    l->unroll = 0;
+    l->remainder = true;
+    if (factor < 2 || !loop_induction(l)) return;
+
+    int size = l->info->size;
+    if (size < 0 || size > LOOP_UNROLL_MAX_BODY) return;
+
+    int trips = loop_trip_count(l);
+    if (trips >= 0 && trips < factor) return;
+
+    l->unroll = factor;
+    l->remainder = trips < 0 || trips % factor != 0;
+}
+
+/**
+ * Builds the guard of the unrolled loop: the original condition tested against the
+ * value iv takes on the last copy of the body (i + (factor - 1) * step <op> bound)
+ * @param   l       ptr to loop structure that is being unrolled
+ * @return  condition expression sharing iv and bound with the original condition
+ */
+Expr *loop_unroll_cond(Loop *l){
+    Expr *cond = l->stmt->expr;
+    int offset = (l->unroll - 1) * l->step;
+    Expr *last = expr_create(offset > 0 ? EXPR_ADD : EXPR_SUB, cond->left,
+                             expr_create_integer_literal(offset > 0 ? offset : -offset));
+    last->right->type = last->type = cond->left->type;
+    Expr *guard = expr_create(cond->kind, last, cond->right);
+    guard->type = cond->type;
+    return guard;
+}
+
+/**
+ * Checks if every a[iv] in the loop is provably in bounds: iv starts at a non-negative
+ * literal, steps by one, and the loop runs while iv < #a
+ * @param   l       ptr to loop structure with induction info
+ * @param   array   array symbol being indexed
+ * @return  true if the bounds check can be skipped, otherwise false
+ */
+static bool loop_bounds_safe(Loop *l, Symbol *array){
+    Stmt *s = l->stmt;
+    int start;
+    return l->step == 1 && s->expr->kind == EXPR_LT && s->expr->right->kind == EXPR_ARR_LEN &&
+           s->expr->right->left && s->expr->right->left->kind == EXPR_IDENT &&
+           s->expr->right->left->symbol == array && s->init_expr && s->init_expr->kind == EXPR_ASSIGN &&
+           s->init_expr->left->symbol == l->iv && loop_int_literal(s->init_expr->right, &start) && start >= 0;
+}
+
+/**
+ * Points an a[iv] read or write at an induction pointer for the array, creating the 
+ * pointer in the preheader the first time an array is seen
+ * @param   l       ptr to loop structure
+ * @param   e       a[iv] found by loop_analyze
+ * @param   f       file ptr to write preheader code to
+ */
+static void loop_reduce_index(Loop *l, Expr *e, FILE *f){
+    if (e->strength_reduced || e->right->symbol != l->iv) return;
+
+    Symbol *array = e->left->symbol;
+    if (!array || array->type->kind != TYPE_ARRAY || loop_modifies(l, array)) return;
+
+    int k = 0;
+    while (k < l->pointer_count && l->arrays[k] != array) k++;
+    if (k == l->pointer_count){
+        if (k == LOOP_MAX_POINTERS || scratch_available() <= LOOP_MIN_FREE_REGS) return;
+
+        // &a[iv] = base + 8 * (iv + 1), skipping the length word 
+        int index = scratch_alloc();
+        int reg = scratch_alloc();
+        fprintf(f, "\tMOVQ %s, %s\n", symbol_codegen(l->iv), scratch_name(index));
+        if (array->kind == SYMBOL_GLOBAL){
+            fprintf(f, "\tMOVQ $%s, %s\n", symbol_codegen(array), scratch_name(reg));
+        } else {
+            fprintf(f, "\tMOVQ %s, %s\n", symbol_codegen(array), scratch_name(reg));
+        }
+        fprintf(f, "\tLEAQ 8(%s, %s, 8), %s\n", scratch_name(reg), scratch_name(index), scratch_name(reg));
+        scratch_free(index);
+
+        l->arrays[k] = array;
+        l->pointer_reg[k] = reg;
+        l->pointer_count++;
+    }
+
+    if (l->reduced_count == l->reduced_capacity){
+        l->reduced_capacity = l->reduced_capacity ? l->reduced_capacity * 2 : 8;
+        l->reduced = realloc(l->reduced, sizeof(Expr *) * l->reduced_capacity);
+        MALLOC_CHECK(l->reduced);
+    }
+    l->reduced[l->reduced_count++] = e;
+    e->strength_reduced = true;
+    e->pointer_reg = l->pointer_reg[k];
+    e->in_bounds = loop_bounds_safe(l, array);
+}
+
+/**
+ * Induction-variable strength reduction: in counted loops, a[iv] becomes a load through
+ * a pointer kept in a register that starts at &a[iv] in the preheader and moves
+ * 8 * step bytes with every step, so the base and index are not rematerialized.
+ * @param   l       ptr to loop structure
+ * @param   f       file ptr to write preheader code to
+ */
+void loop_strength_reduce(Loop *l, FILE *f){
+    if (!l->iv && !loop_induction(l)) return;
+    for (int i = 0; i < l->info->index_count; i++){
+        loop_reduce_index(l, l->info->indexes[i], f);
+    }
+}
+
+/**
+ * Moves the induction pointers along with the induction variable, emitted after each step
+ * @param   l       ptr to loop structure
+ * @param   f       file ptr to write x86 code to
+ */
+void loop_advance(Loop *l, FILE *f){
+    for (int i = 0; i < l->pointer_count; i++){
+        fprintf(f, "\tADDQ $%d, %s\n", 8 * l->step, scratch_name(l->pointer_reg[i]));
+    }
+}
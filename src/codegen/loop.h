@@ -0,0 +1,84 @@
+/* loop.h: loop analysis and loop optimizations for codegen */
+
+#ifndef LOOP_H
+#define LOOP_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Forward Declaration */
+
+typedef struct Symbol Symbol;
+typedef struct Stmt Stmt;
+typedef struct Expr Expr;
+
+/* Macros */
+
+#define LOOP_MAX_HOIST      2       // max invariant expressions pinned to registers per loop
+#define LOOP_MIN_FREE_REGS  4       // scratch registers that must stay free for the loop body
+#define LOOP_UNROLL_MAX_BODY 64     // max expression nodes in a body that gets unrolled 
+#define LOOP_MAX_POINTERS   2       // max arrays walked by induction pointers per loop 
+
+/* Structure */
+
+typedef struct Symbol_set Symbol_set;
+
+struct Symbol_set {
+    Symbol **items;         // symbols written, in the order they were added 
+    int count;              // number of symbols in set 
+    int capacity;           // allocated size of items 
+    Symbol **slots;         // open-addressing table keyed by symbol pointer (NULL -> empty)
+    int slot_count;         // size of slots, a power of two kept at least twice count 
+    bool all_globals;       // unknown side effects -> every global may be written 
+    bool in_progress;       // summary is being computed (recursive calls)
+};
+
+typedef struct Loop_info Loop_info;
+
+struct Loop_info {
+    Symbol_set modified;    // symbols written by cond, step, or body (inner loops included)
+    int size;               // expression nodes in body and step, -1 if the body nests a loop 
+    bool iv_written;        // body writes the variable the condition tests 
+    Expr **indexes;         // a[v] in cond and body (inner loops included), v the condition's variable
+    int index_count;        // number of indexes 
+    int index_capacity;     // allocated size of indexes 
+};
+
+typedef struct Loop Loop;
+
+struct Loop {
+    Stmt *stmt;                     // STMT_FOR being optimized 
+    Loop_info *info;                // analysis of stmt (owned by the stmt)
+    Expr *hoisted[LOOP_MAX_HOIST];  // invariant expressions evaluated in the preheader 
+    int hoist_count;                // number of hoisted expressions 
+    Symbol *iv;                     // induction variable (NULL if not a counted loop)
+    int step;                       // signed amount iv changes each iteration 
+    int unroll;                     // copies of the body per unrolled iteration (0 -> not unrolled)
+    bool remainder;                 // remainder loop needed after the unrolled loop 
+    Symbol *arrays[LOOP_MAX_POINTERS];      // arrays indexed by iv 
+    int pointer_reg[LOOP_MAX_POINTERS];     // register holding &arrays[k][iv] 
+    int pointer_count;                      // number of induction pointers 
+    Expr **reduced;                 // a[iv] nodes that read through an induction pointer 
+    int reduced_count;              // number of reduced nodes 
+    int reduced_capacity;           // allocated size of reduced 
+};
+
+/* Functions */
+
+Loop   *loop_create(Stmt *s);
+void    loop_destroy(Loop *l);
+bool    loop_modifies(Loop *l, Symbol *sym);
+bool    loop_expr_invariant(Loop *l, Expr *e);
+void    loop_hoist(Loop *l, FILE *f);
+void    loop_unhoist(Loop *l);
+void    loop_analyze(Stmt *s);
+void    loop_analysis_destroy();
+uint64_t loop_summary_fingerprint(Symbol *func, uint64_t hash);
+bool    loop_induction(Loop *l);
+void    loop_unroll_plan(Loop *l, int factor);
+Expr   *loop_unroll_cond(Loop *l);
+void    loop_strength_reduce(Loop *l, FILE *f);
+void    loop_advance(Loop *l, FILE *f);
+
+#endif
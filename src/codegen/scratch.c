@@ -1,17 +1,14 @@
 /* scratch.c: function for scratch registers */
 
 #include "scratch.h"
+#include "bminor_context.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
 /* Globals */
 
-// 7 scratch registers -> {rbx, r10, r11, r12, r13, r14, r15}
-// 0 -> not in use 
-// 1 -> in use 
-int scratch_registers[MAX_SCRATCH_REGISTERS] = {0};
-
+// 7 scratch registers -> {rbx, r10, r11, r12, r13, r14, r15}, usage lives in b_ctx->scratch_registers
 static const char *register_names[MAX_SCRATCH_REGISTERS] = {
     "%rbx",
     "%r10",
@@ -30,14 +27,14 @@ static const char *register_names[MAX_SCRATCH_REGISTERS] = {
  */
 int scratch_alloc(){
     for (int i = 0; i < MAX_SCRATCH_REGISTERS; i++){
-        if (!scratch_registers[i]){
-            scratch_registers[i] = 1;
+        if (!b_ctx->scratch_registers[i]){
+            b_ctx->scratch_registers[i] = 1;
             return i;
         }
     } 
 
-    fprintf(stderr, "scratch_alloc: Ran out of scratch registers\n");
-    exit(EXIT_FAILURE);
+    fprintf(b_ctx->err, "scratch_alloc: Ran out of scratch registers\n");
+    compiler_abort();
 }
 
 /**
@@ -46,10 +43,10 @@ int scratch_alloc(){
  */
 void scratch_free(int r){
     if (r < 0 || r >= MAX_SCRATCH_REGISTERS){
-        fprintf(stderr, "scratch_free: Invalid scratch register number passed, scratch registers range from 0-6\n");
+        fprintf(b_ctx->err, "scratch_free: Invalid scratch register number passed, scratch registers range from 0-6\n");
         return;
     }
-    scratch_registers[r] = 0;
+    b_ctx->scratch_registers[r] = 0;
 }
 
 /**
@@ -58,8 +55,20 @@ void scratch_free(int r){
  */
 const char * scratch_name(int r){
     if (r < 0 || r >= MAX_SCRATCH_REGISTERS){
-        fprintf(stderr, "scratch_name: Invalid scratch register number passed, scratch registers range from 0-6\n");
+        fprintf(b_ctx->err, "scratch_name: Invalid scratch register number passed, scratch registers range from 0-6\n");
         return NULL;
     }
     return register_names[r];
-}
\ No newline at end of file
+}
+
+/**
+ * This function counts the scratch registers that are not in use 
+ * @return   number of free scratch registers 
+ */
+int scratch_available(){
+    int count = 0;
+    for (int i = 0; i < MAX_SCRATCH_REGISTERS; i++){
+        if (!b_ctx->scratch_registers[i]) count++;
+    }
+    return count;
+}
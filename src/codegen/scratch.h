@@ -14,5 +14,6 @@
 int         scratch_alloc();
 void        scratch_free(int r);
 const char *scratch_name(int r);
+int         scratch_available();
 
 #endif 
\ No newline at end of file
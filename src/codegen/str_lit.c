@@ -1,47 +1,78 @@
 /* str_lit.c: string literal functions */
 
 #include "str_lit.h"
+#include "bminor_context.h"
 #include "symbol.h"
 #include "encoder.h"
+#include "hash_table.h"
+#include "label.h"
 #include "utils.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
-/* Globals */
-
-String_head string_ll = {
-    .head = 0,
-    .tail = 0,
-};
-
 /* Functions */
 
 /**
- * Function allocates string literal node and returns it 
+ * Function allocates string literal node, appends it to the unit's list and returns it 
  * @param   lit     string literal 
  * @param   label   label associated with string literal 
  */
 String_lit *string_alloc(const char *literal, const char *label){
+    String_head *string_ll = &compiler_unit()->strings;
     String_lit *node = safe_calloc(sizeof(String_lit), 1);
     node->label = safe_strdup(label);
     node->literal = safe_strdup(literal);
 
-    if (!string_ll.head && !string_ll.tail){
-        string_ll.head = node;
-        string_ll.tail = node;
+    if (!string_ll->head && !string_ll->tail){
+        string_ll->head = node;
+        string_ll->tail = node;
     } else {
-        string_ll.tail->next = node;
-        string_ll.tail = node;
+        string_ll->tail->next = node;
+        string_ll->tail = node;
     }
     return node;
 }
 
+/**
+ * Function returns the string literal node for the contents passed in, allocating a 
+ * new label only the first time the contents are seen (identical literals share a label).
+ * Literals belong to the compilation unit, so functions generated in parallel share them;
+ * the unit's string lock guards the table.
+ * @param   literal     string literal contents (NULL is treated as empty string)
+ * @return  String_lit node associated with the literal contents 
+ */
+String_lit *string_intern(const char *literal){
+    if (!literal) literal = "";
+    Compiler *unit = compiler_unit();
+
+    pthread_mutex_lock(&unit->string_lock);
+    // maps string literal contents -> String_lit node, so identical literals share one label
+    if (!unit->string_table){
+        unit->string_table = hash_table_create(0, 0);
+        MALLOC_CHECK(unit->string_table);
+    }
+
+    String_lit *node = hash_table_lookup(unit->string_table, literal);
+    if (!node){
+        int label = string_label_create();
+        node = string_alloc(literal, string_label_name(label));
+        if (!hash_table_insert(unit->string_table, literal, node)){
+            pthread_mutex_unlock(&unit->string_lock);
+            fprintf(b_ctx->err, "string_intern: hash table insert failed for \"%s\"\n", literal);
+            compiler_abort();
+        }
+    }
+    pthread_mutex_unlock(&unit->string_lock);
+    return node;
+}
+
 /**
  * Function frees all nodes in the string linked list and labels
  */
 void string_lit_destroy(){
-    String_lit *node = string_ll.head;
+    String_head *string_ll = &b_ctx->strings;
+    String_lit *node = string_ll->head;
     String_lit *dummy = NULL;
 
     while (node){
@@ -51,6 +82,12 @@ void string_lit_destroy(){
         node = node->next;
         free(dummy);
     }
+    string_ll->head = string_ll->tail = NULL;
+
+    if (b_ctx->string_table){
+        hash_table_delete(b_ctx->string_table);
+        b_ctx->string_table = NULL;
+    }
 }
 
 /**
@@ -58,9 +95,9 @@ void string_lit_destroy(){
  * @param   f   FILE ptr to print out .data section 
  */
 void string_print(FILE *f){
-    if (!f || !string_ll.head) return;
+    if (!f || !b_ctx->strings.head) return;
     char es[BUFSIZ] = {0};
-    String_lit *node = string_ll.head;
+    String_lit *node = b_ctx->strings.head;
 
     fprintf(f, ".data\n");
     while (node){
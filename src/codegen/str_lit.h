@@ -26,13 +26,10 @@ struct String_head {
     String_lit *tail;
 };
 
-/* Globals */
-
-extern String_head string_ll; 
-
 /* Functions */
 
 String_lit  *string_alloc(const char *literal, const char *label);
+String_lit  *string_intern(const char *literal);
 void         string_lit_destroy();
 void         string_print(FILE *f);
 
@@ -1,6 +1,7 @@
 /* encoder.c: encode and decode strings in bminor language */
 
 #include "encoder.h"
+#include "bminor_context.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -8,6 +9,12 @@
 #include <errno.h>
 #include <stdbool.h>
 
+/* Macros */
+
+// messages go to the bound compiler's streams, so buffered and served units keep them 
+#define ENCODER_OUT (b_ctx ? b_ctx->out : stdout)
+#define ENCODER_ERR (b_ctx ? b_ctx->err : stderr)
+
 /* Functions */
 
 /** 
@@ -20,7 +27,7 @@
 **/
 int string_decode( const char *es, char *s ){
     if (!es || !s) {
-        fprintf(stderr, "encoded string is null\n");
+        fprintf(ENCODER_ERR, "encoded string is null\n");
         return false; 
     }
 
@@ -32,7 +39,7 @@ int string_decode( const char *es, char *s ){
     if (*encoded != '"') {
         // check for edge case with string starting with \" 
         if (encoded[0] != '\\' || encoded[1] != '"'){
-            fprintf(stderr, "String does not start with opening quote\n");
+            fprintf(ENCODER_ERR, "String does not start with opening quote\n");
             return false;
         }
     }
@@ -40,8 +47,8 @@ int string_decode( const char *es, char *s ){
 
     while(true){
         if (count > MAX_STR_LEN){
-            printf("%d\n", count);
-            fprintf(stderr, "Maximum string length exceeded\n");
+            fprintf(ENCODER_OUT, "%d\n", count);
+            fprintf(ENCODER_ERR, "Maximum string length exceeded\n");
             return false;
         }
 
@@ -52,13 +59,13 @@ int string_decode( const char *es, char *s ){
 
 
         if (my_char == '\0') {
-            fprintf(stderr, "String does not end with closing quotation\n");
+            fprintf(ENCODER_ERR, "String does not end with closing quotation\n");
             return false;
         }
 
         // invalid ascii no escape char
         if (my_char != '\\' && (my_char < 32 || my_char > 127)) { 
-            fprintf(stderr, "unprintable ASCII, should be escaped in hex form\n");
+            fprintf(ENCODER_ERR, "unprintable ASCII, should be escaped in hex form\n");
             return false;
         }
 
@@ -72,7 +79,7 @@ int string_decode( const char *es, char *s ){
         if (my_char == '\\'){
             const char *back_char = encoded++;
             if (*back_char == '\0' ) {
-                fprintf(stderr, "Terminate string without closing quote\n");
+                fprintf(ENCODER_ERR, "Terminate string without closing quote\n");
                 return false; 
             }
 
@@ -113,7 +120,7 @@ int string_decode( const char *es, char *s ){
                     if(back_char[1] == '\0'){
                         count++;
                         if (count > MAX_STR_LEN){
-                            fprintf(stderr, "Maximum length of string should be 255\n");
+                            fprintf(ENCODER_ERR, "Maximum length of string should be 255\n");
                             return false;
                         }
                         goto end;
@@ -121,7 +128,7 @@ int string_decode( const char *es, char *s ){
                     break;
                 case '0':
                     if (back_char[1] == '\0') {
-                        fprintf(stderr, "Incomplete string not closing quote\n");
+                        fprintf(ENCODER_ERR, "Incomplete string not closing quote\n");
                         return false;
                     }
                     if (back_char[1] != 'x'){
@@ -148,7 +155,7 @@ int string_decode( const char *es, char *s ){
 
     // if not end fail
     if(*encoded != '\0'){
-         fprintf(stderr, "Invalid Characters after closing string\n");
+         fprintf(ENCODER_ERR, "Invalid Characters after closing string\n");
          return false;
     }
 
@@ -164,7 +171,7 @@ int string_decode( const char *es, char *s ){
 **/
 void string_encode( const char *s, char *es ){
     if (!s || !es) {
-        fprintf(stderr, "decoded string is null\n");
+        fprintf(ENCODER_ERR, "decoded string is null\n");
         return;
     }
     const char *decoded = s;
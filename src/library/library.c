@@ -89,11 +89,13 @@ void check_bounds(long arr[], long index){
 }
 
 long str_equal(char *s1, char *s2){
+	if (s1 == s2) return 1;
+	if (!s1 || !s2 || s1[0] != s2[0]) return 0;
 	return strcmp(s1, s2) == 0;
 }
 
 long str_not_equal(char *s1, char *s2){
-	return strcmp(s1, s2) != 0;
+	return !str_equal(s1, s2);
 }
 
 long integer_power(long x, long y){
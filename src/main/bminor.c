@@ -1,6 +1,10 @@
 /* bminor.c: compiler for the bminor language */
 
 #include "bminor_functions.h"
+#include "bminor_server.h"
+#include "bminor_cache.h"
+#include "bminor_context.h"
+#include "bminor_report.h"
 #include "utils.h"
 
 #include <stdio.h>
@@ -8,55 +12,146 @@
 #include <stdlib.h>
 #include <string.h>
 
-/* Main Execution */
+/* Forward declaration of static prototypes */
 
-int main(int argc, const char *argv[]){
+static int bminor_run(int argc, const char *argv[]);
+
+/* Functions */
+
+/**
+ * Runs one compiler invocation in this process
+ * @param   argc    number of arguments 
+ * @param   argv    arguments, argv[0] is the program 
+ * @return  exit status 
+ */
+static int bminor_run(int argc, const char *argv[]){
+    const char *program = argv[0];
     int argind = 1;
     bool status = true;
+    Options options = { .unroll_factor = DEFAULT_UNROLL_FACTOR, .threads = DEFAULT_THREADS };
 
     // error check for correct arguments 
     if (argc > 1 && (streq(argv[1], "-h") || streq(argv[1], "--help"))) {
-        usage(argv[0]);
+        usage(program);
         return EXIT_SUCCESS;
     }
 
+    // codegen options come before the stage 
+    argind = options_parse(argc, argv, &options, stderr);
+    if (argind < 0){
+        usage(program);
+        return EXIT_FAILURE;
+    }
+    argc -= argind - 1;
+    argv += argind - 1;
+    argind = 1;
+
+    // batch form: --codegen [-j N] <source files> -o <output directory>
+    if (argc > 2 && streq(argv[1], "--codegen") && (streq(argv[2], "-j") || streq(argv[argc - 2], "-o"))){
+        if (options.time_report){
+            fprintf(stderr, "Failed: --time-report runs on one source file\n");
+            return EXIT_FAILURE;
+        }
+        int jobs = 1;
+        int first = 2;
+        if (streq(argv[2], "-j")){
+            char *end = NULL;
+            jobs = argc > 3 ? strtol(argv[3], &end, 10) : 0;
+            if (jobs < 1 || *end){
+                fprintf(stderr, "Failed: -j expects a positive integer\n");
+                usage(program);
+                return EXIT_FAILURE;
+            }
+            first = 4;
+        }
+        if (argc - first < 3 || !streq(argv[argc - 2], "-o")){
+            fprintf(stderr, "Failed: expected <Bminor source files> -o <output directory>\n");
+            usage(program);
+            return EXIT_FAILURE;
+        }
+        status = codegen_batch(argv + first, argc - first - 2, argv[argc - 1], jobs, &options);
+        return status ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (argc == 2 && streq(argv[1], "--cache-stats")){
+        return cache_stats(stdout) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     if (argc < 3){
         fprintf(stderr, "Failed not enough command line arguments\n");
-        usage(argv[0]);
+        usage(program);
         return EXIT_FAILURE;
     }
     
-    if (streq(argv[1], "--codegen") && argc != 4){
+    if ((streq(argv[1], "--codegen") || streq(argv[1], "--emit-ast-bin")) && argc != 4){
         fprintf(stderr, "Failed not enough command line arguments\n");
-        usage(argv[0]);
+        usage(program);
         return EXIT_FAILURE;
     }
 
     const char *command = argv[argind++];
     const char *filename = argv[argind++];
     const char *output_file = NULL;
+    Compiler *c = compiler_create(&options);
+    if (options.time_report) c->report = report_create();
 
     // parse commands
     if (streq(command, "--encode")){
         status = encode(filename);
     } else if (streq(command, "--scan")) {
-        status = scan(filename);
+        status = scan(c, filename);
     } else if (streq(command, "--parse")){
-        status = parse(filename);
+        status = parse(c, filename);
     } else if (streq(command, "--print")){
-        status = pretty_print(filename);
+        status = pretty_print(c, filename);
     } else if (streq(command, "--resolve")){
-        status = resolve(filename, true);
+        status = resolve(c, filename);
     } else if (streq(command, "--typecheck")){
-        status = typecheck(filename, true);
+        status = typecheck(c, filename);
     } else if (streq(command, "--codegen")){
         output_file = argv[argind++]; 
-        status = codegen(filename, output_file);
+        status = codegen(c, filename, output_file);
+    } else if (streq(command, "--emit-ast-bin")){
+        output_file = argv[argind++]; 
+        status = emit_ast_bin(c, filename, output_file);
     }else { 
         fprintf(stderr, "Failed: Unknown command '%s'\n", command);
-        usage(argv[0]);
+        usage(program);
     }
 
+    if (c->report){
+        report_end(c);
+        report_print(c->report, filename, options.time_report, stderr);
+        report_destroy(c->report);
+    }
+    compiler_destroy(c);
     return status ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
+
+/* Main Execution */
+
+int main(int argc, const char *argv[]){
+    // persistent compile server and its client
+    if (argc > 1 && streq(argv[1], "--server")){
+        if (argc != 3){
+            fprintf(stderr, "Failed: expected --server <socket path>\n");
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        return server_run(argv[2]);
+    }
+    if (argc > 1 && streq(argv[1], "--client")){
+        if (argc < 4){
+            fprintf(stderr, "Failed: expected --client <socket path> <arguments>\n");
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        const char *socket_path = argv[2];
+        argv[2] = argv[0];
+        int status = client_run(socket_path, argc - 2, argv + 2);
+        return status == CLIENT_LOCAL ? bminor_run(argc - 2, argv + 2) : status;
+    }
+
+    return bminor_run(argc, argv);
+}
@@ -0,0 +1,384 @@
+/* bminor_cache.c: content-addressed on-disk cache of generated assembly */
+
+#include "bminor_cache.h"
+#include "fingerprint.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+/* Structure */
+
+typedef enum {
+    CACHE_HITS,
+    CACHE_MISSES,
+    CACHE_STORES,
+    CACHE_EVICTIONS,
+    CACHE_COUNTERS,
+} cache_counter_t;
+
+typedef struct Cache_file Cache_file;
+
+struct Cache_file {
+    char *name;                 // entry name in the cache directory
+    off_t size;                 // bytes on disk
+    struct timespec used;       // last hit or store (mtime)
+};
+
+/* Globals */
+
+static const char *cache_counters[] = {
+    [CACHE_HITS]        = "hits",
+    [CACHE_MISSES]      = "misses",
+    [CACHE_STORES]      = "stores",
+    [CACHE_EVICTIONS]   = "evictions",
+};
+
+/* Forward declaration of static prototypes */
+
+static bool cache_copy(FILE *from, FILE *to, long size);
+static bool cache_is_entry(const char *name);
+static int  cache_lru(const void *a, const void *b);
+static void cache_count(const char *dir, cache_counter_t counter, long amount);
+static bool cache_read_counters(int fd, long counters[CACHE_COUNTERS]);
+static void cache_evict(Cache *cache);
+
+/* Helper Functions */
+
+/**
+ * Copies bytes from one stream to another
+ * @param   from    stream to read
+ * @param   to      stream to write
+ * @param   size    bytes to copy, -1 for everything left in from
+ * @return  true if the bytes were copied, otherwise false
+ */
+static bool cache_copy(FILE *from, FILE *to, long size){
+    char buffer[BUFSIZ * 8];
+    while (size != 0){
+        size_t want = size < 0 || size > (long)sizeof(buffer) ? sizeof(buffer) : (size_t)size;
+        size_t n = fread(buffer, 1, want, from);
+        if (n == 0) return size < 0 && !ferror(from);
+        if (fwrite(buffer, 1, n, to) != n) return false;
+        if (size > 0) size -= n;
+    }
+    return true;
+}
+
+/**
+ * Checks if a directory entry is a cache entry (skips stats and temporaries)
+ * @param   name    name in the cache directory
+ * @return  true if name is a cache entry, otherwise false
+ */
+static bool cache_is_entry(const char *name){
+    size_t length = strlen(name);
+    size_t suffix = strlen(CACHE_SUFFIX);
+    return name[0] != '.' && length > suffix && streq(name + length - suffix, CACHE_SUFFIX);
+}
+
+/**
+ * Orders cache entries from least to most recently used (qsort)
+ * @param   a   Cache_file
+ * @param   b   Cache_file
+ * @return  negative if a was used before b, positive if after, 0 if at the same time
+ */
+static int cache_lru(const void *a, const void *b){
+    const struct timespec *x = &((const Cache_file *)a)->used;
+    const struct timespec *y = &((const Cache_file *)b)->used;
+    if (x->tv_sec != y->tv_sec) return x->tv_sec < y->tv_sec ? -1 : 1;
+    if (x->tv_nsec != y->tv_nsec) return x->tv_nsec < y->tv_nsec ? -1 : 1;
+    return 0;
+}
+
+/**
+ * Reads the counters of the stats file
+ * @param   fd          stats file
+ * @param   counters    counters to fill in (missing counters are 0)
+ * @return  true if the file could be read, otherwise false
+ */
+static bool cache_read_counters(int fd, long counters[CACHE_COUNTERS]){
+    char text[BUFSIZ] = {0};
+    memset(counters, 0, sizeof(long) * CACHE_COUNTERS);
+    ssize_t n = pread(fd, text, sizeof(text) - 1, 0);
+    if (n < 0) return false;
+
+    char *save = NULL;
+    for (char *line = strtok_r(text, "\n", &save); line; line = strtok_r(NULL, "\n", &save)){
+        char name[64];
+        long value;
+        if (sscanf(line, "%63s %ld", name, &value) != 2) continue;
+        for (int i = 0; i < CACHE_COUNTERS; i++){
+            if (streq(name, cache_counters[i])) counters[i] = value;
+        }
+    }
+    return true;
+}
+
+/**
+ * Adds to a counter in the stats file. Compilers sharing the directory take turns
+ * with flock, so no update is lost.
+ * @param   dir         cache directory
+ * @param   counter     counter to update
+ * @param   amount      amount to add
+ */
+static void cache_count(const char *dir, cache_counter_t counter, long amount){
+    char path[BUFSIZ];
+    snprintf(path, sizeof(path), "%s/%s", dir, CACHE_STATS);
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return;
+    if (flock(fd, LOCK_EX) == 0){
+        long counters[CACHE_COUNTERS];
+        if (cache_read_counters(fd, counters)){
+            counters[counter] += amount;
+
+            char text[BUFSIZ];
+            int length = 0;
+            for (int i = 0; i < CACHE_COUNTERS; i++){
+                length += snprintf(text + length, sizeof(text) - length, "%s %ld\n", cache_counters[i], counters[i]);
+            }
+            if (pwrite(fd, text, length, 0) == length) ftruncate(fd, length);
+        }
+        flock(fd, LOCK_UN);
+    }
+    close(fd);
+}
+
+/**
+ * Removes least recently used entries until the cache fits in its limit
+ * @param   cache   cache to trim
+ */
+static void cache_evict(Cache *cache){
+    DIR *dir = opendir(cache->dir);
+    if (!dir) return;
+
+    size_t count = 0, capacity = 64;
+    Cache_file *files = safe_malloc(sizeof(Cache_file), capacity);
+    long total = 0;
+    struct dirent *d;
+    while ((d = readdir(dir))){
+        if (!cache_is_entry(d->d_name)) continue;
+        struct stat st;
+        if (fstatat(dirfd(dir), d->d_name, &st, 0) < 0) continue;
+        if (count == capacity){
+            capacity *= 2;
+            files = realloc(files, sizeof(Cache_file) * capacity);
+            MALLOC_CHECK(files);
+        }
+        files[count++] = (Cache_file){ safe_strdup(d->d_name), st.st_size, st.st_mtim };
+        total += st.st_size;
+    }
+
+    long evicted = 0;
+    if (total > cache->limit){
+        qsort(files, count, sizeof(Cache_file), cache_lru);
+        for (size_t i = 0; i < count && total > cache->limit; i++){
+            // another compiler may have evicted it already
+            if (unlinkat(dirfd(dir), files[i].name, 0) == 0) evicted++;
+            total -= files[i].size;
+        }
+    }
+    closedir(dir);
+
+    for (size_t i = 0; i < count; i++) free(files[i].name);
+    free(files);
+    if (evicted) cache_count(cache->dir, CACHE_EVICTIONS, evicted);
+}
+
+/* Functions */
+
+/**
+ * Hashes bytes into a running hash (64-bit FNV-1a)
+ * @param   hash    hash so far (start from any seed)
+ * @param   data    bytes to hash
+ * @param   size    number of bytes
+ * @return  hash including the bytes
+ */
+uint64_t cache_hash(uint64_t hash, const void *data, size_t size){
+    return fingerprint_bytes(hash, data, size);
+}
+
+/**
+ * Opens the cache named by BMINOR_CACHE_DIR, creating the directory if needed
+ * @param   cache   cache to open
+ * @return  true if caching is on and the directory is usable, otherwise false
+ */
+bool cache_open(Cache *cache){
+    cache->dir = getenv(CACHE_DIR_ENV);
+    if (!cache->dir || !*cache->dir) return false;
+    if (mkdir(cache->dir, 0755) < 0 && errno != EEXIST) return false;
+
+    const char *limit = getenv(CACHE_SIZE_ENV);
+    char *end = NULL;
+    cache->limit = limit ? strtol(limit, &end, 10) : CACHE_DEFAULT_SIZE;
+    if (limit && (*end || cache->limit < 0)) cache->limit = CACHE_DEFAULT_SIZE;
+    cache->entry[0] = '\0';
+    return true;
+}
+
+/**
+ * Hashes what identifies the generated code apart from the source: the compiler 
+ * (version, and size and time of its executable) and the options that change the 
+ * output. --threads does not change the output, so it is left out.
+ * @param   options     codegen options
+ * @return  compiler key
+ */
+uint64_t cache_compiler_key(const Options *options){
+    uint64_t hash = cache_hash(CACHE_HASH_SEED, BMINOR_VERSION, sizeof(BMINOR_VERSION));
+    struct stat st;
+    if (stat("/proc/self/exe", &st) == 0){
+        hash = cache_hash(hash, &st.st_size, sizeof(st.st_size));
+        hash = cache_hash(hash, &st.st_mtim, sizeof(st.st_mtim));
+    }
+    return cache_hash(hash, &options->unroll_factor, sizeof(options->unroll_factor));
+}
+
+/**
+ * Names the entry for a source: the key covers the source bytes and the compiler key
+ * @param   cache       open cache
+ * @param   source      source bytes
+ * @param   size        number of source bytes
+ * @param   options     codegen options
+ */
+void cache_key(Cache *cache, const char *source, size_t size, const Options *options){
+    uint64_t seeds[2] = { CACHE_HASH_SEED, ~CACHE_HASH_SEED };
+    uint64_t compiler = cache_compiler_key(options);
+    uint64_t keys[2];
+
+    for (int i = 0; i < 2; i++){
+        uint64_t hash = cache_hash(seeds[i], &compiler, sizeof(compiler));
+        hash = cache_hash(hash, &size, sizeof(size));
+        keys[i] = cache_hash(hash, source, size);
+    }
+    snprintf(cache->entry, sizeof(cache->entry), "%s/%016llx%016llx%s", cache->dir,
+             (unsigned long long)keys[0], (unsigned long long)keys[1], CACHE_SUFFIX);
+}
+
+/**
+ * Replays the entry for the key: its messages go to out and err, its assembly to
+ * file_output. The entry is marked used for eviction.
+ * @param   cache           cache with a key
+ * @param   file_output     assembly file to write
+ * @param   out             stream for the stdout messages of the compile
+ * @param   err             stream for the stderr messages of the compile
+ * @return  true on a hit, false on a miss (file_output is then left to codegen)
+ */
+bool cache_fetch(Cache *cache, const char *file_output, FILE *out, FILE *err){
+    FILE *entry = fopen(cache->entry, "r");
+    long out_size = -1, err_size = -1;
+    if (!entry || fscanf(entry, CACHE_HEADER, &out_size, &err_size) != 2 || fgetc(entry) != '\n' ||
+        out_size < 0 || err_size < 0){
+        if (entry) fclose(entry);
+        cache_count(cache->dir, CACHE_MISSES, 1);
+        return false;
+    }
+    futimens(fileno(entry), NULL);
+
+    char *messages = safe_malloc(sizeof(char), out_size + err_size + 1);
+    bool copied = fread(messages, 1, out_size + err_size, entry) == (size_t)(out_size + err_size);
+    FILE *output = copied ? fopen(file_output, "w") : NULL;
+    copied = output && cache_copy(entry, output, -1);
+    if (output && fclose(output) != 0) copied = false;
+    fclose(entry);
+
+    if (copied){
+        fwrite(messages, 1, out_size, out);
+        fwrite(messages + out_size, 1, err_size, err);
+    }
+    free(messages);
+    cache_count(cache->dir, copied ? CACHE_HITS : CACHE_MISSES, 1);
+    return copied;
+}
+
+/**
+ * Stores a compile as the entry for the key: a header with the message sizes, the
+ * messages, then the assembly. The entry is written next to the others and renamed
+ * into place, so readers see a whole entry or none.
+ * @param   cache           cache with a key
+ * @param   file_output     assembly file codegen wrote
+ * @param   out             stdout messages of the compile
+ * @param   out_size        bytes in out
+ * @param   err             stderr messages of the compile
+ * @param   err_size        bytes in err
+ */
+void cache_store(Cache *cache, const char *file_output, const char *out, size_t out_size, const char *err, size_t err_size){
+    char temp[BUFSIZ];
+    snprintf(temp, sizeof(temp), "%s/.tmp-XXXXXX", cache->dir);
+    int fd = mkstemp(temp);
+    if (fd < 0) return;
+    FILE *entry = fdopen(fd, "w");
+    if (!entry){
+        close(fd);
+        unlink(temp);
+        return;
+    }
+
+    FILE *output = fopen(file_output, "r");
+    bool copied = output && fchmod(fd, 0644) == 0 &&
+                  fprintf(entry, CACHE_HEADER "\n", (long)out_size, (long)err_size) > 0 &&
+                  fwrite(out, 1, out_size, entry) == out_size &&
+                  fwrite(err, 1, err_size, entry) == err_size &&
+                  cache_copy(output, entry, -1);
+    if (output) fclose(output);
+    if (fclose(entry) != 0) copied = false;
+
+    if (copied && rename(temp, cache->entry) == 0){
+        cache_count(cache->dir, CACHE_STORES, 1);
+        cache_evict(cache);
+    } else {
+        unlink(temp);
+    }
+}
+
+/**
+ * Prints the hit/miss counters and the size of the cache
+ * @param   out     stream to print to
+ * @return  true if caching is on, otherwise false
+ */
+bool cache_stats(FILE *out){
+    Cache cache;
+    if (!cache_open(&cache)){
+        fprintf(stderr, "Failed: %s is not set or not a usable directory\n", CACHE_DIR_ENV);
+        return false;
+    }
+
+    char path[BUFSIZ];
+    snprintf(path, sizeof(path), "%s/%s", cache.dir, CACHE_STATS);
+    long counters[CACHE_COUNTERS] = {0};
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0){
+        flock(fd, LOCK_SH);
+        cache_read_counters(fd, counters);
+        close(fd);
+    }
+
+    long entries = 0, bytes = 0;
+    DIR *dir = opendir(cache.dir);
+    struct dirent *d;
+    while (dir && (d = readdir(dir))){
+        struct stat st;
+        if (!cache_is_entry(d->d_name) || fstatat(dirfd(dir), d->d_name, &st, 0) < 0) continue;
+        entries++;
+        bytes += st.st_size;
+    }
+    if (dir) closedir(dir);
+
+    long lookups = counters[CACHE_HITS] + counters[CACHE_MISSES];
+    fprintf(out, "cache:     %s\n", cache.dir);
+    for (int i = 0; i < CACHE_COUNTERS; i++){
+        char label[32];
+        snprintf(label, sizeof(label), "%s:", cache_counters[i]);
+        fprintf(out, "%-10s %ld\n", label, counters[i]);
+    }
+    fprintf(out, "hit rate:  %.1f%%\n", lookups ? 100.0 * counters[CACHE_HITS] / lookups : 0.0);
+    fprintf(out, "entries:   %ld\n", entries);
+    fprintf(out, "bytes:     %ld of %ld\n", bytes, cache.limit);
+    return true;
+}
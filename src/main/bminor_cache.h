@@ -0,0 +1,41 @@
+/* bminor_cache.h: content-addressed on-disk cache of generated assembly */
+
+#ifndef BMINOR_CACHE_H
+#define BMINOR_CACHE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bminor_context.h"
+
+#define BMINOR_VERSION          "1.0"               // part of every cache key
+#define CACHE_DIR_ENV           "BMINOR_CACHE_DIR"  // cache directory, unset -> no caching
+#define CACHE_SIZE_ENV          "BMINOR_CACHE_SIZE" // bytes kept before evicting (optional)
+#define CACHE_DEFAULT_SIZE      (256L << 20)        // bytes kept when CACHE_SIZE_ENV is unset
+#define CACHE_STATS             "stats"             // hit/miss counters in the cache directory
+#define CACHE_HASH_SEED         14695981039346656037ULL // FNV-1a offset basis
+#define CACHE_SUFFIX            ".bmc"              // suffix of cache entries
+#define CACHE_HEADER            "bminor-cache %ld %ld" // first line of an entry: message sizes
+
+/* Structure */
+
+typedef struct Cache Cache;
+
+struct Cache {
+    const char *dir;            // cache directory
+    long limit;                 // bytes kept before evicting
+    char entry[BUFSIZ];         // path of the entry for the key
+};
+
+/* Functions */
+
+uint64_t    cache_hash(uint64_t hash, const void *data, size_t size);
+uint64_t    cache_compiler_key(const Options *options);
+bool        cache_open(Cache *cache);
+void        cache_key(Cache *cache, const char *source, size_t size, const Options *options);
+bool        cache_fetch(Cache *cache, const char *file_output, FILE *out, FILE *err);
+void        cache_store(Cache *cache, const char *file_output, const char *out, size_t out_size, const char *err, size_t err_size);
+bool        cache_stats(FILE *out);
+
+#endif
@@ -1,14 +1,117 @@
-/* bminor_context.c: source file to init context */
+/* bminor_context.c: source file to create, bind and destroy compiler contexts */
 
 #include "bminor_context.h"
+#include "loop.h"
+#include "utils.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
+#include <setjmp.h>
 
-Context b_ctx = {
-    .resolver_errors = 0,
-    .typechecker_errors = 0,
-    .codegen_errors = 0,
-    .data_flag = false,
-    .text_flag = false,
-};
+/* Globals */
+
+__thread Compiler *b_ctx = NULL;
+
+/* Functions */
+
+/**
+ * Allocates a context for compiling one unit 
+ * @param   options     compiler options, NULL for the defaults 
+ * @return  ptr to new compiler context, exits on failure 
+ **/
+Compiler *compiler_create(const Options *options){
+    Compiler *c = safe_calloc(sizeof(Compiler), 1);
+    c->out = stdout;
+    c->err = stderr;
+    c->options.unroll_factor = DEFAULT_UNROLL_FACTOR;
+    c->options.threads = DEFAULT_THREADS;
+    if (options) c->options = *options;
+    c->arena = arena_create();
+    pthread_mutex_init(&c->string_lock, NULL);
+    return c;
+}
+
+/**
+ * Releases a context and everything it owns: the AST, identifiers, scopes, string 
+ * literals, and loop summaries. Scanner state and the source mapping are released by 
+ * the stage that created them.
+ * @param   c       compiler context to free 
+ **/
+void compiler_destroy(Compiler *c){
+    if (!c) return;
+
+    Compiler *prev = compiler_bind(c);
+    while (scope_level()) scope_exit();
+    string_lit_destroy();
+    loop_analysis_destroy();
+    compiler_bind(prev == c ? NULL : prev);
+
+    arena_destroy(c->arena);
+    intern_destroy(&c->names);
+    pthread_mutex_destroy(&c->string_lock);
+    free(c);
+}
+
+/**
+ * Makes c the compiler every phase running on the calling thread works on 
+ * @param   c       compiler context to bind (NULL unbinds)
+ * @return  previously bound context 
+ **/
+Compiler *compiler_bind(Compiler *c){
+    Compiler *prev = b_ctx;
+    b_ctx = c;
+    return prev;
+}
+
+/**
+ * Returns the context of the unit being compiled on this thread: the bound context, 
+ * or the unit it works for when the bound context is a function worker 
+ * @return  unit compiler context 
+ **/
+Compiler *compiler_unit(){
+    return b_ctx->parent ? b_ctx->parent : b_ctx;
+}
+
+/**
+ * Creates a worker context that generates functions of c on another thread. The 
+ * worker has its own arena, labels, scratch registers, and error counters, and 
+ * shares c's string literals and loop summaries.
+ * @param   c       unit compiler context 
+ * @return  ptr to worker context, released with compiler_join 
+ **/
+Compiler *compiler_fork(Compiler *c){
+    Compiler *worker = safe_calloc(sizeof(Compiler), 1);
+    worker->out = c->out;
+    worker->err = c->err;
+    worker->options = c->options;
+    worker->parent = c;
+    worker->root = c->root;
+    worker->arena = arena_create();
+    return worker;
+}
+
+/**
+ * Folds a worker back into its unit: error counts are added to c, and nodes and 
+ * names the worker allocated move to c's arena. The worker is freed.
+ * @param   c       unit compiler context 
+ * @param   worker  context returned by compiler_fork(c)
+ **/
+void compiler_join(Compiler *c, Compiler *worker){
+    c->resolver_errors += worker->resolver_errors;
+    c->typechecker_errors += worker->typechecker_errors;
+    c->codegen_errors += worker->codegen_errors;
+    arena_adopt(c->arena, worker->arena);
+    arena_adopt(c->arena, worker->names.strings);
+    free(worker->names.slots);
+    free(worker);
+}
+
+/**
+ * Stops compiling the unit bound to this thread after a fatal error. Unwinds to 
+ * b_ctx->bail when the driver set one, otherwise exits the process.
+ **/
+void compiler_abort(){
+    if (b_ctx && b_ctx->bail) longjmp(*b_ctx->bail, 1);
+    exit(EXIT_FAILURE);
+}
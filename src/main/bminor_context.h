@@ -1,21 +1,96 @@
-/* bminor_context.h: Error context for the compiler */
+/* bminor_context.h: compiler context, everything one compilation unit needs */
 
 #ifndef BMINOR_CONTEXT
 #define BMINOR_CONTEXT
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <setjmp.h>
+#include <pthread.h>
 
-typedef struct Context Context;
+#include "arena.h"
+#include "intern.h"
+#include "scope.h"
+#include "scratch.h"
+#include "str_lit.h"
 
-struct Context {
+#define DEFAULT_UNROLL_FACTOR 4     // body copies per unrolled iteration of counted loops 
+#define DEFAULT_THREADS 1           // threads checking and generating the functions of one unit 
+
+/* Forward declaration */
+
+typedef struct Decl Decl;
+typedef struct Fingerprints Fingerprints;
+typedef struct Report Report;
+typedef struct Stmt Stmt;
+struct hash_table;
+
+/* Structure */
+
+typedef struct Options Options;
+
+struct Options {
+    int unroll_factor;              // body copies per unrolled iteration of counted loops 
+    int threads;                    // threads checking and generating the functions of one unit 
+    bool incremental;               // reuse code of unchanged functions from the previous build 
+    bool ast_bin;                   // input files are binary ASTs instead of Bminor source 
+    int time_report;                // 0, REPORT_TEXT, or REPORT_JSON (--time-report[=json])
+};
+
+typedef struct Compiler Compiler;
+
+struct Compiler {
+    // diagnostics 
+    FILE *out;                      // listings and resolver/typechecker messages (stdout)
+    FILE *err;                      // error messages (stderr)
+    jmp_buf *bail;                  // set -> fatal errors unwind here instead of exiting 
     int resolver_errors;
     int typechecker_errors;
     int codegen_errors;
+    Report *report;                 // phase measurements for --time-report (NULL -> off)
+
+    Options options;
+    Compiler *parent;               // unit a function worker generates code for (NULL for a unit)
+
+    // front end 
+    char *source;                   // memory-mapped (or, for pipes, read) source file 
+    size_t source_size;             // bytes of source text 
+    size_t source_length;           // length of the mapping (file + zeroed tail, 0 -> read into heap)
+    void *scanner;                  // reentrant scanner state (yyscan_t)
+    Decl *root;                     // program parsed from source 
+    Arena *arena;                   // owns every AST node, type, symbol and literal of the compilation 
+    Intern_table names;             // identifiers, compared by pointer 
+    Symbol_stack scopes;            // open scopes during name resolution 
+
+    // code generation 
     bool data_flag;
     bool text_flag;
+    const char *label_prefix;       // function the .L labels belong to 
+    int label_count;                // next .L label 
+    int string_count;               // next str label 
+    int scratch_registers[MAX_SCRATCH_REGISTERS];   // 1 -> in use 
+    String_head strings;            // string literals for the .data section 
+    struct hash_table *string_table;    // literal contents -> String_lit 
+    pthread_mutex_t string_lock;        // guards strings and string_table against function workers 
+    struct hash_table *loop_summaries;  // function name -> Symbol_set of globals it writes 
+    Stmt **loops;                       // for loops whose Loop_info loop_analyze cached for this codegen 
+    int loop_count;                     // number of loops 
+    int loop_capacity;                  // allocated size of loops 
+    Fingerprints *fingerprints;         // previous build of the output (NULL -> not incremental)
 };
 
-extern Context b_ctx;
+/* Globals */
+
+extern __thread Compiler *b_ctx;    // compiler bound to the calling thread 
+
+/* Functions */
+
+Compiler   *compiler_create(const Options *options);
+void        compiler_destroy(Compiler *c);
+Compiler   *compiler_bind(Compiler *c);
+Compiler   *compiler_unit();
+Compiler   *compiler_fork(Compiler *c);
+void        compiler_join(Compiler *c, Compiler *worker);
+void        compiler_abort() __attribute__((noreturn));
 
-#endif
\ No newline at end of file
+#endif
@@ -2,9 +2,13 @@
 
 #include "bminor_functions.h"
 #include "bminor_context.h"
+#include "bminor_cache.h"
+#include "ast_bin.h"
+#include "bminor_report.h"
 #include "encoder.h"
 #include "tokens_to_string.h"
 #include "token.h"
+#include "scanner.h"
 #include "decl.h"
 #include "expr.h"
 #include "param_list.h"
@@ -13,6 +17,10 @@
 #include "type.h"
 #include "scope.h"
 #include "str_lit.h"
+#include "loop.h"
+#include "pool.h"
+#include "hash_table.h"
+#include "fingerprint.h"
 #include "utils.h"
 
 #include <stdio.h>
@@ -20,51 +28,261 @@
 #include <stdbool.h>
 #include <string.h>
 #include <errno.h>
+#include <setjmp.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* Structure */
+
+typedef struct Batch_unit Batch_unit;
+
+struct Batch_unit {
+    const char *source;         // Bminor source file 
+    char *output;               // assembly file written 
+    bool status;                // true if the unit compiled 
+    char *out;                  // buffered stdout messages 
+    size_t out_size;
+    char *err;                  // buffered stderr messages 
+    size_t err_size;
+};
+
+typedef struct Batch Batch;
+
+struct Batch {
+    Batch_unit *units;
+    const Options *options;     // options every unit is compiled with 
+};
+
+/* Forward declaration of static prototypes */
+
+static char *source_map(Compiler *c, const char *file_name, size_t *size);
+static char *source_read(Compiler *c, int fd, const char *file_name, size_t *size);
+static bool  setup_compiler(Compiler *c, const char *file_name);
+static bool  compiler_parse(Compiler *c, const char *file_name);
+static char *batch_output_path(const char *output_dir, const char *file_name);
+static bool  batch_check_outputs(Batch_unit *units, int count);
+static void  batch_compile(void *arg, size_t index);
+static void  batch_print_errors(Batch_unit *u);
 
-/* Globals */
+/* Helper Functions */
 
-extern FILE   *yyin;
-extern int     yylex();
-extern char   *yytext; 
-extern int     yyparse();
-extern int     yyrestart();
-extern int     yylex_destroy();
-extern Decl    *root;
+/**
+ * Maps the source file into memory followed by at least two zero bytes, the 
+ * end-of-buffer sentinels flex expects. An anonymous zeroed region is reserved first 
+ * and the file is mapped over its start, so the sentinels exist even when the file 
+ * ends on a page boundary. The mapping is private and writable because flex 
+ * temporarily NUL-terminates tokens in place. Pipes, FIFOs and other files that are 
+ * not regular report no size and cannot be mapped, so they are read instead.
+ * @param   c               compiler context, records the length of the mapping 
+ * @param   file_name       name of file to map 
+ * @param   size            set to the size of the file in bytes 
+ * @return  ptr to the mapped bytes, NULL on failure 
+ */
+static char *source_map(Compiler *c, const char *file_name, size_t *size){
+    struct stat st;
+    int fd = open(file_name, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) < 0){
+        fprintf(c->err, "%s %s\n", strerror(errno), file_name);
+        if (fd >= 0) close(fd);
+        return NULL;
+    }
+    if (!S_ISREG(st.st_mode)) return source_read(c, fd, file_name, size);
+
+    size_t page = sysconf(_SC_PAGESIZE);
+    *size = st.st_size;
+    c->source_length = (*size + 2 + page - 1) / page * page;
+
+    char *base = mmap(NULL, c->source_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED || (*size && mmap(base, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)){
+        fprintf(c->err, "%s %s\n", strerror(errno), file_name);
+        if (base != MAP_FAILED) munmap(base, c->source_length);
+        close(fd);
+        return NULL;
+    }
+    close(fd);
 
-/* Helper Functions */
+    if (*size) madvise(base, *size, MADV_SEQUENTIAL);
+    return base;
+}
+
+/**
+ * Reads a source that cannot be mapped to EOF into a heap buffer followed by two 
+ * zero bytes. A source_length of 0 tells unload to free the buffer. Closes fd.
+ * @param   c               compiler context, records that the source was read 
+ * @param   fd              open descriptor of the source 
+ * @param   file_name       name of file, for error messages 
+ * @param   size            set to the number of bytes read 
+ * @return  ptr to the bytes read, NULL on failure 
+ */
+static char *source_read(Compiler *c, int fd, const char *file_name, size_t *size){
+    size_t capacity = BUFSIZ;
+    char *buffer = safe_malloc(sizeof(char), capacity);
+    ssize_t n;
+
+    *size = 0;
+    while ((n = read(fd, buffer + *size, capacity - *size - 2)) != 0){
+        if (n < 0){
+            if (errno == EINTR) continue;
+            fprintf(c->err, "%s %s\n", strerror(errno), file_name);
+            free(buffer);
+            close(fd);
+            return NULL;
+        }
+        *size += n;
+        if (capacity - *size - 2 == 0){
+            capacity *= 2;
+            buffer = realloc(buffer, capacity);
+            MALLOC_CHECK(buffer);
+        }
+    }
+    close(fd);
+
+    buffer[*size] = buffer[*size + 1] = 0;
+    c->source_length = 0;
+    return buffer;
+}
 
 /**
- * Handles common setup: opens the file and sets up the scanner.
+ * Handles common setup: binds c to this thread, maps the file (unless it was loaded 
+ * ahead of the stage) and points a new scanner at the mapped bytes.
+ * @param c         compiler context to set up 
  * @param file_name name of file to open
  * @return True on successful setup, otherwise false.
  */
-static bool setup_compiler(const char *file_name) {
+static bool setup_compiler(Compiler *c, const char *file_name) {
     if (!file_name) {
-        fprintf(stderr, "Error: Filename is NULL.\n");
+        fprintf(c->err, "Error: Filename is NULL.\n");
         return false;
     }
 
-    yyin = safe_fopen(file_name, "r");
-    if (!yyin) return false; 
-    yyrestart(yyin);
+    if (!load(c, file_name)) return false;
+    yylex_init_extra(c, &c->scanner);
+    if (!yy_scan_buffer(c->source, c->source_size + 2, c->scanner)) {
+        fprintf(c->err, "Error: Unable to scan %s.\n", file_name);
+        return false;
+    }
     return true;
 }
 
 /**
- * Handles common cleanup: destroys AST, closes file, and destroys scanner state.
- * @param destroy_ast True if the root AST node (root) should be destroyed.
+ * Parses file_name into c->root, or with --load-ast-bin loads the binary AST in it 
+ * @param   c               compiler context to parse into 
+ * @param   file_name       name of file to open 
+ * @return  True if the file parsed, otherwise false 
+ */
+static bool compiler_parse(Compiler *c, const char *file_name){
+    bool exit_code;
+    report_begin(c, REPORT_LOAD);
+    if (c->options.ast_bin){
+        exit_code = load(c, file_name);
+        report_begin(c, REPORT_PARSE);
+        exit_code = exit_code && ast_bin_load(c->source, c->source_size, &c->root);
+    } else {
+        exit_code = setup_compiler(c, file_name);
+        report_begin(c, REPORT_PARSE);
+        exit_code = exit_code && yyparse(c->scanner, c) == 0;
+    }
+    unload(c);
+    report_end(c);
+    report_nodes(c, c->root);
+    return exit_code;
+}
+
+/**
+ * Builds the assembly path for a source file: output_dir/<name without .bminor>.s 
+ * @param   output_dir      directory assembly files are written to 
+ * @param   file_name       Bminor source file 
+ * @return  malloc'd path 
+ */
+static char *batch_output_path(const char *output_dir, const char *file_name){
+    const char *base = strrchr(file_name, '/');
+    base = base ? base + 1 : file_name;
+
+    size_t length = strlen(base);
+    size_t suffix = strlen(".bminor");
+    if (length > suffix && streq(base + length - suffix, ".bminor")) length -= suffix;
+
+    size_t size = strlen(output_dir) + length + 4;
+    char *path = safe_malloc(sizeof(char), size);
+    snprintf(path, size, "%s/%.*s.s", output_dir, (int)length, base);
+    return path;
+}
+
+/**
+ * Checks that no two units of a batch write the same assembly file, as sources with
+ * the same name in different directories would
+ * @param   units       batch units with their output paths 
+ * @param   count       number of units 
+ * @return  true if every output path is distinct, otherwise false 
+ */
+static bool batch_check_outputs(Batch_unit *units, int count){
+    // output path -> first unit writing it 
+    struct hash_table *outputs = hash_table_create(0, 0);
+    MALLOC_CHECK(outputs);
+
+    bool distinct = true;
+    for (int i = 0; i < count; i++){
+        Batch_unit *first = hash_table_lookup(outputs, units[i].output);
+        if (first){
+            fprintf(stderr, "Failed: %s and %s would both be written to %s\n", first->source,
+                    units[i].source, units[i].output);
+            distinct = false;
+        } else {
+            hash_table_insert(outputs, units[i].output, &units[i]);
+        }
+    }
+    hash_table_delete(outputs);
+    return distinct;
+}
+
+/**
+ * Pool task: compiles one unit of a batch with its own compiler context. Messages 
+ * are buffered so they can be printed in input order, and fatal errors end only 
+ * this unit.
+ * @param   arg         Batch 
+ * @param   index       unit to compile 
  */
-static void cleanup_compiler(bool destroy_ast) {
-    if (destroy_ast && root) {
-        decl_destroy(root);
-        root = NULL; 
+static void batch_compile(void *arg, size_t index){
+    Batch *b = arg;
+    Batch_unit *u = &b->units[index];
+    Compiler *c = compiler_create(b->options);
+    jmp_buf bail;
+
+    c->out = open_memstream(&u->out, &u->out_size);
+    c->err = open_memstream(&u->err, &u->err_size);
+    MALLOC_CHECK(c->out);
+    MALLOC_CHECK(c->err);
+    c->bail = &bail;
+
+    if (setjmp(bail) == 0){
+        u->status = codegen(c, u->source, u->output);
+    } else {
+        u->status = false;
+        unload(c);
     }
 
-    if (yyin) {
-        fclose(yyin);
-        yyin = NULL;
+    fclose(c->out);
+    fclose(c->err);
+    compiler_destroy(c);
+    compiler_bind(NULL);
+}
+
+/**
+ * Prints the buffered error messages of a unit, each line prefixed with its source file 
+ * @param   u           unit that finished compiling 
+ */
+static void batch_print_errors(Batch_unit *u){
+    const char *line = u->err;
+    const char *end = u->err + u->err_size;
+    while (line < end){
+        const char *newline = memchr(line, '\n', end - line);
+        size_t length = newline ? (size_t)(newline - line) + 1 : (size_t)(end - line);
+        fprintf(stderr, "%s: %.*s", u->source, (int)length, line);
+        if (!newline) fputc('\n', stderr);
+        line += length;
     }
-    yylex_destroy();
 }
 
 /* functions */
@@ -76,7 +294,13 @@ static void cleanup_compiler(bool destroy_ast) {
 void usage(const char *program) {
     // Standard usage format: program [stage] [input file]
     fprintf(stderr, "Usage: %s [options] <Bminor source file>\n", program); 
-    fprintf(stderr, "       %s --codegen <Bminor source file> <assembly output file>\n\n", program); 
+    fprintf(stderr, "       %s [--unroll N] [--threads N] [--incremental] --codegen <Bminor source file> <assembly output file>\n", program); 
+    fprintf(stderr, "       %s [--unroll N] [--threads N] --codegen [-j N] <Bminor source files> -o <output directory>\n", program); 
+    fprintf(stderr, "       %s --emit-ast-bin <Bminor source file> <binary AST output file>\n", program); 
+    fprintf(stderr, "       %s --load-ast-bin <--print | --resolve | --typecheck | --codegen ...> <binary AST file> ...\n", program); 
+    fprintf(stderr, "       %s --cache-stats\n", program); 
+    fprintf(stderr, "       %s --server <socket path>\n", program); 
+    fprintf(stderr, "       %s --client <socket path> <arguments above | --shutdown>\n\n", program); 
     fprintf(stderr, "Options (Choose one stage):\n");
     fprintf(stderr, "   --encode       Reads a file containing a string literal, decodes and re-encodes it.\n");
     fprintf(stderr, "   --scan         Scans the source file and prints a list of tokens.\n");
@@ -85,10 +309,123 @@ void usage(const char *program) {
     fprintf(stderr, "   --resolve       Performs name resolution (semantic check).\n");
     fprintf(stderr, "   --typecheck     Performs type checking (semantic check).\n");
     fprintf(stderr, "   --codegen       Performs code generation on bminor source file\n");
+    fprintf(stderr, "   --emit-ast-bin  Parses the source file and writes its AST in binary to the output file.\n");
+    fprintf(stderr, "\nReport Options:\n");
+    fprintf(stderr, "   --time-report   Print wall and CPU time, allocations, and peak RSS per phase to stderr.\n");
+    fprintf(stderr, "   --time-report=json  The same report as one JSON object.\n");
+    fprintf(stderr, "\nInput Options:\n");
+    fprintf(stderr, "   --load-ast-bin  The input file is a binary AST from --emit-ast-bin: the stage skips parsing.\n");
+    fprintf(stderr, "\nCodegen Options:\n");
+    fprintf(stderr, "   --unroll N      Unroll counted loops N times (default %d, 1 disables).\n", DEFAULT_UNROLL_FACTOR);
+    fprintf(stderr, "   --threads N     Typecheck and generate the functions of a unit on N threads (default %d).\n", DEFAULT_THREADS);
+    fprintf(stderr, "   --incremental   Reuse the code of unchanged functions from the previous output (kept in <output>%s).\n", FINGERPRINT_SUFFIX);
+    fprintf(stderr, "   -j N            Compile N source files at a time (default 1).\n");
+    fprintf(stderr, "   -o DIR          Write <name>.s for each source file into DIR.\n");
+    fprintf(stderr, "\nCache Options (set %s to cache generated assembly):\n", CACHE_DIR_ENV);
+    fprintf(stderr, "   --cache-stats   Print the hits, misses, and size of the cache.\n");
+    fprintf(stderr, "   %s  Bytes kept before least recently used entries are evicted.\n", CACHE_SIZE_ENV);
+    fprintf(stderr, "\nServer Options:\n");
+    fprintf(stderr, "   --server SOCK   Serve compile requests on a Unix socket, keeping typechecked units warm.\n");
+    fprintf(stderr, "   --client SOCK   Run the stage on the server at SOCK (batch, --encode, binary ASTs, and reports run locally).\n");
+    fprintf(stderr, "   --shutdown      Sent with --client: stop the server.\n");
     fprintf(stderr, "\nGeneral Options:\n");
     fprintf(stderr, "   -h or --help    Print this help message.\n");
 }
 
+/**
+ * Parses the options that come before the stage (--unroll N, --threads N, 
+ * --incremental, --load-ast-bin, --time-report[=json])
+ * @param   argc        number of arguments 
+ * @param   argv        arguments, argv[0] is the program 
+ * @param   options     options to fill in 
+ * @param   err         stream to report invalid values to 
+ * @return  index of the first argument after the options, -1 if a value is invalid 
+ */
+int options_parse(int argc, const char *argv[], Options *options, FILE *err){
+    int argind = 1;
+    while (argind < argc && (streq(argv[argind], "--unroll") || streq(argv[argind], "--threads") || 
+                             streq(argv[argind], "--incremental") || streq(argv[argind], "--load-ast-bin") ||
+                             streq(argv[argind], "--time-report") || streq(argv[argind], "--time-report=json"))){
+        const char *option = argv[argind];
+        if (streq(option, "--incremental") || streq(option, "--load-ast-bin")){
+            if (streq(option, "--incremental")) options->incremental = true;
+            else options->ast_bin = true;
+            argind++;
+            continue;
+        }
+        if (streq(option, "--time-report") || streq(option, "--time-report=json")){
+            options->time_report = streq(option, "--time-report") ? REPORT_TEXT : REPORT_JSON;
+            argind++;
+            continue;
+        }
+        char *end = NULL;
+        long value = argind + 1 < argc ? strtol(argv[argind + 1], &end, 10) : 0;
+        if (value < 1 || *end){
+            fprintf(err, "Failed: %s expects a positive integer\n", option);
+            return -1;
+        }
+        if (streq(option, "--unroll")){
+            options->unroll_factor = value;
+        } else {
+            options->threads = value;
+        }
+        argind += 2;
+    }
+    return argind;
+}
+
+/**
+ * Binds c to this thread and maps a source file into it. A stage run on c afterwards 
+ * scans the loaded bytes instead of opening the file again.
+ * @param   c               compiler context 
+ * @param   file_name       name of file to map 
+ * @return  True if the file is loaded, otherwise false 
+ */
+bool load(Compiler *c, const char *file_name){
+    compiler_bind(c);
+    if (c->source) return true;
+    c->source = source_map(c, file_name, &c->source_size);
+    return c->source != NULL;
+}
+
+/**
+ * Loads a source file like load, but keeps quiet if it cannot be read: the stage 
+ * run afterwards reports the failure the usual way. 
+ * @param   c               compiler context 
+ * @param   file_name       name of file to map 
+ * @return  True if the file is loaded, otherwise false 
+ */
+bool load_quiet(Compiler *c, const char *file_name){
+    FILE *err = c->err;
+    char *message = NULL;
+    size_t size = 0;
+    c->err = open_memstream(&message, &size);
+    MALLOC_CHECK(c->err);
+    bool loaded = load(c, file_name);
+    fclose(c->err);
+    free(message);
+    c->err = err;
+    return loaded;
+}
+
+/**
+ * Handles common cleanup: destroys scanner state and unmaps (or frees) the source. 
+ * Literals and identifiers were copied into c, so the AST outlives the source.
+ * @param c         compiler context to clean up 
+ */
+void unload(Compiler *c) {
+    if (c->scanner) {
+        yylex_destroy(c->scanner);
+        c->scanner = NULL;
+    }
+    if (c->source) {
+        if (c->source_length) munmap(c->source, c->source_length);
+        else free(c->source);
+        c->source = NULL;
+        c->source_size = 0;
+    }
+}
+
 /**
  * Reads in file containing a string literal, then decodes and encodes the string
  * @param   s       name of file to open
@@ -123,16 +460,28 @@ bool encode(const char *file_name){
 
 /**
  * Reads in file and scans the code and tokenizes it
+ * @param   c               compiler context 
  * @param   file_name       name of file to open
  * @return  True if able to scan and tokenize, otherwise false 
  **/
-bool scan(const char *file_name){
-    if (!setup_compiler(file_name)) return false;
+bool scan(Compiler *c, const char *file_name){
+    if (c->options.ast_bin){
+        fprintf(c->err, "Error: a binary AST has no tokens to scan\n");
+        return false;
+    }
+    report_begin(c, REPORT_LOAD);
+    if (!setup_compiler(c, file_name)) {
+        unload(c);
+        report_end(c);
+        return false;
+    }
     
     bool exit_code = true;
     size_t t;
+    YYSTYPE lval;
+    report_begin(c, REPORT_SCAN);
 
-    while ((t = yylex()) != 0) {
+    while ((t = yylex(&lval, c->scanner)) != 0) {
         switch (t){
             case TOKEN_STRING_LITERAL:
             case TOKEN_CHAR_LITERAL:
@@ -142,131 +491,287 @@ bool scan(const char *file_name){
             case TOKEN_HEXIDECIMAL_LITERAL:
             case TOKEN_BINARY_LITERAL:
             case TOKEN_IDENTIFIER:
-                printf("token: %-32s  text: %s\n", token_names[t % 258], yytext);
+                fprintf(c->out, "token: %-32s  text: %s\n", token_names[t % 258], yyget_text(c->scanner));
                 break;
             case TOKEN_ERROR:
-                printf("scan error: %s is not valid\n", yytext);
+                fprintf(c->out, "scan error: %s is not valid\n", yyget_text(c->scanner));
                 break;
             default:
-                printf("token: %-30s\n" , token_names[t % 258]);
+                fprintf(c->out, "token: %-30s\n" , token_names[t % 258]);
                 break;
         }
 
         if (t == TOKEN_ERROR) exit_code = false;
     }
     
-    cleanup_compiler(false);
+    unload(c);
+    report_end(c);
     return exit_code;
 }
 
 /**
  * Reads in file and parses the file to see if it fits in the 
  * grammar for Bminor  
+ * @param   c               compiler context 
  * @param   file_name       name of file to open
  * @return  True if able to scan & parse, otherwise false 
  **/
-bool parse(const char *file_name){
-    if (!setup_compiler(file_name)) return false;
-
+bool parse(Compiler *c, const char *file_name){
     bool exit_code = true;
-    if(yyparse() == 0){
-        printf("Prase Successful\n");
+    if(compiler_parse(c, file_name)){
+        fprintf(c->out, "Prase Successful\n");
     } else {
-        fprintf(stderr, "Parse Error\n");
+        fprintf(c->err, "Parse Error\n");
         exit_code = false;
     }
 
-    cleanup_compiler(true);
     return exit_code;
 }
 
 /**
  * Reads in File, parses File then pretty prints out the program
+ * @param   c               compiler context 
  * @param   file_name       name of file to open 
  * @return  True if valid parse and able to pretty print, otherwise false 
  */
-bool pretty_print(const char *file_name){
-    if (!setup_compiler(file_name)) return false;
-
+bool pretty_print(Compiler *c, const char *file_name){
     bool exit_code = true;
-    if(yyparse() == 0){
-        decl_print(root, 0);
+    if(compiler_parse(c, file_name)){
+        decl_print(c->root, 0);
     } else {
-        fprintf(stderr, "Parse Error\n");
+        fprintf(c->err, "Parse Error\n");
         exit_code = false;
     }
 
-    cleanup_compiler(true);
     return exit_code;
 }
 
+/**
+ * Parses file_name and writes the AST as a binary AST, so later stages run with 
+ * --load-ast-bin skip scanning and parsing 
+ * @param   c               compiler context 
+ * @param   file_name       name of file to open 
+ * @param   file_output     binary AST file to write 
+ * @return  True if parsed and written, otherwise false 
+ */
+bool emit_ast_bin(Compiler *c, const char *file_name, const char *file_output){
+    if (!compiler_parse(c, file_name)){
+        fprintf(c->err, "Parse Error\n");
+        return false;
+    }
+    return ast_bin_write(c->root, file_output);
+}
+
 /**
  * Reads in file, parses File then does name resolution for all decls, stmts, and exprs 
+ * @param   c               compiler context 
  * @param   file_name       name of file to open 
- * @param   cleanup         cleanup after calling resolve
  * @return  True if valid parse and able to resolve,  otherwise false 
  **/
-bool resolve(const char *file_name, bool cleanup){
-    if (!setup_compiler(file_name)) return false;
-
+bool resolve(Compiler *c, const char *file_name){
     bool exit_code = true;
-    if(yyparse() == 0){
+    if(compiler_parse(c, file_name)){
+        report_begin(c, REPORT_RESOLVE);
         scope_enter(); 
-        decl_resolve(root);
+        decl_resolve(c->root);
         scope_exit();
-        exit_code = b_ctx.resolver_errors != 0 ? false : true;
+        report_end(c);
+        exit_code = c->resolver_errors != 0 ? false : true;
     } else {
-        fprintf(stderr, "Parse Error\n");
+        fprintf(c->err, "Parse Error\n");
         exit_code = false;
     }
 
-    cleanup_compiler(cleanup);
     return exit_code;
 }
 
 /**
  * Resolves program and computes typechecking for each expression ensuring compatibility 
+ * @param   c               compiler context 
  * @param   file_name       Bminor source file to typecheck
- * @param   cleanup         cleanup after calling typechecking  
  * @return  true if valid types for each expression, otherwise false
  */
-bool typecheck(const char *file_name, bool cleanup){
+bool typecheck(Compiler *c, const char *file_name){
     bool exit_code = true;
-    if (resolve(file_name, false)){
-        decl_typecheck(root);
-        exit_code = b_ctx.typechecker_errors != 0 ? false : true;
+    if (resolve(c, file_name)){
+        report_begin(c, REPORT_TYPECHECK);
+        decl_typecheck_program(c->root);
+        report_end(c);
+        exit_code = c->typechecker_errors != 0 ? false : true;
     } else {
-        fprintf(stderr, "Resolver Error\n");
+        fprintf(c->err, "Resolver Error\n");
         exit_code = false;
     }
 
-    cleanup_compiler(cleanup);
     return exit_code;
 }
 
 
 /**
- * Ensures program passed is valid Bminor, if so code generation takes place 
+ * Ensures program passed is valid Bminor, if so code generation takes place. With 
+ * BMINOR_CACHE_DIR set, a source compiled before is served from the cache. 
+ * @param   c               compiler context 
  * @param   file_name       Bminor source file to typecheck
  * @param   file_output     File to write code generation to 
  * @return  true if code generation is successful, otherwise false 
  */
-bool codegen(const char *file_name, const char *file_output){
-    bool exit_code = true;
+bool codegen(Compiler *c, const char *file_name, const char *file_output){
+    Cache cache;
+    if (!cache_open(&cache) || !load_quiet(c, file_name)){
+        return codegen_unit(c, typecheck(c, file_name), file_output);
+    }
 
-    if (typecheck(file_name, false)){
-        FILE *output = safe_fopen(file_output, "w");
-        if (!output) return false; 
-        decl_codegen(root, output);
-        string_print(output);
+    // a hit skips scanning and parsing entirely 
+    cache_key(&cache, c->source, c->source_size, &c->options);
+    if (cache_fetch(&cache, file_output, c->out, c->err)){
+        unload(c);
+        return true;
+    }
+
+    // successful compiles are stored along with the messages they printed 
+    FILE *out = c->out, *err = c->err;
+    char *out_text = NULL, *err_text = NULL;
+    size_t out_size = 0, err_size = 0;
+    c->out = open_memstream(&out_text, &out_size);
+    c->err = open_memstream(&err_text, &err_size);
+    MALLOC_CHECK(c->out);
+    MALLOC_CHECK(c->err);
+
+    jmp_buf bail;
+    jmp_buf *outer = c->bail;
+    c->bail = &bail;
+    bool failed = setjmp(bail) != 0;
+    bool exit_code = !failed && codegen_unit(c, typecheck(c, file_name), file_output);
+    c->bail = outer;
+
+    fclose(c->out);
+    fclose(c->err);
+    c->out = out;
+    c->err = err;
+    fwrite(out_text, 1, out_size, out);
+    fwrite(err_text, 1, err_size, err);
+    if (exit_code) cache_store(&cache, file_output, out_text, out_size, err_text, err_size);
+    free(out_text);
+    free(err_text);
+    if (failed) compiler_abort();
+
+    return exit_code;
+}
+
+/**
+ * Generates code for a unit typecheck already ran on. Codegen state is reset first, 
+ * so a typechecked unit can be generated more than once.
+ * @param   c               compiler context holding the typechecked program 
+ * @param   typechecked     result of typecheck on c 
+ * @param   file_output     File to write code generation to 
+ * @return  true if code generation is successful, otherwise false 
+ */
+bool codegen_unit(Compiler *c, bool typechecked, const char *file_output){
+    if (!typechecked){
+        fprintf(c->err, "Typechecker Error\n");
+        return false;
+    }
 
-        exit_code = b_ctx.codegen_errors != 0 ? false : true;
-        fclose(output);
+    // the previous output is read before it is overwritten 
+    compiler_bind(c);
+    Fingerprints *fp = c->options.incremental ? fingerprints_load(file_output, cache_compiler_key(&c->options)) : NULL;
+    FILE *output = fopen(file_output, "w");
+    if (!output){
+        fprintf(c->err, "%s %s\n", strerror(errno), file_output);
+        fingerprints_destroy(fp);
+        return false;
+    }
+    // offsets are only meaningful in a regular file 
+    if (fp && ftell(output) < 0){
+        fingerprints_destroy(fp);
+        fingerprints_remove(file_output);
+        fp = NULL;
+    }
+    c->fingerprints = fp;
+    c->data_flag = c->text_flag = false;
+    c->label_count = c->string_count = 0;
+    c->codegen_errors = 0;
+
+    // nodes codegen makes up (print and bounds-check calls, unroll guards) go to an
+    // arena freed below, so generating a warm unit again does not grow its AST arena 
+    Arena *ast_arena = c->arena;
+    c->arena = arena_create();
+
+    // fatal errors close the output before unwinding further 
+    jmp_buf bail;
+    jmp_buf *outer = c->bail;
+    c->bail = &bail;
+    bool failed = setjmp(bail) != 0;
+    if (!failed){
+        report_begin(c, REPORT_CODEGEN);
+        decl_reachability(c->root);
+        decl_codegen_program(c->root, output);
+        loop_analysis_destroy();
+        report_begin(c, REPORT_STRINGS);
+        string_print(output);
+        report_end(c);
     } else {
-        fprintf(stderr, "Typechecker Error\n");
-        exit_code = false;
+        loop_analysis_destroy();
+        string_lit_destroy();
+    }
+    c->bail = outer;
+    c->fingerprints = NULL;
+    fclose(output);
+    arena_destroy(c->arena);
+    c->arena = ast_arena;
+
+    // a failed build leaves no fingerprints, so the next one starts from scratch 
+    if (fp && !failed && c->codegen_errors == 0){
+        fingerprints_save(fp, file_output);
+    } else if (fp){
+        fingerprints_remove(file_output);
     }
+    fingerprints_destroy(fp);
+    if (failed) compiler_abort();
 
-    cleanup_compiler(true);
+    return c->codegen_errors == 0;
+}
+
+/**
+ * Compiles many source files into output_dir, jobs units at a time. Each unit gets 
+ * its own compiler context; messages are printed per file in input order once every 
+ * unit has finished, errors prefixed with their source file. Nothing is compiled if
+ * two sources would write the same output file.
+ * @param   file_names      Bminor source files 
+ * @param   count           number of source files 
+ * @param   output_dir      directory to write <name>.s files to (created if missing)
+ * @param   jobs            number of threads compiling units 
+ * @param   options         compiler options for every unit 
+ * @return  true if every unit compiled, otherwise false 
+ */
+bool codegen_batch(const char **file_names, int count, const char *output_dir, int jobs, const Options *options){
+    if (mkdir(output_dir, 0777) < 0 && errno != EEXIST){
+        fprintf(stderr, "%s %s\n", strerror(errno), output_dir);
+        return false;
+    }
+
+    Batch batch = { .options = options };
+    batch.units = safe_calloc(sizeof(Batch_unit), count);
+    for (int i = 0; i < count; i++){
+        batch.units[i].source = file_names[i];
+        batch.units[i].output = batch_output_path(output_dir, file_names[i]);
+    }
+
+    bool exit_code = batch_check_outputs(batch.units, count);
+    if (exit_code) pool_run(jobs, count, batch_compile, &batch);
+
+    for (int i = 0; i < count; i++){
+        Batch_unit *u = &batch.units[i];
+        if (u->out) fwrite(u->out, 1, u->out_size, stdout);
+        fflush(stdout);
+        if (u->err) batch_print_errors(u);
+        if (!u->status) exit_code = false;
+
+        free(u->out);
+        free(u->err);
+        free(u->output);
+    }
+
+    free(batch.units);
     return exit_code;
-}
\ No newline at end of file
+}
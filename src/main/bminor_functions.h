@@ -6,15 +6,24 @@
 #include <stdio.h>
 #include <stdbool.h>
 
+#include "bminor_context.h"
+
 /* Functions */
 
 void     usage(const char *program);
+int      options_parse(int argc, const char *argv[], Options *options, FILE *err);
+bool     load(Compiler *c, const char *file_name);
+bool     load_quiet(Compiler *c, const char *file_name);
+void     unload(Compiler *c);
 bool     encode(const char *file_name);
-bool     scan(const char *file_name);
-bool     parse(const char *file_name);
-bool     pretty_print(const char *file_name);
-bool     resolve(const char *file_name, bool cleanup);
-bool     typecheck(const char *file_name, bool cleanup);
-bool     codegen(const char *file_name, const char *file_output);
+bool     scan(Compiler *c, const char *file_name);
+bool     parse(Compiler *c, const char *file_name);
+bool     pretty_print(Compiler *c, const char *file_name);
+bool     emit_ast_bin(Compiler *c, const char *file_name, const char *file_output);
+bool     resolve(Compiler *c, const char *file_name);
+bool     typecheck(Compiler *c, const char *file_name);
+bool     codegen(Compiler *c, const char *file_name, const char *file_output);
+bool     codegen_unit(Compiler *c, bool typechecked, const char *file_output);
+bool     codegen_batch(const char **file_names, int count, const char *output_dir, int jobs, const Options *options);
 
 #endif 
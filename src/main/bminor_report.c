@@ -0,0 +1,270 @@
+/* bminor_report.c: per-phase time and memory report (--time-report) */
+
+#include "bminor_report.h"
+#include "bminor_context.h"
+#include "decl.h"
+#include "expr.h"
+#include "param_list.h"
+#include "stmt.h"
+#include "type.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <sys/resource.h>
+
+/* Globals */
+
+bool alloc_counting = false;            // safe_* allocations are counted (utils.h)
+size_t alloc_count = 0;
+size_t alloc_bytes = 0;
+
+static const char *report_phases[] = {
+    [REPORT_LOAD]       = "load",
+    [REPORT_SCAN]       = "scan",
+    [REPORT_PARSE]      = "parse",
+    [REPORT_RESOLVE]    = "resolve",
+    [REPORT_TYPECHECK]  = "typecheck",
+    [REPORT_CODEGEN]    = "codegen",
+    [REPORT_STRINGS]    = "strings",
+};
+
+/* Forward declaration of static prototypes */
+
+static double report_seconds(const struct timespec *start, const struct timespec *end);
+static void   report_count_decl(Report_nodes *n, Decl *d);
+static void   report_count_stmt(Report_nodes *n, Stmt *s);
+static void   report_count_expr(Report_nodes *n, Expr *e);
+static void   report_count_type(Report_nodes *n, Type *t);
+static void   report_phase_text(const char *name, Report_phase *p, FILE *out);
+static void   report_phase_json(const char *name, Report_phase *p, FILE *out);
+
+/* Helper Functions */
+
+/**
+ * Computes the time between two clock readings
+ * @param   start   earlier reading
+ * @param   end     later reading
+ * @return  seconds elapsed
+ */
+static double report_seconds(const struct timespec *start, const struct timespec *end){
+    return (end->tv_sec - start->tv_sec) + (end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * Counts the nodes of a decl list
+ * @param   n       counts to add to
+ * @param   d       decl list
+ */
+static void report_count_decl(Report_nodes *n, Decl *d){
+    for (; d; d = d->next){
+        n->decls++;
+        report_count_type(n, d->type);
+        report_count_expr(n, d->value);
+        report_count_stmt(n, d->code);
+    }
+}
+
+/**
+ * Counts the nodes of a statement list
+ * @param   n       counts to add to
+ * @param   s       statement list
+ */
+static void report_count_stmt(Report_nodes *n, Stmt *s){
+    for (; s; s = s->next){
+        n->stmts++;
+        report_count_decl(n, s->decl);
+        report_count_expr(n, s->init_expr);
+        report_count_expr(n, s->expr);
+        report_count_expr(n, s->next_expr);
+        report_count_stmt(n, s->body);
+        report_count_stmt(n, s->else_body);
+    }
+}
+
+/**
+ * Counts the nodes of an expression
+ * @param   n       counts to add to
+ * @param   e       expression
+ */
+static void report_count_expr(Report_nodes *n, Expr *e){
+    if (!e) return;
+    n->exprs++;
+    report_count_expr(n, e->left);
+    report_count_expr(n, e->right);
+}
+
+/**
+ * Counts the nodes of a type, including its parameters
+ * @param   n       counts to add to
+ * @param   t       type
+ */
+static void report_count_type(Report_nodes *n, Type *t){
+    if (!t) return;
+    n->types++;
+    for (Param_list *p = t->params; p; p = p->next){
+        n->params++;
+        report_count_type(n, p->type);
+    }
+    report_count_type(n, t->subtype);
+    report_count_expr(n, t->arr_len);
+}
+
+/**
+ * Prints one row of the text report
+ * @param   name    phase name
+ * @param   p       phase measurements
+ * @param   out     stream to print to
+ */
+static void report_phase_text(const char *name, Report_phase *p, FILE *out){
+    fprintf(out, "%-10s %10.3f %10.3f %10zu %12zu %10zu %12zu %10ld\n", name, p->wall * 1e3, p->cpu * 1e3,
+            p->allocations, p->bytes, p->arena_allocations, p->arena_bytes, p->peak_rss);
+}
+
+/**
+ * Prints one phase of the JSON report
+ * @param   name    phase name
+ * @param   p       phase measurements
+ * @param   out     stream to print to
+ */
+static void report_phase_json(const char *name, Report_phase *p, FILE *out){
+    fprintf(out, "{\"name\": \"%s\", \"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"allocations\": %zu, \"bytes\": %zu, "
+                 "\"arena_allocations\": %zu, \"arena_bytes\": %zu, \"peak_rss_kb\": %ld}",
+            name, p->wall * 1e3, p->cpu * 1e3, p->allocations, p->bytes, p->arena_allocations, p->arena_bytes, p->peak_rss);
+}
+
+/* Functions */
+
+/**
+ * Creates an empty report and starts counting safe_* allocations
+ * @return  ptr to report
+ */
+Report *report_create(){
+    Report *r = safe_calloc(sizeof(Report), 1);
+    r->open = -1;
+    alloc_counting = true;
+    return r;
+}
+
+/**
+ * Starts measuring a phase of c (no-op without --time-report). A phase still open
+ * is ended first.
+ * @param   c       compiler context
+ * @param   phase   phase about to run
+ */
+void report_begin(Compiler *c, report_phase_t phase){
+    Report *r = c->report;
+    if (!r) return;
+    report_end(c);
+    r->open = phase;
+    r->allocations_start = __atomic_load_n(&alloc_count, __ATOMIC_RELAXED);
+    r->bytes_start = __atomic_load_n(&alloc_bytes, __ATOMIC_RELAXED);
+    r->arena_allocations_start = c->arena->allocations;
+    r->arena_bytes_start = c->arena->bytes;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &r->cpu_start);
+    clock_gettime(CLOCK_MONOTONIC, &r->wall_start);
+}
+
+/**
+ * Ends the phase being measured, adding to its totals (no-op if none is open)
+ * @param   c       compiler context
+ */
+void report_end(Compiler *c){
+    Report *r = c->report;
+    if (!r || r->open < 0) return;
+    struct timespec wall, cpu;
+    clock_gettime(CLOCK_MONOTONIC, &wall);
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu);
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    Report_phase *p = &r->phases[r->open];
+    p->ran = true;
+    p->wall += report_seconds(&r->wall_start, &wall);
+    p->cpu += report_seconds(&r->cpu_start, &cpu);
+    p->allocations += __atomic_load_n(&alloc_count, __ATOMIC_RELAXED) - r->allocations_start;
+    p->bytes += __atomic_load_n(&alloc_bytes, __ATOMIC_RELAXED) - r->bytes_start;
+    p->arena_allocations += c->arena->allocations - r->arena_allocations_start;
+    p->arena_bytes += c->arena->bytes - r->arena_bytes_start;
+    p->peak_rss = usage.ru_maxrss;
+    r->open = -1;
+}
+
+/**
+ * Records the size of the parsed program (no-op without --time-report)
+ * @param   c       compiler context
+ * @param   root    global decl list
+ */
+void report_nodes(Compiler *c, Decl *root){
+    Report *r = c->report;
+    if (!r) return;
+    r->nodes = (Report_nodes){0};
+    report_count_decl(&r->nodes, root);
+    r->names = intern_count(&c->names);
+}
+
+/**
+ * Prints the phases that ran, their total, and the size of the program
+ * @param   r           report
+ * @param   file_name   file the stage ran on
+ * @param   format      REPORT_TEXT or REPORT_JSON
+ * @param   out         stream to print to
+ */
+void report_print(Report *r, const char *file_name, int format, FILE *out){
+    Report_phase total = {0};
+    for (int i = 0; i < REPORT_PHASES; i++){
+        Report_phase *p = &r->phases[i];
+        if (!p->ran) continue;
+        total.wall += p->wall;
+        total.cpu += p->cpu;
+        total.allocations += p->allocations;
+        total.bytes += p->bytes;
+        total.arena_allocations += p->arena_allocations;
+        total.arena_bytes += p->arena_bytes;
+        if (p->peak_rss > total.peak_rss) total.peak_rss = p->peak_rss;
+    }
+    Report_nodes *n = &r->nodes;
+
+    if (format == REPORT_JSON){
+        fprintf(out, "{\"file\": \"");
+        for (const char *s = file_name; *s; s++){
+            if (*s == '"' || *s == '\\') fputc('\\', out);
+            fputc(*s, out);
+        }
+        fprintf(out, "\", \"phases\": [");
+        bool first = true;
+        for (int i = 0; i < REPORT_PHASES; i++){
+            if (!r->phases[i].ran) continue;
+            fprintf(out, first ? "" : ", ");
+            report_phase_json(report_phases[i], &r->phases[i], out);
+            first = false;
+        }
+        fprintf(out, "], \"total\": ");
+        report_phase_json("total", &total, out);
+        fprintf(out, ", \"nodes\": {\"decls\": %zu, \"stmts\": %zu, \"exprs\": %zu, \"types\": %zu, \"params\": %zu, \"names\": %zu}}\n",
+                n->decls, n->stmts, n->exprs, n->types, n->params, r->names);
+        return;
+    }
+
+    fprintf(out, "Time report for %s\n", file_name);
+    fprintf(out, "%-10s %10s %10s %10s %12s %10s %12s %10s\n", "phase", "wall ms", "cpu ms", "allocs", "bytes",
+            "arena", "arena bytes", "peak KiB");
+    for (int i = 0; i < REPORT_PHASES; i++){
+        if (r->phases[i].ran) report_phase_text(report_phases[i], &r->phases[i], out);
+    }
+    report_phase_text("total", &total, out);
+    fprintf(out, "AST: %zu decls, %zu stmts, %zu exprs, %zu types, %zu params, %zu names\n",
+            n->decls, n->stmts, n->exprs, n->types, n->params, r->names);
+}
+
+/**
+ * Frees a report and stops counting allocations
+ * @param   r       report to free (NULL allowed)
+ */
+void report_destroy(Report *r){
+    if (!r) return;
+    alloc_counting = false;
+    free(r);
+}
@@ -0,0 +1,80 @@
+/* bminor_report.h: per-phase time and memory report (--time-report) */
+
+#ifndef BMINOR_REPORT_H
+#define BMINOR_REPORT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <time.h>
+
+/* Forward Declaration */
+
+typedef struct Decl Decl;
+typedef struct Compiler Compiler;
+
+/* Macros */
+
+#define REPORT_TEXT     1               // Options.time_report: table on stderr
+#define REPORT_JSON     2               // Options.time_report: one JSON object on stderr
+
+/* Structure */
+
+typedef enum {
+    REPORT_LOAD,                        // map the file and set up the scanner
+    REPORT_SCAN,                        // --scan
+    REPORT_PARSE,                       // yyparse, or loading a binary AST
+    REPORT_RESOLVE,                     // decl_resolve
+    REPORT_TYPECHECK,                   // decl_typecheck_program
+    REPORT_CODEGEN,                     // decl_codegen_program
+    REPORT_STRINGS,                     // string_print
+    REPORT_PHASES,
+} report_phase_t;
+
+typedef struct Report_phase Report_phase;
+
+struct Report_phase {
+    bool ran;
+    double wall;                        // seconds, monotonic clock
+    double cpu;                         // seconds of process CPU (every thread)
+    size_t allocations;                 // safe_* allocations
+    size_t bytes;                       // bytes requested from safe_*
+    size_t arena_allocations;           // nodes and literals allocated in the unit's arena
+    size_t arena_bytes;
+    long peak_rss;                      // KiB, at the end of the phase
+};
+
+typedef struct Report_nodes Report_nodes;
+
+struct Report_nodes {
+    size_t decls;
+    size_t stmts;
+    size_t exprs;
+    size_t types;
+    size_t params;
+};
+
+typedef struct Report Report;
+
+struct Report {
+    Report_phase phases[REPORT_PHASES];
+    int open;                           // phase being measured, -1 if none
+    struct timespec wall_start;
+    struct timespec cpu_start;
+    size_t allocations_start;
+    size_t bytes_start;
+    size_t arena_allocations_start;
+    size_t arena_bytes_start;
+    Report_nodes nodes;                 // AST size after parsing
+    size_t names;                       // interned identifiers
+};
+
+/* Functions */
+
+Report *report_create();
+void    report_begin(Compiler *c, report_phase_t phase);
+void    report_end(Compiler *c);
+void    report_nodes(Compiler *c, Decl *root);
+void    report_print(Report *r, const char *file_name, int format, FILE *out);
+void    report_destroy(Report *r);
+
+#endif
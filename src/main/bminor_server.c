@@ -0,0 +1,655 @@
+/* bminor_server.c: compile server on a Unix domain socket and its client */
+
+#include "bminor_server.h"
+#include "bminor_functions.h"
+#include "bminor_context.h"
+#include "bminor_cache.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+/* Structure */
+
+typedef struct Server_connection Server_connection;
+
+struct Server_connection {
+    Server *server;
+    int fd;                     // connected client
+};
+
+/* Globals */
+
+static const char *server_stages[] = {
+    [SERVER_SCAN]       = "--scan",
+    [SERVER_PARSE]      = "--parse",
+    [SERVER_PRINT]      = "--print",
+    [SERVER_RESOLVE]    = "--resolve",
+    [SERVER_TYPECHECK]  = "--typecheck",
+    [SERVER_CODEGEN]    = "--codegen",
+};
+
+/* Forward declaration of static prototypes */
+
+static bool          server_write(int fd, const void *data, size_t size);
+static bool          server_read(int fd, void *data, size_t size);
+static bool          server_send(int fd, const char *data, size_t size);
+static char         *server_receive(int fd, size_t *size);
+static int           server_stage(const char *command);
+static bool          server_address(const char *socket_path, struct sockaddr_un *addr);
+static Server_entry *server_lookup(Server *s, server_stage_t stage, const char *source, size_t size);
+static Server_entry *server_build(Server *s, server_stage_t stage, Compiler *c, const char *file_name);
+static Server_entry *server_insert(Server *s, Server_entry *entry);
+static void          server_unlink(Server *s, Server_entry *entry);
+static void          server_release(Server *s, Server_entry *entry);
+static void          server_entry_destroy(Server_entry *entry);
+static bool          server_run_stage(server_stage_t stage, Compiler *c, const char *file_name);
+static bool          server_codegen(Server_entry *entry, const Options *options, const char *file_output, FILE *out, FILE *err);
+static bool          server_request(Server *s, int argc, const char *argv[], FILE *out, FILE *err);
+static void         *server_serve(void *arg);
+static char         *client_path(const char *cwd, const char *path);
+
+/* Helper Functions */
+
+/**
+ * Writes all size bytes to fd
+ * @param   fd      socket
+ * @param   data    bytes to write
+ * @param   size    number of bytes
+ * @return  true if everything was written, otherwise false
+ */
+static bool server_write(int fd, const void *data, size_t size){
+    const char *p = data;
+    while (size){
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+/**
+ * Reads exactly size bytes from fd
+ * @param   fd      socket
+ * @param   data    buffer to fill
+ * @param   size    number of bytes
+ * @return  true if everything was read, otherwise false
+ */
+static bool server_read(int fd, void *data, size_t size){
+    char *p = data;
+    while (size){
+        ssize_t n = read(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+/**
+ * Sends one frame: a 32-bit big-endian length followed by the bytes
+ * @param   fd      socket
+ * @param   data    bytes to send (may be NULL when size is 0)
+ * @param   size    number of bytes
+ * @return  true if the frame was sent, otherwise false
+ */
+static bool server_send(int fd, const char *data, size_t size){
+    uint32_t length = htonl(size);
+    return server_write(fd, &length, sizeof(length)) && server_write(fd, data, size);
+}
+
+/**
+ * Receives one frame sent by server_send
+ * @param   fd      socket
+ * @param   size    set to the number of bytes received
+ * @return  malloc'd NUL-terminated bytes, NULL on failure
+ */
+static char *server_receive(int fd, size_t *size){
+    uint32_t length = 0;
+    if (!server_read(fd, &length, sizeof(length))) return NULL;
+    length = ntohl(length);
+    if (length > SERVER_MAX_FRAME) return NULL;
+
+    char *data = safe_malloc(sizeof(char), length + 1);
+    if (!server_read(fd, data, length)){
+        free(data);
+        return NULL;
+    }
+    data[length] = '\0';
+    *size = length;
+    return data;
+}
+
+/**
+ * Maps a stage flag to the stage the server runs
+ * @param   command     stage flag (e.g --typecheck)
+ * @return  server_stage_t of the flag, -1 if the server does not run it
+ */
+static int server_stage(const char *command){
+    for (size_t i = 0; i < sizeof(server_stages) / sizeof(server_stages[0]); i++){
+        if (streq(command, server_stages[i])) return i;
+    }
+    return -1;
+}
+
+/**
+ * Fills in the socket address for a path
+ * @param   socket_path     path of the Unix domain socket
+ * @param   addr            address to fill in
+ * @return  true if the path fits in an address, otherwise false
+ */
+static bool server_address(const char *socket_path, struct sockaddr_un *addr){
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr->sun_path)){
+        fprintf(stderr, "Failed: socket path too long %s\n", socket_path);
+        return false;
+    }
+    strcpy(addr->sun_path, socket_path);
+    return true;
+}
+
+/**
+ * Finds the cached result of a stage for the source bytes and takes a reference to it
+ * @param   s           server
+ * @param   stage       stage the result belongs to
+ * @param   source      source bytes
+ * @param   size        number of source bytes
+ * @return  entry (release with server_release), NULL on a miss
+ */
+static Server_entry *server_lookup(Server *s, server_stage_t stage, const char *source, size_t size){
+    uint64_t hash = cache_hash(CACHE_HASH_SEED, source, size);
+    pthread_mutex_lock(&s->lock);
+    Server_entry *entry = s->head;
+    while (entry && !(entry->stage == stage && entry->hash == hash && entry->source_size == size &&
+                      memcmp(entry->source, source, size) == 0)){
+        entry = entry->next;
+    }
+    if (entry){
+        entry->users++;
+        server_unlink(s, entry);
+        server_insert(s, entry);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return entry;
+}
+
+/**
+ * Runs a stage on c and records its result and messages in a new entry, which is
+ * cached unless the stage aborted. Typecheck entries keep c as their unit, other
+ * entries destroy it.
+ * @param   s           server
+ * @param   stage       stage to run
+ * @param   c           compiler context with the source loaded
+ * @param   file_name   Bminor source file
+ * @return  entry holding the result (release with server_release)
+ */
+static Server_entry *server_build(Server *s, server_stage_t stage, Compiler *c, const char *file_name){
+    Server_entry *entry = safe_calloc(sizeof(Server_entry), 1);
+    entry->stage = stage;
+    entry->hash = cache_hash(CACHE_HASH_SEED, c->source, c->source_size);
+    entry->source_size = c->source_size;
+    entry->source = safe_malloc(sizeof(char), c->source_size + 1);
+    memcpy(entry->source, c->source, c->source_size);
+    entry->users = 1;
+    pthread_mutex_init(&entry->lock, NULL);
+
+    c->out = open_memstream(&entry->out, &entry->out_size);
+    c->err = open_memstream(&entry->err, &entry->err_size);
+    MALLOC_CHECK(c->out);
+    MALLOC_CHECK(c->err);
+
+    jmp_buf bail;
+    c->bail = &bail;
+    bool aborted = setjmp(bail) != 0;
+    if (!aborted){
+        entry->status = server_run_stage(stage, c, file_name);
+    } else {
+        unload(c);
+    }
+    c->bail = NULL;
+    fclose(c->out);
+    fclose(c->err);
+    c->out = stdout;
+    c->err = stderr;
+
+    if (stage == SERVER_TYPECHECK && !aborted){
+        entry->unit = c;
+    } else {
+        compiler_destroy(c);
+    }
+    if (aborted){
+        entry->evicted = true;
+        return entry;
+    }
+
+    // another request may have built the same entry meanwhile -> keep the first one
+    Server_entry *existing = server_lookup(s, stage, entry->source, entry->source_size);
+    if (existing){
+        server_entry_destroy(entry);
+        return existing;
+    }
+
+    pthread_mutex_lock(&s->lock);
+    server_insert(s, entry);
+    s->count++;
+    while (s->count > SERVER_CACHE_ENTRIES){
+        Server_entry *last = s->tail;
+        server_unlink(s, last);
+        s->count--;
+        last->evicted = true;
+        if (!last->users) server_entry_destroy(last);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return entry;
+}
+
+/**
+ * Puts an entry at the front of the LRU list (caller holds s->lock)
+ * @param   s       server
+ * @param   entry   entry to insert
+ * @return  entry
+ */
+static Server_entry *server_insert(Server *s, Server_entry *entry){
+    entry->prev = NULL;
+    entry->next = s->head;
+    if (s->head) s->head->prev = entry;
+    s->head = entry;
+    if (!s->tail) s->tail = entry;
+    return entry;
+}
+
+/**
+ * Takes an entry out of the LRU list (caller holds s->lock)
+ * @param   s       server
+ * @param   entry   entry to unlink
+ */
+static void server_unlink(Server *s, Server_entry *entry){
+    if (entry->prev) entry->prev->next = entry->next;
+    else s->head = entry->next;
+    if (entry->next) entry->next->prev = entry->prev;
+    else s->tail = entry->prev;
+    entry->prev = entry->next = NULL;
+}
+
+/**
+ * Drops a reference to an entry, freeing it if it was evicted meanwhile
+ * @param   s       server
+ * @param   entry   entry from server_lookup or server_build
+ */
+static void server_release(Server *s, Server_entry *entry){
+    pthread_mutex_lock(&s->lock);
+    bool destroy = --entry->users == 0 && entry->evicted;
+    pthread_mutex_unlock(&s->lock);
+    if (destroy) server_entry_destroy(entry);
+}
+
+/**
+ * Frees an entry and the unit it holds
+ * @param   entry   entry to free
+ */
+static void server_entry_destroy(Server_entry *entry){
+    if (entry->unit){
+        compiler_destroy(entry->unit);
+        compiler_bind(NULL);
+    }
+    pthread_mutex_destroy(&entry->lock);
+    free(entry->source);
+    free(entry->out);
+    free(entry->err);
+    free(entry);
+}
+
+/**
+ * Runs one CLI stage on c
+ * @param   stage       stage to run (not codegen)
+ * @param   c           compiler context
+ * @param   file_name   Bminor source file
+ * @return  result of the stage
+ */
+static bool server_run_stage(server_stage_t stage, Compiler *c, const char *file_name){
+    switch (stage){
+        case SERVER_SCAN:       return scan(c, file_name);
+        case SERVER_PARSE:      return parse(c, file_name);
+        case SERVER_PRINT:      return pretty_print(c, file_name);
+        case SERVER_RESOLVE:    return resolve(c, file_name);
+        case SERVER_TYPECHECK:  return typecheck(c, file_name);
+        default:                return false;
+    }
+}
+
+/**
+ * Generates code from the typechecked unit of an entry (caller holds entry->lock)
+ * @param   entry           typecheck entry
+ * @param   options         options of the request
+ * @param   file_output     assembly file to write
+ * @param   out             stream for stdout messages
+ * @param   err             stream for stderr messages
+ * @return  true if code generation is successful, otherwise false
+ */
+static bool server_codegen(Server_entry *entry, const Options *options, const char *file_output, FILE *out, FILE *err){
+    Compiler *unit = entry->unit;
+    unit->options = *options;
+    unit->out = out;
+    unit->err = err;
+
+    jmp_buf bail;
+    unit->bail = &bail;
+    if (setjmp(bail)){
+        unit->bail = NULL;
+        unit->out = stdout;
+        unit->err = stderr;
+        return false;
+    }
+    bool status = codegen_unit(unit, entry->status, file_output);
+    unit->bail = NULL;
+    unit->out = stdout;
+    unit->err = stderr;
+    return status;
+}
+
+/**
+ * Runs one request: the same arguments as the CLI (argv[0] is the program) with
+ * absolute paths. Stage results are served from the cache when the source bytes
+ * were seen before, and codegen reuses the typechecked unit.
+ * @param   s       server
+ * @param   argc    number of arguments
+ * @param   argv    arguments
+ * @param   out     stream for stdout messages
+ * @param   err     stream for stderr messages
+ * @return  true if the stage succeeded, otherwise false
+ */
+static bool server_request(Server *s, int argc, const char *argv[], FILE *out, FILE *err){
+    if (argc == 2 && streq(argv[1], "--shutdown")){
+        pthread_mutex_lock(&s->lock);
+        s->stopping = true;
+        pthread_mutex_unlock(&s->lock);
+
+        // accept only returns for a connection, so make one to wake it
+        struct sockaddr_un addr;
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && server_address(s->path, &addr)) connect(fd, (struct sockaddr *)&addr, sizeof(addr));
+        if (fd >= 0) close(fd);
+        return true;
+    }
+
+    Options options = { .unroll_factor = DEFAULT_UNROLL_FACTOR, .threads = DEFAULT_THREADS };
+    int argind = options_parse(argc, argv, &options, err);
+    if (argind < 0) return false;
+
+    // entries are keyed by source bytes and reports measure a process: both run in the client 
+    if (options.ast_bin || options.time_report){
+        fprintf(err, "Failed: the server does not load binary ASTs or report times\n");
+        return false;
+    }
+
+    int stage = argind < argc ? server_stage(argv[argind]) : -1;
+    if (stage < 0 || argc - argind != (stage == SERVER_CODEGEN ? 3 : 2)){
+        fprintf(err, "Failed: the server runs [--unroll N] [--threads N] [--incremental] <stage> <Bminor source file> [<assembly output file>]\n");
+        return false;
+    }
+    const char *file_name = argv[argind + 1];
+    const char *file_output = stage == SERVER_CODEGEN ? argv[argind + 2] : NULL;
+    server_stage_t key = stage == SERVER_CODEGEN ? SERVER_TYPECHECK : stage;
+
+    // a file that cannot be read is reported by the stage the usual way
+    Compiler *c = compiler_create(&options);
+    c->out = out;
+    c->err = err;
+    if (!load_quiet(c, file_name)){
+        jmp_buf bail;
+        c->bail = &bail;
+        bool status = !setjmp(bail) && (stage == SERVER_CODEGEN ? codegen(c, file_name, file_output)
+                                                                 : server_run_stage(stage, c, file_name));
+        compiler_destroy(c);
+        compiler_bind(NULL);
+        return status;
+    }
+
+    Server_entry *entry = server_lookup(s, key, c->source, c->source_size);
+    if (entry){
+        unload(c);
+        compiler_destroy(c);
+    } else {
+        entry = server_build(s, key, c, file_name);
+    }
+
+    fwrite(entry->out, 1, entry->out_size, out);
+    fwrite(entry->err, 1, entry->err_size, err);
+    bool status = entry->status;
+    if (stage == SERVER_CODEGEN){
+        if (entry->unit){
+            pthread_mutex_lock(&entry->lock);
+            status = server_codegen(entry, &options, file_output, out, err);
+            pthread_mutex_unlock(&entry->lock);
+        } else {
+            status = false;
+        }
+    }
+    server_release(s, entry);
+    compiler_bind(NULL);
+    return status;
+}
+
+/**
+ * Connection thread: reads one request, runs it, and sends back the status, the
+ * stdout messages, and the stderr messages
+ * @param   arg     Server_connection (freed here)
+ * @return  NULL
+ */
+static void *server_serve(void *arg){
+    Server_connection *conn = arg;
+    Server *s = conn->server;
+    const char *argv[SERVER_MAX_ARGS] = {0};
+    size_t size = 0;
+    uint32_t argc = 0;
+
+    bool valid = server_read(conn->fd, &argc, sizeof(argc));
+    argc = ntohl(argc);
+    valid = valid && argc > 0 && argc <= SERVER_MAX_ARGS;
+    for (uint32_t i = 0; valid && i < argc; i++){
+        argv[i] = server_receive(conn->fd, &size);
+        valid = argv[i] != NULL;
+    }
+
+    if (valid){
+        char *out = NULL, *err = NULL;
+        size_t out_size = 0, err_size = 0;
+        FILE *out_stream = open_memstream(&out, &out_size);
+        FILE *err_stream = open_memstream(&err, &err_size);
+        MALLOC_CHECK(out_stream);
+        MALLOC_CHECK(err_stream);
+
+        uint32_t status = htonl(server_request(s, argc, argv, out_stream, err_stream));
+        fclose(out_stream);
+        fclose(err_stream);
+        // a client that went away is not an error for the server
+        if (server_write(conn->fd, &status, sizeof(status)) && server_send(conn->fd, out, out_size)){
+            server_send(conn->fd, err, err_size);
+        }
+        free(out);
+        free(err);
+    }
+
+    for (uint32_t i = 0; i < SERVER_MAX_ARGS; i++) free((char *)argv[i]);
+    close(conn->fd);
+    free(conn);
+
+    pthread_mutex_lock(&s->lock);
+    s->active--;
+    pthread_cond_signal(&s->idle);
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+/**
+ * Makes a client path absolute, since the server runs in its own directory
+ * @param   cwd     working directory of the client
+ * @param   path    path given to the client
+ * @return  malloc'd absolute path
+ */
+static char *client_path(const char *cwd, const char *path){
+    if (path[0] == '/') return safe_strdup(path);
+    size_t size = strlen(cwd) + strlen(path) + 2;
+    char *absolute = safe_malloc(sizeof(char), size);
+    snprintf(absolute, size, "%s/%s", cwd, path);
+    return absolute;
+}
+
+/* Functions */
+
+/**
+ * Runs the compile server: listens on a Unix domain socket and serves requests, one
+ * thread per connection, until a client sends --shutdown. Stage results and
+ * typechecked units are cached by the content of their source.
+ * @param   socket_path     path to listen on (a stale socket there is replaced)
+ * @return  exit status
+ */
+int server_run(const char *socket_path){
+    struct sockaddr_un addr;
+    if (!server_address(socket_path, &addr)) return EXIT_FAILURE;
+    signal(SIGPIPE, SIG_IGN);
+
+    struct stat st;
+    if (stat(socket_path, &st) == 0 && S_ISSOCK(st.st_mode)) unlink(socket_path);
+
+    Server s = { .fd = socket(AF_UNIX, SOCK_STREAM, 0), .path = socket_path };
+    if (s.fd < 0 || bind(s.fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(s.fd, SOMAXCONN) < 0){
+        fprintf(stderr, "%s %s\n", strerror(errno), socket_path);
+        if (s.fd >= 0) close(s.fd);
+        return EXIT_FAILURE;
+    }
+    pthread_mutex_init(&s.lock, NULL);
+    pthread_cond_init(&s.idle, NULL);
+
+    while (true){
+        int fd = accept(s.fd, NULL, NULL);
+        pthread_mutex_lock(&s.lock);
+        bool stopping = s.stopping;
+        pthread_mutex_unlock(&s.lock);
+        if (fd < 0){
+            if (stopping) break;
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            fprintf(stderr, "%s %s\n", strerror(errno), socket_path);
+            break;
+        }
+        if (stopping){
+            close(fd);
+            break;
+        }
+
+        Server_connection *conn = safe_malloc(sizeof(Server_connection), 1);
+        conn->server = &s;
+        conn->fd = fd;
+        pthread_t thread;
+        pthread_mutex_lock(&s.lock);
+        s.active++;
+        pthread_mutex_unlock(&s.lock);
+        if (pthread_create(&thread, NULL, server_serve, conn) != 0){
+            fprintf(stderr, "Fatal Error: unable to create server thread\n");
+            exit(EXIT_FAILURE);
+        }
+        pthread_detach(thread);
+    }
+
+    // let connections in flight finish before the cache goes away
+    pthread_mutex_lock(&s.lock);
+    while (s.active) pthread_cond_wait(&s.idle, &s.lock);
+    pthread_mutex_unlock(&s.lock);
+
+    close(s.fd);
+    unlink(socket_path);
+    while (s.head){
+        Server_entry *entry = s.head;
+        server_unlink(&s, entry);
+        server_entry_destroy(entry);
+    }
+    pthread_cond_destroy(&s.idle);
+    pthread_mutex_destroy(&s.lock);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Runs a CLI invocation on the server at socket_path: relative paths are made
+ * absolute, the request is sent, and the server's messages and status are passed
+ * on as if the compiler ran here. Only single-unit stages and --shutdown are sent.
+ * @param   socket_path     path of the server's socket
+ * @param   argc            number of arguments
+ * @param   argv            CLI arguments, argv[0] is the program
+ * @return  exit status, CLIENT_LOCAL if the arguments must run in this process
+ */
+int client_run(const char *socket_path, int argc, const char *argv[]){
+    int argind = argc;
+    if (!(argc == 2 && streq(argv[1], "--shutdown"))){
+        argind = 1;
+        while (argind < argc && (streq(argv[argind], "--unroll") || streq(argv[argind], "--threads") || 
+                                 streq(argv[argind], "--incremental"))){
+            argind += streq(argv[argind], "--incremental") ? 1 : 2;
+        }
+        int stage = argind < argc ? server_stage(argv[argind]) : -1;
+        if (stage < 0 || argc - argind != (stage == SERVER_CODEGEN ? 3 : 2)) return CLIENT_LOCAL;
+        for (int i = argind + 1; i < argc; i++){
+            if (argv[i][0] == '-') return CLIENT_LOCAL;
+        }
+        argind++;
+    }
+    if (argc > SERVER_MAX_ARGS) return CLIENT_LOCAL;
+
+    struct sockaddr_un addr;
+    if (!server_address(socket_path, &addr)) return EXIT_FAILURE;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0){
+        fprintf(stderr, "%s %s\n", strerror(errno), socket_path);
+        if (fd >= 0) close(fd);
+        return EXIT_FAILURE;
+    }
+
+    char cwd[BUFSIZ];
+    if (!getcwd(cwd, sizeof(cwd))){
+        fprintf(stderr, "%s .\n", strerror(errno));
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    uint32_t count = htonl(argc);
+    bool sent = server_write(fd, &count, sizeof(count));
+    for (int i = 0; sent && i < argc; i++){
+        char *arg = i >= argind ? client_path(cwd, argv[i]) : safe_strdup(argv[i]);
+        sent = server_send(fd, arg, strlen(arg));
+        free(arg);
+    }
+
+    uint32_t status = 0;
+    size_t out_size = 0, err_size = 0;
+    char *out = NULL, *err = NULL;
+    bool received = sent && server_read(fd, &status, sizeof(status)) &&
+                    (out = server_receive(fd, &out_size)) && (err = server_receive(fd, &err_size));
+    close(fd);
+    if (!received){
+        fprintf(stderr, "Failed: no response from server %s\n", socket_path);
+        free(out);
+        return EXIT_FAILURE;
+    }
+
+    fwrite(out, 1, out_size, stdout);
+    fflush(stdout);
+    fwrite(err, 1, err_size, stderr);
+    free(out);
+    free(err);
+    return ntohl(status) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,68 @@
+/* bminor_server.h: compile server on a Unix domain socket and its client */
+
+#ifndef BMINOR_SERVER_H
+#define BMINOR_SERVER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "bminor_context.h"
+
+#define SERVER_CACHE_ENTRIES    64          // stage results kept warm by the server
+#define SERVER_MAX_ARGS         64          // arguments accepted in one request
+#define SERVER_MAX_FRAME        (1 << 28)   // largest message accepted over the socket
+#define CLIENT_LOCAL            -1          // client_run: the arguments must run in this process
+
+/* Structure */
+
+typedef enum {
+    SERVER_SCAN,
+    SERVER_PARSE,
+    SERVER_PRINT,
+    SERVER_RESOLVE,
+    SERVER_TYPECHECK,
+    SERVER_CODEGEN,
+} server_stage_t;
+
+typedef struct Server_entry Server_entry;
+
+struct Server_entry {
+    server_stage_t stage;       // stage the result belongs to (codegen reuses typecheck entries)
+    uint64_t hash;              // hash of the source bytes
+    char *source;               // copy of the source bytes, compared on lookup
+    size_t source_size;
+    bool status;                // result of the stage
+    char *out;                  // messages the stage printed to stdout
+    size_t out_size;
+    char *err;                  // messages the stage printed to stderr
+    size_t err_size;
+    Compiler *unit;             // typechecked unit (typecheck entries only)
+    pthread_mutex_t lock;       // one request generates code from unit at a time
+    int users;                  // requests holding the entry
+    bool evicted;               // out of the cache, freed by its last user
+    Server_entry *prev;         // LRU list, most recently used first
+    Server_entry *next;
+};
+
+typedef struct Server Server;
+
+struct Server {
+    int fd;                     // listening socket
+    const char *path;           // path the socket is bound to
+    pthread_mutex_t lock;       // guards the cache, active, and stopping
+    pthread_cond_t idle;        // signalled when a connection is done
+    Server_entry *head;         // most recently used entry
+    Server_entry *tail;         // least recently used entry
+    size_t count;               // entries in the cache
+    int active;                 // connections being served
+    bool stopping;              // shutdown requested
+};
+
+/* Functions */
+
+int     server_run(const char *socket_path);
+int     client_run(const char *socket_path, int argc, const char *argv[]);
+
+#endif
@@ -0,0 +1,517 @@
+/* lexer.c: hand-written table-driven scanner, drop-in replacement for scanner.flex
+ * (build with 'make LEXER=hand'). Provides the subset of the reentrant flex interface
+ * the compiler uses, see scanner.h. */
+
+#include "scanner.h"
+#include "utils.h"
+#include "encoder.h"
+#include "token.h"
+#include "bminor_context.h"
+#include "intern.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* Macros */
+
+#define MAX_IDENT       255     // longest identifier accepted (matches scanner.flex)
+#define KEYWORD_SLOTS   32      // size of keyword perfect hash table
+
+// character classes
+#define CC_SPACE        0x01    // [ \t\r\n]
+#define CC_IDENT_START  0x02    // [a-zA-Z_]
+#define CC_IDENT        0x04    // [a-zA-Z_0-9]
+#define CC_DIGIT        0x08    // [0-9]
+#define CC_HEX          0x10    // [0-9a-fA-F]
+
+#define is_class(c, cc)  (char_class[(unsigned char)(c)] & (cc))
+
+/* Structure */
+
+typedef struct Lexer Lexer;
+
+struct Lexer {
+    Compiler *compiler;         // owns decoded literals and interned identifiers 
+    YYSTYPE *lval;              // semantic value of the current token 
+    char *text;                 // text of current token (NUL-terminated in place)
+    int lineno;                 // current line number
+    char *buffer;               // input being scanned (caller owned)
+    char *cursor;               // next byte to scan
+    char *limit;                // end of input
+    char *hold_pos;             // byte overwritten to NUL-terminate text
+    char  hold_char;            // original value of *hold_pos
+};
+
+typedef struct Keyword Keyword;
+
+struct Keyword {
+    const char *text;           // keyword spelling
+    size_t length;              // length of spelling
+    int token;                  // token returned for keyword
+};
+
+/* Globals */
+
+static const unsigned char char_class[256] = {
+    ['\t'] = CC_SPACE, ['\n'] = CC_SPACE, ['\r'] = CC_SPACE, [' '] = CC_SPACE,
+    ['0' ... '9'] = CC_IDENT | CC_DIGIT | CC_HEX,
+    ['a' ... 'f'] = CC_IDENT_START | CC_IDENT | CC_HEX,
+    ['A' ... 'F'] = CC_IDENT_START | CC_IDENT | CC_HEX,
+    ['g' ... 'z'] = CC_IDENT_START | CC_IDENT,
+    ['G' ... 'Z'] = CC_IDENT_START | CC_IDENT,
+    ['_'] = CC_IDENT_START | CC_IDENT,
+};
+
+// single character tokens (0 -> not a token)
+static const unsigned short single_tokens[256] = {
+    ['('] = TOKEN_LPAREN,           [')'] = TOKEN_RPAREN,
+    ['{'] = TOKEN_LBRACE,           ['}'] = TOKEN_RBRACE,
+    ['['] = TOKEN_LBRACKET,         [']'] = TOKEN_RBRACKET,
+    ['#'] = TOKEN_ARRAY_LEN,        ['!'] = TOKEN_LOGICAL_NOT,
+    ['^'] = TOKEN_EXPONENTIATION,   ['*'] = TOKEN_MULTIPLICATION,
+    ['/'] = TOKEN_DIVISION,         ['%'] = TOKEN_REMINDER,
+    ['+'] = TOKEN_ADDITION,         ['-'] = TOKEN_SUBTRACTION,
+    ['<'] = TOKEN_LESS_THAN,        ['>'] = TOKEN_GREATER_THAN,
+    ['='] = TOKEN_ASSIGNMENT,       [';'] = TOKEN_SEMICOLON,
+    [':'] = TOKEN_COLON,            [','] = TOKEN_COMMA,
+};
+
+// two character tokens indexed by first character: {second character, token}
+static const struct { char second; unsigned short token; } pair_tokens[256] = {
+    ['+'] = { '+', TOKEN_INCREMENT },
+    ['-'] = { '-', TOKEN_DECREMENT },
+    ['<'] = { '=', TOKEN_LESS_THAN_OR_EQUAL },
+    ['>'] = { '=', TOKEN_GREATER_THAN_OR_EQUAL },
+    ['='] = { '=', TOKEN_COMPARISON_EQUAL },
+    ['!'] = { '=', TOKEN_COMPARISON_NOT_EQUAL },
+    ['&'] = { '&', TOKEN_LOGICAL_AND },
+    ['|'] = { '|', TOKEN_LOGICAL_OR },
+};
+
+// perfect hash of the keywords, see keyword_hash
+static const Keyword keywords[KEYWORD_SLOTS] = {
+    [ 3] = { "char",     4, TOKEN_CHAR },
+    [ 6] = { "return",   6, TOKEN_RETURN },
+    [ 7] = { "array",    5, TOKEN_ARRAY },
+    [ 8] = { "boolean",  7, TOKEN_BOOLEAN },
+    [ 9] = { "else",     4, TOKEN_ELSE },
+    [12] = { "double",   6, TOKEN_DOUBLE },
+    [13] = { "while",    5, TOKEN_WHILE },
+    [14] = { "void",     4, TOKEN_VOID },
+    [16] = { "float",    5, TOKEN_FLOAT },
+    [19] = { "string",   6, TOKEN_STRING },
+    [20] = { "for",      3, TOKEN_FOR },
+    [21] = { "if",       2, TOKEN_IF },
+    [24] = { "true",     4, TOKEN_TRUE },
+    [26] = { "print",    5, TOKEN_PRINT },
+    [27] = { "carray",   6, TOKEN_CARRAY },
+    [28] = { "false",    5, TOKEN_FALSE },
+    [29] = { "auto",     4, TOKEN_AUTO },
+    [30] = { "function", 8, TOKEN_FUNCTION },
+    [31] = { "integer",  7, TOKEN_INTEGER },
+};
+
+/* Forward declaration of static prototypes */
+
+static inline size_t keyword_hash(const char *s, size_t length);
+static const char   *lexer_skip_space(Lexer *lx, const char *p);
+static const char   *lexer_find(Lexer *lx, const char *p, char c);
+static void          lexer_count_lines(Lexer *lx, const char *p, const char *end);
+static const char   *lexer_skip_comment(Lexer *lx, const char *p);
+static int           lexer_token(Lexer *lx, char *start, char *end, int token);
+static int           lexer_identifier(Lexer *lx, char *start);
+static int           lexer_number(Lexer *lx, char *start);
+static int           lexer_string(Lexer *lx, char *start);
+static int           lexer_char(Lexer *lx, char *start);
+static int           lexer_operator(Lexer *lx, char *start);
+
+/* Functions */
+
+/**
+ * Perfect hash over the keyword set: no two keywords share a slot, so a lookup is
+ * one hash and one memcmp
+ * @param   s       start of identifier
+ * @param   length  length of identifier
+ * @return  slot in keywords table
+ */
+static inline size_t keyword_hash(const char *s, size_t length){
+    return (length * 18 + (unsigned char)s[0] + (unsigned char)s[length - 1] * 12) & (KEYWORD_SLOTS - 1);
+}
+
+/**
+ * Skips whitespace, 16 bytes at a time with SSE2 when available, counting newlines
+ * @param   p       first byte to check
+ * @return  first byte that is not whitespace
+ */
+static const char *lexer_skip_space(Lexer *lx, const char *p){
+    // most runs are a single space or newline + indent, check before going wide
+    while (p < lx->limit && is_class(*p, CC_SPACE)){
+        if (*p == '\n') lx->lineno++;
+        p++;
+        if (p < lx->limit && !is_class(*p, CC_SPACE)) return p;
+#ifdef __SSE2__
+        while (lx->limit - p >= 16){
+            __m128i v = _mm_loadu_si128((const __m128i *)p);
+            __m128i nl = _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+            __m128i ws = _mm_or_si128(_mm_or_si128(nl, _mm_cmpeq_epi8(v, _mm_set1_epi8(' '))),
+                                      _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\t')),
+                                                   _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+            unsigned other = ~_mm_movemask_epi8(ws) & 0xFFFF;
+            unsigned lines = _mm_movemask_epi8(nl);
+            if (other){
+                unsigned n = __builtin_ctz(other);
+                lx->lineno += __builtin_popcount(lines & ((1u << n) - 1));
+                return p + n;
+            }
+            lx->lineno += __builtin_popcount(lines);
+            p += 16;
+        }
+#endif
+    }
+    return p;
+}
+
+/**
+ * Finds the next occurrence of c, 16 bytes at a time with SSE2 when available
+ * @param   p       first byte to check
+ * @param   c       byte to find
+ * @return  ptr to c, or limit if not found
+ */
+static const char *lexer_find(Lexer *lx, const char *p, char c){
+#ifdef __SSE2__
+    __m128i needle = _mm_set1_epi8(c);
+    while (lx->limit - p >= 16){
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, needle));
+        if (mask) return p + __builtin_ctz(mask);
+        p += 16;
+    }
+#endif
+    while (p < lx->limit && *p != c) p++;
+    return p;
+}
+
+/**
+ * Adds the newlines in [p, end) to the line count
+ * @param   p       first byte
+ * @param   end     one past the last byte
+ */
+static void lexer_count_lines(Lexer *lx, const char *p, const char *end){
+#ifdef __SSE2__
+    __m128i nl = _mm_set1_epi8('\n');
+    while (end - p >= 16){
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        lx->lineno += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(v, nl)));
+        p += 16;
+    }
+#endif
+    for (; p < end; p++){
+        if (*p == '\n') lx->lineno++;
+    }
+}
+
+/**
+ * Skips a // or block comment starting at p. An unterminated block comment is not a
+ * comment (scanner.flex scans it as '/' '*')
+ * @param   p       ptr to '/'
+ * @return  first byte after the comment, p if no comment starts at p
+ */
+static const char *lexer_skip_comment(Lexer *lx, const char *p){
+    if (lx->limit - p < 2 || p[0] != '/') return p;
+
+    if (p[1] == '/') return lexer_find(lx, p + 2, '\n');
+
+    if (p[1] == '*'){
+        for (const char *q = p + 2; (q = lexer_find(lx, q, '*')) < lx->limit; q++){
+            if (q + 1 < lx->limit && q[1] == '/'){
+                lexer_count_lines(lx, p, q);
+                return q + 2;
+            }
+        }
+    }
+    return p;
+}
+
+/**
+ * Sets the token text to [start, end) by NUL-terminating it in place, and moves the cursor to end
+ * @param   start   first byte of token
+ * @param   end     one past the last byte of token
+ * @param   token   token to return
+ * @return  token
+ */
+static int lexer_token(Lexer *lx, char *start, char *end, int token){
+    lx->hold_pos = end;
+    lx->hold_char = *end;
+    *end = '\0';
+    lx->text = start;
+    lx->cursor = end;
+    return token;
+}
+
+/**
+ * Scans an identifier or keyword
+ * @param   start   first byte of token
+ * @return  token type
+ */
+static int lexer_identifier(Lexer *lx, char *start){
+    char *p = start + 1;
+    while (p < lx->limit && is_class(*p, CC_IDENT)) p++;
+
+    size_t length = p - start;
+    if (length > MAX_IDENT) return lexer_token(lx, start, p, TOKEN_ERROR);
+
+    const Keyword *k = &keywords[keyword_hash(start, length)];
+    if (k->length == length && memcmp(k->text, start, length) == 0){
+        return lexer_token(lx, start, p, k->token);
+    }
+
+    lexer_token(lx, start, p, TOKEN_IDENTIFIER);
+    lx->lval->name = intern(&lx->compiler->names, lx->text);
+    return TOKEN_IDENTIFIER;
+}
+
+/**
+ * Scans a numeric literal. Follows flex's longest match, with ties going to the rule
+ * listed first in scanner.flex (binary, hex, integer, scientific, double)
+ * @param   start   first byte of token (a digit)
+ * @return  token type
+ */
+static int lexer_number(Lexer *lx, char *start){
+    char *digits = start;
+    while (digits < lx->limit && is_class(*digits, CC_DIGIT)) digits++;
+
+    char *end = digits;
+    int token = TOKEN_INTEGER_LITERAL;
+
+    // 0b[01]+ and 0x[0-9a-fA-F]+
+    if (start[0] == '0' && lx->limit - start > 2 && (start[1] == 'b' || start[1] == 'x')){
+        char *p = start + 2;
+        if (start[1] == 'b'){
+            while (p < lx->limit && (*p == '0' || *p == '1')) p++;
+        } else {
+            while (p < lx->limit && is_class(*p, CC_HEX)) p++;
+        }
+        if (p > start + 2){
+            end = p;
+            token = start[1] == 'b' ? TOKEN_BINARY_LITERAL : TOKEN_HEXIDECIMAL_LITERAL;
+        }
+    }
+
+    // [0-9]+\.?[0-9]*[eE][+-]?[0-9]+(\.[0-9]+)?
+    char *p = digits;
+    if (p < lx->limit && *p == '.') p++;
+    while (p < lx->limit && is_class(*p, CC_DIGIT)) p++;
+    if (p < lx->limit && (*p == 'e' || *p == 'E')){
+        p++;
+        if (p < lx->limit && (*p == '+' || *p == '-')) p++;
+        if (p < lx->limit && is_class(*p, CC_DIGIT)){
+            while (p < lx->limit && is_class(*p, CC_DIGIT)) p++;
+            if (lx->limit - p > 1 && p[0] == '.' && is_class(p[1], CC_DIGIT)){
+                p++;
+                while (p < lx->limit && is_class(*p, CC_DIGIT)) p++;
+            }
+            if (p > end){
+                end = p;
+                token = TOKEN_DOUBLE_SCIENTIFIC_LITERAL;
+            }
+        }
+    }
+
+    // [0-9]+\.[0-9]+
+    p = digits;
+    if (lx->limit - p > 1 && p[0] == '.' && is_class(p[1], CC_DIGIT)){
+        p++;
+        while (p < lx->limit && is_class(*p, CC_DIGIT)) p++;
+        if (p > end){
+            end = p;
+            token = TOKEN_DOUBLE_LITERAL;
+        }
+    }
+
+    lexer_token(lx, start, end, token);
+
+    errno = 0;
+    if (token == TOKEN_DOUBLE_LITERAL || token == TOKEN_DOUBLE_SCIENTIFIC_LITERAL){
+        lx->lval->double_lit = strtod(lx->text, NULL);
+    } else if (token == TOKEN_BINARY_LITERAL){
+        lx->lval->int_literal = strtol(lx->text + 2, NULL, 2);
+    } else {
+        lx->lval->int_literal = strtol(lx->text, NULL, token == TOKEN_HEXIDECIMAL_LITERAL ? 0 : 10);
+    }
+    if (errno == ERANGE){
+        fprintf(lx->compiler->out, "Error: Overflow/Underflow for '%s'\n", token == TOKEN_BINARY_LITERAL ? lx->text + 2 : lx->text);
+        compiler_abort();
+    }
+    return token;
+}
+
+/**
+ * Scans a string literal: \"([^\"\\\n]|\\.)*\"
+ * @param   start   first byte of token (a '"')
+ * @return  token type, TOKEN_ERROR if the literal is unterminated or does not decode
+ */
+static int lexer_string(Lexer *lx, char *start){
+    char *p = start + 1;
+    while (p < lx->limit && *p != '"' && *p != '\n'){
+        if (*p == '\\'){
+            if (p + 1 >= lx->limit || p[1] == '\n') break;
+            p++;
+        }
+        p++;
+    }
+    if (p >= lx->limit || *p != '"') return lexer_token(lx, start, start + 1, TOKEN_ERROR);
+
+    // decoded text is never longer than the encoded text 
+    lexer_token(lx, start, p + 1, TOKEN_STRING_LITERAL);
+    lx->lval->string = arena_alloc(lx->compiler->arena, p - start);
+    if (!string_decode(lx->text, lx->lval->string)) return TOKEN_ERROR;
+    return TOKEN_STRING_LITERAL;
+}
+
+/**
+ * Scans a char literal: 'c', '\c', or '\0xHH'
+ * @param   start   first byte of token (a '\'')
+ * @return  token type, TOKEN_ERROR if the literal is malformed or does not decode
+ */
+static int lexer_char(Lexer *lx, char *start){
+    size_t avail = lx->limit - start;
+    size_t length = 0;
+
+    if (avail >= 7 && start[1] == '\\' && start[2] == '0' && start[3] == 'x' &&
+        is_class(start[4], CC_HEX) && is_class(start[5], CC_HEX) && start[6] == '\''){
+        length = 7;
+    } else if (avail >= 4 && start[1] == '\\' && (unsigned char)start[2] >= 0x20 &&
+               (unsigned char)start[2] <= 0x7f && start[3] == '\''){
+        length = 4;
+    } else if (avail >= 3 && start[1] != '\'' && start[2] == '\''){
+        length = 3;
+    }
+    if (!length) return lexer_token(lx, start, start + 1, TOKEN_ERROR);
+    if (start[1] == '\n') lx->lineno++;
+
+    lexer_token(lx, start, start + length, TOKEN_CHAR_LITERAL);
+
+    // decode as a one character string literal
+    char quoted[8];
+    memcpy(quoted, start, length + 1);
+    quoted[0] = quoted[length - 1] = '"';
+    lx->lval->string = arena_alloc(lx->compiler->arena, length - 1);
+    if (!string_decode(quoted, lx->lval->string)) return TOKEN_ERROR;
+    return TOKEN_CHAR_LITERAL;
+}
+
+/**
+ * Scans an operator or punctuation, preferring two character operators
+ * @param   start   first byte of token
+ * @return  token type, TOKEN_ERROR for characters outside the language
+ */
+static int lexer_operator(Lexer *lx, char *start){
+    unsigned char c = *start;
+    if (pair_tokens[c].token && lx->limit - start > 1 && start[1] == pair_tokens[c].second){
+        return lexer_token(lx, start, start + 2, pair_tokens[c].token);
+    }
+    int token = single_tokens[c];
+    return lexer_token(lx, start, start + 1, token ? token : TOKEN_ERROR);
+}
+
+/**
+ * Allocates scanner state for one compilation 
+ * @param   c           compiler that owns literals and identifiers scanned 
+ * @param   scanner     set to the new scanner 
+ * @return  0 
+ */
+int yylex_init_extra(Compiler *c, yyscan_t *scanner){
+    Lexer *lx = safe_calloc(sizeof(Lexer), 1);
+    lx->compiler = c;
+    lx->lineno = 1;
+    *scanner = lx;
+    return 0;
+}
+
+/**
+ * Scans the next token from the buffer given to yy_scan_buffer
+ * @param   lval        set to the semantic value of the token 
+ * @param   scanner     scanner state 
+ * @return  token type, 0 at end of input
+ */
+int yylex(YYSTYPE *lval, yyscan_t scanner){
+    Lexer *lx = scanner;
+    if (lx->hold_pos){
+        *lx->hold_pos = lx->hold_char;
+        lx->hold_pos = NULL;
+    }
+    if (!lx->buffer) return 0;
+    lx->lval = lval;
+
+    const char *p = lx->cursor;
+    for (;;){
+        p = lexer_skip_space(lx, p);
+        const char *q = lexer_skip_comment(lx, p);
+        if (q == p) break;
+        p = q;
+    }
+    lx->cursor = (char *)p;
+    if (lx->cursor >= lx->limit) return 0;
+
+    unsigned char c = *lx->cursor;
+    if (is_class(c, CC_IDENT_START)) return lexer_identifier(lx, lx->cursor);
+    if (is_class(c, CC_DIGIT)) return lexer_number(lx, lx->cursor);
+    if (c == '"') return lexer_string(lx, lx->cursor);
+    if (c == '\'') return lexer_char(lx, lx->cursor);
+    return lexer_operator(lx, lx->cursor);
+}
+
+/**
+ * Scans directly from base without copying. As with flex, the last two bytes of base
+ * must be NUL and base must be writable (tokens are NUL-terminated in place).
+ * @param   base        input followed by two NUL bytes
+ * @param   size        size of base including the two NUL bytes
+ * @param   scanner     scanner state 
+ * @return  base on success, NULL if base is not properly terminated
+ */
+void *yy_scan_buffer(char *base, size_t size, yyscan_t scanner){
+    Lexer *lx = scanner;
+    if (!base || size < 2 || base[size - 2] || base[size - 1]) return NULL;
+    lx->buffer = lx->cursor = base;
+    lx->limit = base + size - 2;
+    lx->hold_pos = NULL;
+    lx->lineno = 1;
+    return base;
+}
+
+/**
+ * Returns the text of the last token scanned 
+ * @param   scanner     scanner state 
+ * @return  NUL-terminated token text 
+ */
+char *yyget_text(yyscan_t scanner){
+    return ((Lexer *)scanner)->text;
+}
+
+/**
+ * Returns the line the scanner is on 
+ * @param   scanner     scanner state 
+ * @return  current line number 
+ */
+int yyget_lineno(yyscan_t scanner){
+    return ((Lexer *)scanner)->lineno;
+}
+
+/**
+ * Releases the scanner state (the buffer belongs to the caller)
+ * @param   scanner     scanner state 
+ * @return  0
+ */
+int yylex_destroy(yyscan_t scanner){
+    Lexer *lx = scanner;
+    if (!lx) return 0;
+    if (lx->hold_pos) *lx->hold_pos = lx->hold_char;
+    free(lx);
+    return 0;
+}
@@ -0,0 +1,27 @@
+/* scanner.h: reentrant scanner interface shared by scanner.flex and lexer.c */
+
+#ifndef SCANNER_H
+#define SCANNER_H
+
+#include <stdio.h>
+
+#include "bminor_context.h"
+#include "token.h"
+
+/* Structure */
+
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;
+#endif
+
+/* Functions */
+
+int     yylex_init_extra(Compiler *c, yyscan_t *scanner);
+int     yylex(YYSTYPE *lval, yyscan_t scanner);
+void   *yy_scan_buffer(char *base, size_t size, yyscan_t scanner);
+char   *yyget_text(yyscan_t scanner);
+int     yyget_lineno(yyscan_t scanner);
+int     yylex_destroy(yyscan_t scanner);
+
+#endif
@@ -1,28 +1,43 @@
 #include "hash_table.h"
+#include "intern.h"
 
 #include <stdlib.h>
 #include <string.h>
 
-#define DEFAULT_SIZE 127
-#define DEFAULT_LOAD 0.75
+#define DEFAULT_SIZE 32
 #define DEFAULT_FUNC hash_string
 
+/* Open addressing with linear probing. A slot is empty when its key is null.
+   The table grows once it is half full, and removal shifts the rest of the
+   probe run back so no tombstones are needed. */
+
 struct entry {
 	char *key;
 	void *value;
 	unsigned hash;
-	struct entry *next;
 };
 
 struct hash_table {
 	hash_func_t hash_func;
 	int bucket_count;
 	int size;
-	struct entry **buckets;
+	struct entry *buckets;
 	int ibucket;
-	struct entry *ientry;
+	int interned;
 };
 
+/* Interned tables borrow their keys and compare them by pointer */
+#define KEY_EQUAL(h, a, b) ((h)->interned ? (a) == (b) : !strcmp((a), (b)))
+#define KEY_FREE(h, k) do { if(!(h)->interned) free(k); } while(0)
+
+static int round_pow2(int n)
+{
+	int p = 1;
+	while(p < n)
+		p <<= 1;
+	return p;
+}
+
 struct hash_table *hash_table_create(int bucket_count, hash_func_t func)
 {
 	struct hash_table *h;
@@ -37,9 +52,11 @@ struct hash_table *hash_table_create(int bucket_count, hash_func_t func)
 		func = DEFAULT_FUNC;
 
 	h->size = 0;
+	h->interned = 0;
+	h->ibucket = 0;
 	h->hash_func = func;
-	h->bucket_count = bucket_count;
-	h->buckets = (struct entry **) calloc(bucket_count, sizeof(struct entry *));
+	h->bucket_count = round_pow2(bucket_count);
+	h->buckets = (struct entry *) calloc(h->bucket_count, sizeof(struct entry));
 	if(!h->buckets) {
 		free(h);
 		return 0;
@@ -48,24 +65,27 @@ struct hash_table *hash_table_create(int bucket_count, hash_func_t func)
 	return h;
 }
 
+struct hash_table *hash_table_create_interned(int bucket_count)
+{
+	struct hash_table *h = hash_table_create(bucket_count, intern_hash);
+
+	if(h)
+		h->interned = 1;
+
+	return h;
+}
+
 void hash_table_clear(struct hash_table *h)
 {
-	struct entry *e, *f;
 	int i;
 
 	for(i = 0; i < h->bucket_count; i++) {
-		e = h->buckets[i];
-		while(e) {
-			f = e->next;
-			free(e->key);
-			free(e);
-			e = f;
-		}
+		if(h->buckets[i].key)
+			KEY_FREE(h, h->buckets[i].key);
 	}
 
-	for(i = 0; i < h->bucket_count; i++) {
-		h->buckets[i] = 0;
-	}
+	memset(h->buckets, 0, h->bucket_count * sizeof(struct entry));
+	h->size = 0;
 }
 
 
@@ -76,23 +96,27 @@ void hash_table_delete(struct hash_table *h)
 	free(h);
 }
 
-void *hash_table_lookup(struct hash_table *h, const char *key)
+/* Returns the slot holding key, or the empty slot ending its probe run */
+static struct entry *hash_table_find(struct hash_table *h, const char *key, unsigned hash)
 {
-	struct entry *e;
-	unsigned hash, index;
+	unsigned mask = h->bucket_count - 1;
+	unsigned index = hash & mask;
+	struct entry *e = &h->buckets[index];
 
-	hash = h->hash_func(key);
-	index = hash % h->bucket_count;
-	e = h->buckets[index];
-
-	while(e) {
-		if(hash == e->hash && !strcmp(key, e->key)) {
-			return e->value;
-		}
-		e = e->next;
+	while(e->key) {
+		if(hash == e->hash && KEY_EQUAL(h, key, e->key))
+			break;
+		index = (index + 1) & mask;
+		e = &h->buckets[index];
 	}
 
-	return 0;
+	return e;
+}
+
+void *hash_table_lookup(struct hash_table *h, const char *key)
+{
+	struct entry *e = hash_table_find(h, key, h->hash_func(key));
+	return e->key ? e->value : 0;
 }
 
 int hash_table_size(struct hash_table *h)
@@ -102,43 +126,28 @@ int hash_table_size(struct hash_table *h)
 
 static int hash_table_double_buckets(struct hash_table *h)
 {
-	struct hash_table *hn = hash_table_create(2 * h->bucket_count, h->hash_func);
+	int old_count = h->bucket_count;
+	struct entry *old = h->buckets;
+	struct entry *buckets = (struct entry *) calloc(2 * old_count, sizeof(struct entry));
 
-	if(!hn)
+	if(!buckets)
 		return 0;
 
-	/* Move pairs to new hash */
-	char *key;
-	void *value;
-	hash_table_firstkey(h);
-	while(hash_table_nextkey(h, &key, &value))
-		if(!hash_table_insert(hn, key, value))
-		{
-			hash_table_delete(hn);
-			return 0;
-		}
-
-	/* Delete all old pairs */
-	struct entry *e, *f;
+	/* Move pairs using their cached hashes; keys are neither rehashed nor copied */
+	unsigned mask = 2 * old_count - 1;
 	int i;
-	for(i = 0; i < h->bucket_count; i++) {
-		e = h->buckets[i];
-		while(e) {
-			f = e->next;
-			free(e->key);
-			free(e);
-			e = f;
-		}
+	for(i = 0; i < old_count; i++) {
+		if(!old[i].key)
+			continue;
+		unsigned index = old[i].hash & mask;
+		while(buckets[index].key)
+			index = (index + 1) & mask;
+		buckets[index] = old[i];
 	}
 
-	/* Make the old point to the new */
-	free(h->buckets);
-	h->buckets      = hn->buckets;
-	h->bucket_count = hn->bucket_count;
-	h->size         = hn->size;
-
-	/* Delete reference to new, so old is safe */
-	free(hn);
+	free(old);
+	h->buckets      = buckets;
+	h->bucket_count = 2 * old_count;
 
 	return 1;
 }
@@ -146,35 +155,23 @@ static int hash_table_double_buckets(struct hash_table *h)
 int hash_table_insert(struct hash_table *h, const char *key, const void *value)
 {
 	struct entry *e;
-	unsigned hash, index;
-
-	if( ((float) h->size / h->bucket_count) > DEFAULT_LOAD )
-		hash_table_double_buckets(h);
-
-	hash = h->hash_func(key);
-	index = hash % h->bucket_count;
-	e = h->buckets[index];
+	unsigned hash;
 
-	while(e) {
-		if(hash == e->hash && !strcmp(key, e->key))
+	if(2 * (h->size + 1) > h->bucket_count)
+		if(!hash_table_double_buckets(h))
 			return 0;
-		e = e->next;
-	}
 
-	e = (struct entry *) malloc(sizeof(struct entry));
-	if(!e)
+	hash = h->hash_func(key);
+	e = hash_table_find(h, key, hash);
+	if(e->key)
 		return 0;
 
-	e->key = strdup(key);
-	if(!e->key) {
-		free(e);
+	e->key = h->interned ? (char *) key : strdup(key);
+	if(!e->key)
 		return 0;
-	}
 
 	e->value = (void *) value;
 	e->hash = hash;
-	e->next = h->buckets[index];
-	h->buckets[index] = e;
 	h->size++;
 
 	return 1;
@@ -182,64 +179,49 @@ int hash_table_insert(struct hash_table *h, const char *key, const void *value)
 
 void *hash_table_remove(struct hash_table *h, const char *key)
 {
-	struct entry *e, *f;
+	struct entry *e = hash_table_find(h, key, h->hash_func(key));
 	void *value;
-	unsigned hash, index;
 
-	hash = h->hash_func(key);
-	index = hash % h->bucket_count;
-	e = h->buckets[index];
-	f = 0;
-
-	while(e) {
-		if(hash == e->hash && !strcmp(key, e->key)) {
-			if(f) {
-				f->next = e->next;
-			} else {
-				h->buckets[index] = e->next;
-			}
-			value = e->value;
-			free(e->key);
-			free(e);
-			h->size--;
-			return value;
+	if(!e->key)
+		return 0;
+
+	value = e->value;
+	KEY_FREE(h, e->key);
+	h->size--;
+
+	/* Shift later members of the probe run back into the hole */
+	unsigned mask = h->bucket_count - 1;
+	unsigned hole = e - h->buckets;
+	unsigned index = (hole + 1) & mask;
+	while(h->buckets[index].key) {
+		unsigned home = h->buckets[index].hash & mask;
+		if(((index - home) & mask) >= ((index - hole) & mask)) {
+			h->buckets[hole] = h->buckets[index];
+			hole = index;
 		}
-		f = e;
-		e = e->next;
+		index = (index + 1) & mask;
 	}
+	h->buckets[hole].key = 0;
 
-	return 0;
+	return value;
 }
 
 void hash_table_firstkey(struct hash_table *h)
 {
-	h->ientry = 0;
-	for(h->ibucket = 0; h->ibucket < h->bucket_count; h->ibucket++) {
-		h->ientry = h->buckets[h->ibucket];
-		if(h->ientry)
-			break;
-	}
+	h->ibucket = 0;
 }
 
 int hash_table_nextkey(struct hash_table *h, char **key, void **value)
 {
-	if(h->ientry) {
-		*key = h->ientry->key;
-		*value = h->ientry->value;
-
-		h->ientry = h->ientry->next;
-		if(!h->ientry) {
+	for(; h->ibucket < h->bucket_count; h->ibucket++) {
+		if(h->buckets[h->ibucket].key) {
+			*key = h->buckets[h->ibucket].key;
+			*value = h->buckets[h->ibucket].value;
 			h->ibucket++;
-			for(; h->ibucket < h->bucket_count; h->ibucket++) {
-				h->ientry = h->buckets[h->ibucket];
-				if(h->ientry)
-					break;
-			}
+			return 1;
 		}
-		return 1;
-	} else {
-		return 0;
 	}
+	return 0;
 }
 
 typedef unsigned long int ub4;	/* unsigned 4-byte quantities */
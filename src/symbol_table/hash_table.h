@@ -35,13 +35,23 @@ while(hash_table_nextkey(h,&key,&value)) {
 typedef unsigned (*hash_func_t) (const char *key);
 
 /** Create a new hash table.
-@param buckets The number of buckets in the table.  If zero, a default value will be used.
+The table uses open addressing with linear probing and doubles once it is half full.
+@param buckets The number of buckets in the table, rounded up to a power of two.  If zero, a default value will be used.
 @param func The default hash function to be used.  If zero, @ref hash_string will be used.
 @return A pointer to a new hash table.
 */
 
 struct hash_table *hash_table_create(int buckets, hash_func_t func);
 
+/** Create a new hash table keyed by interned strings.
+Keys must come from @ref intern: they are neither duplicated nor freed,
+are compared by pointer, and are hashed with the hash cached at interning time.
+@param buckets The number of buckets in the table.  If zero, a default value will be used.
+@return A pointer to a new hash table.
+*/
+
+struct hash_table *hash_table_create_interned(int buckets);
+
 /** Remove all entries from an hash table.
 Note that this function will not delete all of the objects contained within the hash table.
 @param h The hash table to delete.
@@ -103,6 +113,7 @@ void hash_table_firstkey(struct hash_table *h);
 
 /** Continue iteration over all keys.
 This function returns the next key and value in the iteration.
+Inserting or removing keys during an iteration may skip or repeat entries.
 @param h A pointer to a hash table.
 @param key A pointer to a key pointer.
 @param value A pointer to a value pointer.
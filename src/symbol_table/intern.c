@@ -0,0 +1,101 @@
+/* intern.c: identifier interning table, one per compilation. Every distinct identifier is stored once,
+ * so interned names can be compared by pointer and carry their hash with them. */
+
+#include "intern.h"
+#include "arena.h"
+#include "hash_table.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+/* Structure */
+
+struct Intern_entry {
+    unsigned hash;              // hash_string of text, computed once 
+    char text[];                // interned string (what intern returns)
+};
+
+/* Forward declaration of static prototypes */
+
+static void intern_grow(Intern_table *t);
+
+/* Functions */
+
+/**
+ * Doubles the table and reinserts every entry using its cached hash 
+ * @param   t       table to grow
+ */
+static void intern_grow(Intern_table *t){
+    size_t new_count = t->slot_count ? t->slot_count * 2 : INTERN_INITIAL_SLOTS;
+    Intern_entry **new_slots = safe_calloc(sizeof(Intern_entry *), new_count);
+
+    for (size_t i = 0; i < t->slot_count; i++){
+        if (!t->slots[i]) continue;
+        size_t j = t->slots[i]->hash & (new_count - 1);
+        while (new_slots[j]) j = (j + 1) & (new_count - 1);
+        new_slots[j] = t->slots[i];
+    }
+
+    free(t->slots);
+    t->slots = new_slots;
+    t->slot_count = new_count;
+}
+
+/**
+ * Returns the unique copy of s in t. Equal strings always intern to the same pointer, 
+ * which stays valid until intern_destroy.
+ * @param   t       table to intern into 
+ * @param   s       string to intern
+ * @return  interned string, NULL if s is NULL
+ */
+const char *intern(Intern_table *t, const char *s){
+    if (!s) return NULL;
+    if (!t->strings) t->strings = arena_create();
+    if (2 * (t->used + 1) > t->slot_count) intern_grow(t);
+
+    unsigned hash = hash_string(s);
+    size_t i = hash & (t->slot_count - 1);
+    while (t->slots[i]){
+        if (t->slots[i]->hash == hash && streq(t->slots[i]->text, s)) return t->slots[i]->text;
+        i = (i + 1) & (t->slot_count - 1);
+    }
+
+    size_t len = strlen(s) + 1;
+    Intern_entry *entry = arena_alloc(t->strings, sizeof(Intern_entry) + len);
+    entry->hash = hash;
+    memcpy(entry->text, s, len);
+    t->slots[i] = entry;
+    t->used++;
+    return entry->text;
+}
+
+/**
+ * Returns the hash computed when s was interned. s must come from intern.
+ * @param   s       interned string
+ * @return  hash of s
+ */
+unsigned intern_hash(const char *s){
+    return ((const Intern_entry *)(s - offsetof(Intern_entry, text)))->hash;
+}
+
+/**
+ * Returns the number of distinct strings interned in t
+ * @param   t       interning table 
+ * @return  number of interned strings
+ */
+size_t intern_count(Intern_table *t){
+    return t->used;
+}
+
+/**
+ * Frees every string interned in t, all pointers returned by intern become invalid
+ * @param   t       interning table 
+ */
+void intern_destroy(Intern_table *t){
+    arena_destroy(t->strings);
+    free(t->slots);
+    *t = (Intern_table){0};
+}
@@ -0,0 +1,35 @@
+/* intern.h: identifier interning table */
+
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "arena.h"
+
+/* Macros */
+
+#define INTERN_INITIAL_SLOTS    1024    // initial size of interning table (power of 2)
+
+/* Structure */
+
+typedef struct Intern_entry Intern_entry;
+
+typedef struct Intern_table Intern_table;
+
+struct Intern_table {
+    Arena         *strings;     // owns every Intern_entry 
+    Intern_entry **slots;       // open addressing table, NULL -> empty 
+    size_t         slot_count;  // size of slots (power of 2)
+    size_t         used;        // number of interned strings 
+};
+
+/* Functions */
+
+const char *intern(Intern_table *t, const char *s);
+unsigned    intern_hash(const char *s);
+size_t      intern_count(Intern_table *t);
+void        intern_destroy(Intern_table *t);
+
+#endif
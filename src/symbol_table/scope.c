@@ -1,4 +1,6 @@
-/* scope.c: scope function definitions */
+/* scope.c: scope function definitions. All scopes of the bound compiler share one table from each identifier 
+ * to its chain of bindings, innermost first; every scope keeps an undo log of the 
+ * bindings it declared so leaving it only unlinks those. */
 
 #include "bminor_context.h"
 #include "hash_table.h"
@@ -9,43 +11,60 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-/* global variable */ 
-
-Symbol_stack stack = {
-    .top = 0,
-    .size = 0,
-};
-
 /* functions */
 
 /**
- * This functions adds a new scope (hash table) to the stack and updates metrics 
+ * This functions opens a new scope on the stack and updates metrics 
  **/
 void scope_enter(){
-    struct hash_table *h = hash_table_create(0, 0);
-    stack.size += 1;
-    Symbol_node *curr = stack.top;
-    Symbol_node *node = safe_calloc(sizeof(Symbol_node), 1);
-    node->hashmap = h;
-    node->next = curr;
-    if (stack.size > 2) { // globals + params layer + 1st local scope -> all other nested calls add them 
-        node->local = curr->local;
+    Symbol_stack *stack = &b_ctx->scopes;
+    if (!stack->names){
+        stack->names = hash_table_create_interned(0);
+        MALLOC_CHECK(stack->names);
+        stack->arena = arena_create();
+    }
+    if (stack->size == stack->capacity){
+        stack->capacity = stack->capacity ? 2 * stack->capacity : 16;
+        stack->frames = realloc(stack->frames, stack->capacity * sizeof(Scope_frame));
+        MALLOC_CHECK(stack->frames);
+    }
+
+    Scope_frame *frame = &stack->frames[stack->size];
+    frame->declared = NULL;
+    frame->local = 0;
+    stack->size += 1;
+    if (stack->size > 2) { // globals + params layer + 1st local scope -> all other nested calls add them 
+        frame->local = frame[-1].local;
     }
-    stack.top = node;
 }
 
 /**
- * This function deletes the top most scope (hash table) from the stack
+ * This function closes the top most scope, unlinking every binding it declared
  **/
 void scope_exit(){
-    Symbol_node *curr = stack.top;
-    stack.top = curr->next;
-    stack.size -= 1;
-    if (stack.top && stack.size > 2){ // global + params + 1st layer scope 
-        stack.top->local = curr->local;
+    Symbol_stack *stack = &b_ctx->scopes;
+    Scope_frame *frame = &stack->frames[stack->size - 1];
+    Binding *b = frame->declared;
+    while (b){
+        Binding *next = b->next;
+        b->name->top = b->shadowed;
+        b->next = stack->free;
+        stack->free = b;
+        b = next;
+    }
+
+    stack->size -= 1;
+    if (stack->size > 2){ // global + params + 1st layer scope 
+        frame[-1].local = frame->local;
+    }
+
+    // last scope closed, release names (their keys are only valid for this compilation)
+    if (stack->size == 0){
+        hash_table_delete(stack->names);
+        arena_destroy(stack->arena);
+        free(stack->frames);
+        *stack = (Symbol_stack){0};
     }
-    hash_table_delete(curr->hashmap);
-    free(curr);
 }
 
 /**
@@ -53,53 +72,68 @@ void scope_exit(){
  * @return      the number of scopes in the stack
  **/
 int scope_level(){
-    return stack.size;
+    return b_ctx->scopes.size;
 }
 
 /**
- * Adds entry to topmost hash table in the stack, binds name with symbol
- * @param   name        The identifier to bind symbol structure 
+ * Binds name to symbol in the topmost scope, shadowing any outer binding
+ * @param   name        The identifier (interned) to bind symbol structure 
  * @param   sym         The symbols structure describing the identifier
  **/
 void scope_bind( const char *name, Symbol *sym ){
-    if (!name || !sym || !stack.top) return;
-
-    sym->which = stack.top->local;
-    stack.top->local++;
-
-    if (!hash_table_insert(stack.top->hashmap, name, (void *)sym)){
-        fprintf(stderr, "scope_bind: hash table insert failed for %s\n", name);
-        b_ctx.resolver_errors += 1;
-        exit(1);
+    Symbol_stack *stack = &b_ctx->scopes;
+    if (!name || !sym || !stack->size) return;
+
+    Scope_frame *frame = &stack->frames[stack->size - 1];
+    Scope_name *entry = hash_table_lookup(stack->names, name);
+    if (!entry){
+        entry = arena_calloc(stack->arena, sizeof(Scope_name));
+        hash_table_insert(stack->names, name, entry);
+    } else if (entry->top && entry->top->level == stack->size){
+        fprintf(b_ctx->err, "scope_bind: %s is already bound in this scope\n", name);
+        b_ctx->resolver_errors += 1;
+        compiler_abort();
     }
+
+    sym->which = frame->local;
+    frame->local++;
+
+    Binding *b = stack->free;
+    if (b) stack->free = b->next;
+    else   b = arena_alloc(stack->arena, sizeof(Binding));
+    b->sym = sym;
+    b->level = stack->size;
+    b->name = entry;
+    b->shadowed = entry->top;
+    b->next = frame->declared;
+    frame->declared = b;
+    entry->top = b;
 }
 
 /**
- * Searches the stack of hash tables from top to bottom, looking for first entry that matches name extactly. 
+ * Finds the innermost visible binding of name, a single table probe
  * @param   name        Identifier we are trying to find 
  * @return  Struct symbol corresponding to identifier, NULL if not found 
  **/
 Symbol *scope_lookup( const char *name ){
-    if (!name) return NULL;
+    Symbol_stack *stack = &b_ctx->scopes;
+    if (!name || !stack->size) return NULL;
 
-    Symbol_node *curr = stack.top;
-    while (curr){
-        Symbol *sym = (Symbol *)hash_table_lookup(curr->hashmap, name);
-        if (sym) return sym;
-        curr = curr->next;
-    }
-
-    return NULL;
+    Scope_name *entry = hash_table_lookup(stack->names, name);
+    return entry && entry->top ? entry->top->sym : NULL;
 }
 
 /**
- * Searches top hash table for first enry that matches name exactly 
+ * Finds a binding of name declared in the topmost scope 
  * @param   name        Identifier to search in hash table
  * @return  Struct symbol corresponding to identifier, NULL if not found
  **/
 Symbol *scope_lookup_current( const char *name ){
-    if (!name || !stack.top) return NULL;
-    return (Symbol *)hash_table_lookup(stack.top->hashmap, name);
+    Symbol_stack *stack = &b_ctx->scopes;
+    if (!name || !stack->size) return NULL;
+
+    Scope_name *entry = hash_table_lookup(stack->names, name);
+    return entry && entry->top && entry->top->level == stack->size ? entry->top->sym : NULL;
 }
 
 
@@ -108,5 +142,6 @@ Symbol *scope_lookup_current( const char *name ){
  * @return current which value 
  */
 int scope_lookup_which(){
-    return stack.top->local;
-}
\ No newline at end of file
+    Symbol_stack *stack = &b_ctx->scopes;
+    return stack->frames[stack->size - 1].local;
+}
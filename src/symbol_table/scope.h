@@ -5,31 +5,46 @@
 
 #include <stdio.h>
 
+#include "arena.h"
+
 /* forward declaration */
 
 typedef struct Symbol Symbol;
 
 /* Strcutres */ 
 
-typedef struct Symbol_node Symbol_node;
+typedef struct Binding Binding;
+typedef struct Scope_name Scope_name;
 
-struct Symbol_node {
-    struct hash_table *hashmap;
-    Symbol_node *next; 
-    int params;
-    int local;
+struct Scope_name {
+    Binding *top;               // innermost visible binding of the name, NULL if none 
 };
 
-typedef struct Symbol_stack Symbol_stack;
+struct Binding {
+    Symbol *sym;                // symbol bound to the name 
+    int level;                  // scope level that declared the binding 
+    Scope_name *name;           // name the binding belongs to 
+    Binding *shadowed;          // outer binding hidden by this one 
+    Binding *next;              // next binding declared in the same scope (undo log), or free list link 
+};
 
-struct Symbol_stack {
-    Symbol_node *top;
-    int size; 
+typedef struct Scope_frame Scope_frame;
+
+struct Scope_frame {
+    Binding *declared;          // bindings to undo when the scope exits 
+    int local;                  // next local slot (which) handed out in this scope 
 };
 
-/* Global Variables */
+typedef struct Symbol_stack Symbol_stack;
 
-extern Symbol_stack stack;
+struct Symbol_stack {
+    struct hash_table *names;   // interned identifier -> Scope_name 
+    Scope_frame *frames;        // frames[0] is the global scope 
+    int capacity;               // allocated frames 
+    int size;                   // number of open scopes 
+    Binding *free;              // bindings recycled by scope_exit 
+    Arena *arena;               // Scope_name and Binding storage, released with the last scope 
+};
 
 /* function s*/
 
@@ -6,6 +6,8 @@
 #include "stmt.h"
 #include "symbol.h"
 #include "type.h"
+#include "intern.h"
+#include "bminor_context.h"
 #include "utils.h"
 
 #include <stdio.h>
@@ -28,31 +30,13 @@ const char *sym_to_str[SYMBOL_LEN] = {
  * @return Pointer to the newly created Symbol structure
  **/
 Symbol* symbol_create(symbol_t kind, Type *type, const char *name){
-    Symbol *symbol = safe_calloc(sizeof(Symbol), 1);
+    Symbol *symbol = arena_calloc(b_ctx->arena, sizeof(Symbol));
     symbol->kind = kind;
     symbol->type = type_copy(type);
-    symbol->name = safe_strdup(name);
+    symbol->name = intern(&b_ctx->names, name);
     return symbol;
 }
 
-/**
- * Frees the Symbol struct 
- * @param s pointer to the Symbol struct 
- */
-void symbol_destroy(Symbol *s){
-    if (!s) return;
-    if (s->name) {
-        free(s->name);
-        s->name = NULL;
-    }
-    if (s->type){
-        type_destroy(s->type);
-        s->type = NULL;
-    }
-    
-    free(s);
-}
-
 /**
  * This creates a deep copy of a symbol structure 
  * @param   s       symbol structure to make deep copy
@@ -72,7 +56,7 @@ Symbol* symbol_copy(Symbol *s){
  * @return  static string corresponding to the register name 
  */
 const char *symbol_codegen(Symbol *s){
-    static char name[MAX_NAME] = {0};
+    static __thread char name[MAX_NAME] = {0};
     switch (s->kind){
 		case SYMBOL_GLOBAL:
             snprintf(name, MAX_NAME,"%s",s->name);
@@ -82,8 +66,8 @@ const char *symbol_codegen(Symbol *s){
             snprintf(name, MAX_NAME,"-%d(%%rbp)", 8 * (1 + s->which));
             return name;
         default:
-            fprintf(stderr, "symbol_codegen: Unknown symbol type\n");
-            exit(EXIT_FAILURE);
+            fprintf(b_ctx->err, "symbol_codegen: Unknown symbol type\n");
+            compiler_abort();
             return NULL;
     }
 }
\ No newline at end of file
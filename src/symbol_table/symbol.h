@@ -10,6 +10,7 @@
 
 typedef struct Type Type;
 typedef struct String_lit String_lit;
+typedef struct Decl Decl;
 
 /* Structure */
 
@@ -25,11 +26,13 @@ typedef struct Symbol Symbol;
 struct Symbol {
 	symbol_t kind;				// Type of Declaration
 	Type *type;					// Type structure associated with Decl
-	char *name;					// Name associated with Decl 
+	const char *name;			// Name associated with Decl (interned) 
 	int which;					// The positional location when the Decl was defined
 	int func_decl;				// Prototype flag: 1-> Prototype, 0-> Not Prototype 
 	Symbol *prototype_def;		// Prototype definition symbol struct 
 	String_lit *str_lit;		// String node associated with symbol	
+	Decl *def;					// Global decl holding the definition (value or body) of symbol
+	int reachable;				// Reachability flag: 1-> referenced from main, 0-> dead code
 };
 
 
@@ -38,7 +41,6 @@ extern const char *sym_to_str[SYMBOL_LEN];
 /* Functions */
 
 Symbol 	   *symbol_create(symbol_t kind, Type *type, const char *name);
-void		symbol_destroy(Symbol *s);
 Symbol     *symbol_copy(Symbol *s);
 const char *symbol_codegen(Symbol *s);
 
@@ -0,0 +1,105 @@
+/* arena.c: bump allocator for memory that is released all at once */
+
+#include "arena.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Functions */
+
+/**
+ * Creates an empty arena, blocks are added on first use 
+ * @return  ptr to arena 
+ */
+Arena *arena_create(){
+    Arena *a = safe_calloc(sizeof(Arena), 1);
+    return a;
+}
+
+/**
+ * Allocates uninitialized memory from the arena. Memory lives until arena_destroy.
+ * Requests larger than a block get a block of their own.
+ * @param   a       ptr to arena 
+ * @param   size    number of bytes needed 
+ * @return  ptr to ARENA_ALIGN aligned memory 
+ */
+void *arena_alloc(Arena *a, size_t size){
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    Arena_block *b = a->head;
+
+    if (!b || b->size - b->used < size){
+        size_t block_size = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        b = safe_malloc(sizeof(char), sizeof(Arena_block) + block_size);
+        b->size = block_size;
+        b->used = 0;
+        b->next = a->head;
+        a->head = b;
+    }
+
+    void *ptr = b->data + b->used;
+    b->used += size;
+    a->allocations++;
+    a->bytes += size;
+    return ptr;
+}
+
+/**
+ * Allocates zeroed memory from the arena 
+ * @param   a       ptr to arena 
+ * @param   size    number of bytes needed 
+ * @return  ptr to zeroed memory 
+ */
+void *arena_calloc(Arena *a, size_t size){
+    return memset(arena_alloc(a, size), 0, size);
+}
+
+/**
+ * Copies string into the arena 
+ * @param   a       ptr to arena 
+ * @param   s       string to copy 
+ * @return  ptr to copy of s 
+ */
+char *arena_strdup(Arena *a, const char *s){
+    size_t len = strlen(s) + 1;
+    return memcpy(arena_alloc(a, len), s, len);
+}
+
+/**
+ * Moves every block of other into a, so its memory lives until arena_destroy(a). 
+ * Blocks go behind a's current block, which keeps being filled. other is freed.
+ * @param   a       ptr to arena that takes the blocks 
+ * @param   other   ptr to arena to empty and free 
+ */
+void arena_adopt(Arena *a, Arena *other){
+    if (!other) return;
+    if (other->head){
+        Arena_block *tail = other->head;
+        while (tail->next) tail = tail->next;
+        if (a->head){
+            tail->next = a->head->next;
+            a->head->next = other->head;
+        } else {
+            a->head = other->head;
+        }
+    }
+    a->allocations += other->allocations;
+    a->bytes += other->bytes;
+    free(other);
+}
+
+/**
+ * Frees every block of the arena and the arena itself 
+ * @param   a       ptr to arena 
+ */
+void arena_destroy(Arena *a){
+    if (!a) return;
+    Arena_block *b = a->head;
+    while (b){
+        Arena_block *next = b->next;
+        free(b);
+        b = next;
+    }
+    free(a);
+}
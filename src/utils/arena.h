@@ -0,0 +1,42 @@
+/* arena.h: bump allocator for memory that is released all at once */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Macros */
+
+#define ARENA_BLOCK_SIZE    (64 * 1024)     // default bytes per arena block 
+#define ARENA_ALIGN         8               // alignment of every allocation 
+
+/* Structure */
+
+typedef struct Arena_block Arena_block;
+
+struct Arena_block {
+    Arena_block *next;          // previously filled block 
+    size_t size;                // usable bytes in data 
+    size_t used;                // bytes handed out from data 
+    char data[];                // memory handed out by arena_alloc 
+};
+
+typedef struct Arena Arena;
+
+struct Arena {
+    Arena_block *head;          // block currently being filled 
+    size_t allocations;         // number of arena_alloc calls 
+    size_t bytes;               // bytes handed out 
+};
+
+/* Functions */
+
+Arena  *arena_create();
+void   *arena_alloc(Arena *a, size_t size);
+void   *arena_calloc(Arena *a, size_t size);
+char   *arena_strdup(Arena *a, const char *s);
+void    arena_adopt(Arena *a, Arena *other);
+void    arena_destroy(Arena *a);
+
+#endif
@@ -0,0 +1,129 @@
+/* pool.c: work-stealing thread pool. Every worker owns a deque holding a contiguous 
+ * range of task indices; it runs tasks from the front of its own range and, once that 
+ * is empty, steals the back half of another worker's range. */
+
+#include "pool.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/* Structure */
+
+typedef struct Pool_worker Pool_worker;
+
+struct Pool_worker {
+    Pool *pool;
+    int id;                     // index of the worker's deque 
+    pthread_t thread;
+    bool started;               // thread was created (its share is stolen otherwise)
+};
+
+/* Forward declaration of static prototypes */
+
+static bool  pool_pop(Pool_deque *d, size_t *index);
+static bool  pool_steal(Pool *p, int id);
+static void *pool_work(void *arg);
+
+/* Functions */
+
+/**
+ * Takes the next task from the front of a deque 
+ * @param   d       deque to take from 
+ * @param   index   set to the task taken 
+ * @return  true if a task was taken, false if the deque is empty 
+ */
+static bool pool_pop(Pool_deque *d, size_t *index){
+    pthread_mutex_lock(&d->lock);
+    bool found = d->head < d->tail;
+    if (found) *index = d->head++;
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+/**
+ * Moves the back half of the first non-empty deque after id's into id's deque 
+ * @param   p       pool 
+ * @param   id      worker whose deque is empty 
+ * @return  true if tasks were stolen, false if every deque is empty 
+ */
+static bool pool_steal(Pool *p, int id){
+    for (int k = 1; k < p->workers; k++){
+        Pool_deque *victim = &p->deques[(id + k) % p->workers];
+
+        pthread_mutex_lock(&victim->lock);
+        size_t take = (victim->tail - victim->head + 1) / 2;
+        victim->tail -= take;
+        size_t start = victim->tail;
+        pthread_mutex_unlock(&victim->lock);
+        if (!take) continue;
+
+        Pool_deque *own = &p->deques[id];
+        pthread_mutex_lock(&own->lock);
+        own->head = start;
+        own->tail = start + take;
+        pthread_mutex_unlock(&own->lock);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Worker loop: runs its own tasks, then steals until no work is left 
+ * @param   arg     Pool_worker 
+ * @return  NULL 
+ */
+static void *pool_work(void *arg){
+    Pool_worker *w = arg;
+    Pool *p = w->pool;
+    size_t index;
+
+    do {
+        while (pool_pop(&p->deques[w->id], &index)) p->task(p->arg, index);
+    } while (pool_steal(p, w->id));
+    return NULL;
+}
+
+/**
+ * Runs task(arg, i) for every i in [0, count) on up to workers threads (the caller 
+ * is one of them) and returns once all tasks have finished. Tasks may run in any 
+ * order and must not depend on each other.
+ * @param   workers     number of threads to use 
+ * @param   count       number of tasks 
+ * @param   task        function to run for each index 
+ * @param   arg         passed to every task 
+ */
+void pool_run(int workers, size_t count, Pool_task task, void *arg){
+    if (workers > (int)count) workers = count;
+    if (workers <= 1){
+        for (size_t i = 0; i < count; i++) task(arg, i);
+        return;
+    }
+
+    Pool p = { .workers = workers, .task = task, .arg = arg };
+    p.deques = safe_calloc(sizeof(Pool_deque), workers);
+    Pool_worker *w = safe_calloc(sizeof(Pool_worker), workers);
+
+    // start each worker on an equal contiguous share 
+    for (int i = 0; i < workers; i++){
+        pthread_mutex_init(&p.deques[i].lock, NULL);
+        p.deques[i].head = count * i / workers;
+        p.deques[i].tail = count * (i + 1) / workers;
+        w[i].pool = &p;
+        w[i].id = i;
+    }
+
+    for (int i = 1; i < workers; i++){
+        w[i].started = pthread_create(&w[i].thread, NULL, pool_work, &w[i]) == 0;
+    }
+    pool_work(&w[0]);
+    for (int i = 1; i < workers; i++){
+        if (w[i].started) pthread_join(w[i].thread, NULL);
+    }
+
+    for (int i = 0; i < workers; i++) pthread_mutex_destroy(&p.deques[i].lock);
+    free(p.deques);
+    free(w);
+}
@@ -0,0 +1,34 @@
+/* pool.h: work-stealing thread pool for independent tasks */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdio.h>
+#include <pthread.h>
+
+/* Structure */
+
+typedef void (*Pool_task)(void *arg, size_t index);
+
+typedef struct Pool_deque Pool_deque;
+
+struct Pool_deque {
+    pthread_mutex_t lock;
+    size_t head;                // next task the owner runs 
+    size_t tail;                // one past the last task, thieves take from this end 
+};
+
+typedef struct Pool Pool;
+
+struct Pool {
+    Pool_deque *deques;         // one per worker 
+    int workers;                // number of workers (including the caller)
+    Pool_task task;             // function run for each index 
+    void *arg;                  // passed to every task 
+};
+
+/* Functions */
+
+void    pool_run(int workers, size_t count, Pool_task task, void *arg);
+
+#endif
@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 #include <errno.h>
 
 /* Macros */
@@ -33,7 +34,7 @@
 #define print_indent(i) \
     do { \
         for (int _i = 0; _i < ((i) * 4); _i++) \
-        printf(" "); \
+        fprintf(b_ctx->out, " "); \
     } while (0)
 
 /* File open */
@@ -44,17 +45,35 @@
     _fp; \
 })
 
+/* Allocation accounting: safe_* allocations are counted while alloc_counting is set (--time-report) */
+
+extern bool alloc_counting;
+extern size_t alloc_count;
+extern size_t alloc_bytes;
+
+#define alloc_account(n) \
+    do { \
+        if (alloc_counting){ \
+            __atomic_add_fetch(&alloc_count, 1, __ATOMIC_RELAXED); \
+            __atomic_add_fetch(&alloc_bytes, (n), __ATOMIC_RELAXED); \
+        } \
+    } while (0)
+
 /* Malloc */
 
 #define safe_malloc(t, s) ({ \
-    void *_ptr = malloc((t) * (s)); \
+    size_t _size = (t) * (s); \
+    void *_ptr = malloc(_size); \
     MALLOC_CHECK(_ptr); \
+    alloc_account(_size); \
     _ptr; \
 }) 
 
 #define safe_calloc(t, s) ({ \
+    size_t _size = (t) * (s); \
     void *_ptr = calloc((s), (t)); \
     MALLOC_CHECK(_ptr); \
+    alloc_account(_size); \
     _ptr; \
 })
 
@@ -63,6 +82,7 @@
 #define safe_strdup(s) ({ \
     char *_ptr = strdup(s); \
     MALLOC_CHECK(_ptr); \
+    alloc_account(strlen(_ptr) + 1); \
     _ptr; \
 })
 
@@ -0,0 +1,260 @@
+/* bench_gen.c: generates synthetic Bminor programs of a given size for compile-time benchmarks */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Macros */
+
+#define BENCH_LOOP_TRIPS    4       // iterations of every generated loop, and length of global arrays
+#define BENCH_MAX_INDENT    8       // deeper blocks are not indented further, so size grows with code
+
+/* Structure */
+
+typedef struct Bench_params Bench_params;
+
+struct Bench_params {
+    int functions;          // functions besides main, each calls the previous one
+    int globals;            // global integers (every fourth one is an array)
+    int nesting;            // depth of nested for/if blocks in each function
+    int expr_depth;         // depth of each generated expression
+    int strings;            // string literals, half of them global strings
+    int statements;         // simple statements per block
+    unsigned seed;
+};
+
+/* Globals */
+
+static unsigned bench_state;
+
+/* Forward declaration of static prototypes */
+
+static void     usage(const char *program);
+static unsigned bench_random(unsigned n);
+static int      bench_global(const Bench_params *p, int array);
+static void     bench_indent(int level);
+static void     bench_leaf(const Bench_params *p);
+static void     bench_expr(const Bench_params *p, int depth);
+static void     bench_statements(const Bench_params *p, int func, int level, int *string);
+static void     bench_block(const Bench_params *p, int func, int level, int *string);
+static void     bench_function(const Bench_params *p, int func, int *string);
+
+/* Helper Functions */
+
+/**
+ * Display usage message.
+ * @param   program     String containing name of program.
+ **/
+static void usage(const char *program){
+    fprintf(stderr, "Usage: %s [options]\n", program);
+    fprintf(stderr, "   -f N    functions (default 10)\n");
+    fprintf(stderr, "   -g N    global variables (default 10)\n");
+    fprintf(stderr, "   -n N    nesting depth of blocks (default 2)\n");
+    fprintf(stderr, "   -e N    expression depth (default 4)\n");
+    fprintf(stderr, "   -s N    string literals (default 10)\n");
+    fprintf(stderr, "   -t N    statements per block (default 3)\n");
+    fprintf(stderr, "   -r N    random seed (default 1)\n");
+}
+
+/**
+ * Returns a pseudo-random number (same sequence for the same seed on every machine)
+ * @param   n       bound
+ * @return  number in [0, n)
+ */
+static unsigned bench_random(unsigned n){
+    bench_state = bench_state * 1103515245u + 12345u;
+    return (bench_state >> 16) % n;
+}
+
+/**
+ * Picks a global of the requested kind
+ * @param   p       generator parameters
+ * @param   array   true for an array global, false for an integer global
+ * @return  index of the global, -1 if there is none of that kind
+ */
+static int bench_global(const Bench_params *p, int array){
+    int count = array ? (p->globals + 3) / 4 : p->globals - (p->globals + 3) / 4;
+    if (count <= 0) return -1;
+    int k = bench_random(count);
+    return array ? k * 4 : k + k / 3 + 1;
+}
+
+/**
+ * Prints indentation for a block level (at most BENCH_MAX_INDENT levels)
+ * @param   level   nesting level
+ */
+static void bench_indent(int level){
+    for (int i = 0; i <= level && i <= BENCH_MAX_INDENT; i++) fputs("    ", stdout);
+}
+
+/**
+ * Prints an expression leaf: a parameter, the accumulator, a global, or a literal
+ * @param   p       generator parameters
+ */
+static void bench_leaf(const Bench_params *p){
+    int global = bench_global(p, 0);
+    switch (bench_random(4)){
+        case 0:  fputs("a", stdout); break;
+        case 1:  fputs("b", stdout); break;
+        case 2:  if (global >= 0){ printf("g%d", global); break; } // fall through
+        default: printf("%u", bench_random(100)); break;
+    }
+}
+
+/**
+ * Prints an expression of the given depth. Expressions nest on the left, so they
+ * need two scratch registers however deep they are.
+ * @param   p       generator parameters
+ * @param   depth   nesting depth of the expression
+ */
+static void bench_expr(const Bench_params *p, int depth){
+    static const char *operators[] = { "+", "-", "*" };
+    if (depth <= 0){
+        bench_leaf(p);
+        return;
+    }
+    fputc('(', stdout);
+    bench_expr(p, depth - 1);
+    printf(" %s ", operators[bench_random(3)]);
+    bench_leaf(p);
+    fputc(')', stdout);
+}
+
+/**
+ * Prints the simple statements of a block: assignments, global writes, prints
+ * @param   p       generator parameters
+ * @param   func    function being generated
+ * @param   level   nesting level
+ * @param   string  next string literal to use
+ */
+static void bench_statements(const Bench_params *p, int func, int level, int *string){
+    for (int i = 0; i < p->statements; i++){
+        bench_indent(level);
+        int global = bench_global(p, 0);
+        int array = bench_global(p, 1);
+        switch (i % 3){
+            case 0:
+                fputs("x = ", stdout);
+                bench_expr(p, p->expr_depth);
+                fputs(";\n", stdout);
+                break;
+            case 1:
+                // index with the counter of the innermost loop, which sits at an even level
+                if (level > 0 && array >= 0) printf("x = x + g%d[i%d];\n", array, (level - 1) & ~1);
+                else if (global >= 0) printf("g%d = x;\n", global);
+                else fputs("x = x + 1;\n", stdout);
+                break;
+            default:
+                if (*string < p->strings){
+                    // even strings are globals declared up front, odd ones are literals
+                    if (*string % 2 == 0) printf("print s%d, x, \"\\n\";\n", *string);
+                    else printf("print \"f%d literal %d\", x, \"\\n\";\n", func, *string);
+                    (*string)++;
+                } else {
+                    fputs("x = x - 1;\n", stdout);
+                }
+                break;
+        }
+    }
+}
+
+/**
+ * Prints a block and the blocks nested in it, alternating for loops and ifs
+ * @param   p       generator parameters
+ * @param   func    function being generated
+ * @param   level   nesting level of the block
+ * @param   string  next string literal to use
+ */
+static void bench_block(const Bench_params *p, int func, int level, int *string){
+    bench_statements(p, func, level, string);
+    if (level >= p->nesting) return;
+
+    bench_indent(level);
+    if (level % 2 == 0){
+        printf("for (i%d = 0; i%d < %d; i%d++) {\n", level, level, BENCH_LOOP_TRIPS, level);
+    } else {
+        fputs("if (x > ", stdout);
+        bench_expr(p, p->expr_depth / 2);
+        fputs(") {\n", stdout);
+    }
+    bench_block(p, func, level + 1, string);
+    bench_indent(level);
+    fputs("}\n", stdout);
+}
+
+/**
+ * Prints a function: loop counters, a call to the previous function, nested blocks
+ * @param   p       generator parameters
+ * @param   func    index of the function
+ * @param   string  next string literal to use
+ */
+static void bench_function(const Bench_params *p, int func, int *string){
+    printf("f%d: function integer (a: integer, b: integer) = {\n", func);
+    fputs("    x: integer = ", stdout);
+    bench_expr(p, p->expr_depth);
+    fputs(";\n", stdout);
+    for (int i = 0; i < p->nesting; i += 2) printf("    i%d: integer;\n", i);
+    if (func > 0) printf("    x = x + f%d(a, x);\n", func - 1);
+    bench_block(p, func, 0, string);
+    fputs("    return x;\n}\n\n", stdout);
+}
+
+/* Main Execution */
+
+int main(int argc, char *argv[]){
+    Bench_params p = { .functions = 10, .globals = 10, .nesting = 2, .expr_depth = 4,
+                       .strings = 10, .statements = 3, .seed = 1 };
+    int option;
+    while ((option = getopt(argc, argv, "f:g:n:e:s:t:r:h")) != -1){
+        int value = optarg ? atoi(optarg) : 0;
+        switch (option){
+            case 'f': p.functions = value; break;
+            case 'g': p.globals = value; break;
+            case 'n': p.nesting = value; break;
+            case 'e': p.expr_depth = value; break;
+            case 's': p.strings = value; break;
+            case 't': p.statements = value; break;
+            case 'r': p.seed = value; break;
+            default:
+                usage(argv[0]);
+                return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+        if (value < 0 || (option == 't' && value < 1)){
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    bench_state = p.seed;
+
+    printf("/* generated by bench_gen -f %d -g %d -n %d -e %d -s %d -t %d -r %u */\n\n",
+           p.functions, p.globals, p.nesting, p.expr_depth, p.strings, p.statements, p.seed);
+    for (int k = 0; k < p.globals; k++){
+        if (k % 4 == 0){
+            printf("g%d: array [%d] integer = {", k, BENCH_LOOP_TRIPS);
+            for (int i = 0; i < BENCH_LOOP_TRIPS; i++) printf(i ? ", %d" : "%d", k + i);
+            fputs("};\n", stdout);
+        } else {
+            printf("g%d: integer = %d;\n", k, k);
+        }
+    }
+    for (int k = 0; k < p.strings; k += 2) printf("s%d: string = \"global string %d\";\n", k, k);
+    fputc('\n', stdout);
+
+    // strings are spread over the functions, so every function gets its share
+    int string = 0;
+    for (int f = 0; f < p.functions; f++){
+        int share = p.strings * (f + 1) / (p.functions ? p.functions : 1);
+        Bench_params fp = p;
+        fp.strings = share;
+        bench_function(&fp, f, &string);
+    }
+
+    fputs("main: function integer () = {\n", stdout);
+    if (p.functions > 0) printf("    print f%d(1, 2), \"\\n\";\n", p.functions - 1);
+    for (; string < p.strings; string++){
+        if (string % 2 == 0) printf("    print s%d, \"\\n\";\n", string);
+        else printf("    print \"main literal %d\\n\";\n", string);
+    }
+    fputs("    return 0;\n}\n", stdout);
+    return EXIT_SUCCESS;
+}
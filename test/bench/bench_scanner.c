@@ -0,0 +1,70 @@
+/* bench_scanner.c: measures scanner throughput in tokens per second */
+
+#include "token.h"
+#include "scanner.h"
+#include "bminor_context.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef LEXER_NAME
+#define LEXER_NAME "flex"
+#endif
+
+/* Main Execution */
+
+int main(int argc, const char *argv[]){
+    if (argc < 2){
+        fprintf(stderr, "Usage: %s <Bminor source file> [repetitions]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    int repeat = argc > 2 ? atoi(argv[2]) : 5;
+
+    FILE *f = safe_fopen(argv[1], "r");
+    fseek(f, 0, SEEK_END);
+    size_t size = ftell(f);
+    rewind(f);
+    char *source = safe_malloc(sizeof(char), size);
+    if (fread(source, 1, size, f) != size){
+        fprintf(stderr, "Unable to read %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    fclose(f);
+
+    // scanners may rewrite the buffer in place, so each run scans a fresh copy
+    char *buffer = safe_malloc(sizeof(char), size + 2);
+    size_t tokens = 0;
+    double best = 0;
+    for (int r = 0; r < repeat; r++){
+        memcpy(buffer, source, size);
+        buffer[size] = buffer[size + 1] = '\0';
+
+        struct timespec start, end;
+        size_t count = 0;
+        int t;
+        YYSTYPE lval;
+        yyscan_t scanner;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        Compiler *c = compiler_create(NULL);
+        yylex_init_extra(c, &scanner);
+        yy_scan_buffer(buffer, size + 2, scanner);
+        while ((t = yylex(&lval, scanner)) != 0) count++;
+        yylex_destroy(scanner);
+        compiler_destroy(c);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        if (r == 0 || seconds < best) best = seconds;
+        tokens = count;
+    }
+
+    printf("%-5s %10zu tokens  %8.2f MB  best of %d: %8.4f s  %8.2f M tokens/sec  %8.2f MB/sec\n",
+           LEXER_NAME, tokens, size / 1e6, repeat, best, tokens / best / 1e6, size / best / 1e6);
+
+    free(buffer);
+    free(source);
+    return EXIT_SUCCESS;
+}
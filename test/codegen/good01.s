@@ -0,0 +1,25 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
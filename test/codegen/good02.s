@@ -0,0 +1,78 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+
+	SUBQ  $16, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $0, -32(%rbp)
+	MOVQ $5, %rbx
+	MOVQ $5, %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, -32(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -32(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -32(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
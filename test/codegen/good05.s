@@ -0,0 +1,85 @@
+.data
+a:
+	.quad 5, 1, 2, 3, 4, 5
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $24, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_array_int
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $5, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ $5, %rbx
+	MOVQ %rbx, -16(%rbp)
+	MOVQ $5, %rbx
+	MOVQ $10, %r10
+	MOVQ %r10, %rax
+	IMUL %rbx
+	MOVQ %rax, %r10
+	MOVQ $5, %rbx
+	ADDQ %r10, %rbx
+	MOVQ $20, %r10
+	SUBQ %r10, %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
@@ -0,0 +1,89 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $24, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $20, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ $13, %rbx
+	MOVQ %rbx, -16(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ -16(%rbp), %r10
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r10
+	MOVQ %rax, %r10
+	MOVQ %r10, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $100, %rbx
+	MOVQ $10, %r10
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r10
+	MOVQ %rax, %r10
+	MOVQ %r10, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	MOVQ -16(%rbp), %r10
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r10
+	MOVQ %rax, %r10
+	MOVQ %r10, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
@@ -0,0 +1,67 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $100, %rbx
+	MOVQ $3, %r10
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r10
+	MOVQ %rdx, %r10
+	MOVQ %r10, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $100, %rbx
+	MOVQ $3, %r10
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r10
+	MOVQ %rdx, %r10
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rax
+	IMUL %r10
+	MOVQ %rax, %rbx
+	MOVQ $5, %r10
+	ADDQ %rbx, %r10
+	MOVQ $2, %rbx
+	SUBQ %rbx, %r10
+	MOVQ %r10, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
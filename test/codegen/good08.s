@@ -0,0 +1,46 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	DECQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
@@ -0,0 +1,54 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $24, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $0, %rbx
+	CMPQ $1, %rbx
+	JE .Lmain_0
+	MOVQ $1, %r10
+	MOVQ %r10, %rbx
+.Lmain_0:
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	CMPQ $1, %rbx
+	JNE .Lmain_1
+	MOVQ -8(%rbp), %r10
+	MOVQ %r10, %rbx
+.Lmain_1:
+	MOVQ %rbx, -16(%rbp)
+	MOVQ -16(%rbp), %rbx
+	CMPQ $1, %rbx
+	JNE .Lmain_2
+	MOVQ $0, %r10
+	CMPQ $0, %r10
+	JE .Lmain_3
+	MOVQ $0, %r10
+	JMP .Lmain_4
+.Lmain_3:
+	MOVQ $1, %r10
+.Lmain_4:
+	MOVQ %r10, %rbx
+.Lmain_2:
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
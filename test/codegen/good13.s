@@ -0,0 +1,167 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $40, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $10, %rbx
+	MOVQ $10, %r10
+	CMPQ %r10, %rbx
+	JNE .Lmain_0
+	MOVQ $0, %rbx
+	JMP .Lmain_1
+.Lmain_0:
+	MOVQ $1, %rbx
+.Lmain_1:
+	MOVQ %rbx, -8(%rbp)
+	MOVQ $99, %rbx
+	MOVQ $99, %r10
+	CMPQ %r10, %rbx
+	JNE .Lmain_2
+	MOVQ $0, %rbx
+	JMP .Lmain_3
+.Lmain_2:
+	MOVQ $1, %rbx
+.Lmain_3:
+	MOVQ %rbx, -16(%rbp)
+	MOVQ $1, %rbx
+	MOVQ $1, %r10
+	CMPQ %r10, %rbx
+	JE .Lmain_4
+	MOVQ $0, %rbx
+	JMP .Lmain_5
+.Lmain_4:
+	MOVQ $1, %rbx
+.Lmain_5:
+	MOVQ %rbx, -24(%rbp)
+	MOVQ $10, %rbx
+	MOVQ $100, %r10
+	CMPQ %r10, %rbx
+	JNE .Lmain_6
+	MOVQ $0, %rbx
+	JMP .Lmain_7
+.Lmain_6:
+	MOVQ $1, %rbx
+.Lmain_7:
+	MOVQ %rbx, -32(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -32(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	CMPQ $1, %rbx
+	JE .Lmain_10
+	MOVQ -16(%rbp), %r10
+	MOVQ %r10, %rbx
+.Lmain_10:
+	CMPQ $1, %rbx
+	JE .Lmain_9
+	MOVQ -24(%rbp), %r10
+	MOVQ %r10, %rbx
+.Lmain_9:
+	CMPQ $1, %rbx
+	JE .Lmain_8
+	MOVQ -32(%rbp), %r10
+	MOVQ %r10, %rbx
+.Lmain_8:
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
@@ -0,0 +1,257 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $5, %rbx
+	MOVQ $2, %r10
+	CMPQ %r10, %rbx
+	JG .Lmain_0
+	MOVQ $0, %rbx
+	JMP .Lmain_1
+.Lmain_0:
+	MOVQ $1, %rbx
+.Lmain_1:
+	MOVQ %rbx, -8(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $5, %rbx
+	MOVQ $2, %r10
+	CMPQ %r10, %rbx
+	JG .Lmain_2
+	MOVQ $0, %rbx
+	JMP .Lmain_3
+.Lmain_2:
+	MOVQ $1, %rbx
+.Lmain_3:
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $5, %rbx
+	MOVQ $5, %r10
+	CMPQ %r10, %rbx
+	JGE .Lmain_4
+	MOVQ $0, %rbx
+	JMP .Lmain_5
+.Lmain_4:
+	MOVQ $1, %rbx
+.Lmain_5:
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $5, %rbx
+	MOVQ $2, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_6
+	MOVQ $0, %rbx
+	JMP .Lmain_7
+.Lmain_6:
+	MOVQ $1, %rbx
+.Lmain_7:
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $5, %rbx
+	MOVQ $10, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_8
+	MOVQ $0, %rbx
+	JMP .Lmain_9
+.Lmain_8:
+	MOVQ $1, %rbx
+.Lmain_9:
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $5, %rbx
+	MOVQ $5, %r10
+	CMPQ %r10, %rbx
+	JLE .Lmain_10
+	MOVQ $0, %rbx
+	JMP .Lmain_11
+.Lmain_10:
+	MOVQ $1, %rbx
+.Lmain_11:
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $5, %rbx
+	MOVQ $2, %r10
+	CMPQ %r10, %rbx
+	JLE .Lmain_12
+	MOVQ $0, %rbx
+	JMP .Lmain_13
+.Lmain_12:
+	MOVQ $1, %rbx
+.Lmain_13:
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_boolean
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	CMPQ $1, %rbx
+	JNE .Lmain_14
+	MOVQ $5, %r10
+	MOVQ $4, %r11
+	CMPQ %r11, %r10
+	JGE .Lmain_15
+	MOVQ $0, %r10
+	JMP .Lmain_16
+.Lmain_15:
+	MOVQ $1, %r10
+.Lmain_16:
+	MOVQ %r10, %rbx
+.Lmain_14:
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	CMPQ $1, %rbx
+	JNE .Lmain_17
+	MOVQ $5, %r10
+	MOVQ $10, %r11
+	CMPQ %r11, %r10
+	JL .Lmain_18
+	MOVQ $0, %r10
+	JMP .Lmain_19
+.Lmain_18:
+	MOVQ $1, %r10
+.Lmain_19:
+	MOVQ %r10, %rbx
+.Lmain_17:
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	CMPQ $1, %rbx
+	JNE .Lmain_20
+	MOVQ $5, %r10
+	MOVQ $5, %r11
+	CMPQ %r11, %r10
+	JLE .Lmain_21
+	MOVQ $0, %r10
+	JMP .Lmain_22
+.Lmain_21:
+	MOVQ $1, %r10
+.Lmain_22:
+	MOVQ %r10, %rbx
+.Lmain_20:
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
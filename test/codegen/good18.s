@@ -0,0 +1,183 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+.Lmain_2:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $3, %r10
+	ADDQ %rbx, %r10
+	MOVQ $10, %rbx
+	CMPQ %rbx, %r10
+	JL .Lmain_3
+	MOVQ $0, %r10
+	JMP .Lmain_4
+.Lmain_3:
+	MOVQ $1, %r10
+.Lmain_4:
+	CMPQ $0, %r10
+	JE .Lmain_0
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	JMP .Lmain_2
+.Lmain_0:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $10, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_5
+	MOVQ $0, %rbx
+	JMP .Lmain_6
+.Lmain_5:
+	MOVQ $1, %rbx
+.Lmain_6:
+	CMPQ $0, %rbx
+	JE .Lmain_1
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	JMP .Lmain_0
+.Lmain_1:
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
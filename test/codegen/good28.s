@@ -0,0 +1,1127 @@
+.data
+a:
+	.quad 5, 0, 0, 0, 0, 0
+b:
+	.quad 5, 0, 0, 0, 0, 0
+c:
+	.quad 5, 0, 0, 0, 0, 0
+d:
+	.quad 5, str0, str0, str0, str0, str0
+e:
+	.quad 5, 0, 0, 0, 0, 0
+f:
+	.quad 5, 0, 0, 0, 0, 0
+.text
+.global allocated
+allocated:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $0, %rbx
+	MOVQ %rbx, -56(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -56(%rbp)
+	MOVQ $0, %rbx
+	MOVQ -8(%rbp), %r10
+	MOVQ (%r10, %rbx, 8), %r10
+	MOVQ -56(%rbp), %rbx
+	MOVQ -8(%rbp), %r11
+	LEAQ 8(%r11, %rbx, 8), %r11
+.Lallocated_2:
+	MOVQ -56(%rbp), %rbx
+	MOVQ $3, %r12
+	ADDQ %rbx, %r12
+	MOVQ %r10, %rbx
+	CMPQ %rbx, %r12
+	JL .Lallocated_3
+	MOVQ $0, %r12
+	JMP .Lallocated_4
+.Lallocated_3:
+	MOVQ $1, %r12
+.Lallocated_4:
+	CMPQ $0, %r12
+	JE .Lallocated_0
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_7
+	MOVQ $0, %r12
+	JMP .Lallocated_8
+.Lallocated_7:
+	MOVQ $1, %r12
+.Lallocated_8:
+	CMP $0, %r12
+	JE .Lallocated_5
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_6
+.Lallocated_5:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_6:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_11
+	MOVQ $0, %r12
+	JMP .Lallocated_12
+.Lallocated_11:
+	MOVQ $1, %r12
+.Lallocated_12:
+	CMP $0, %r12
+	JE .Lallocated_9
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_10
+.Lallocated_9:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_10:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_15
+	MOVQ $0, %r12
+	JMP .Lallocated_16
+.Lallocated_15:
+	MOVQ $1, %r12
+.Lallocated_16:
+	CMP $0, %r12
+	JE .Lallocated_13
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_14
+.Lallocated_13:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_14:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_19
+	MOVQ $0, %r12
+	JMP .Lallocated_20
+.Lallocated_19:
+	MOVQ $1, %r12
+.Lallocated_20:
+	CMP $0, %r12
+	JE .Lallocated_17
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_18
+.Lallocated_17:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_18:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_2
+.Lallocated_0:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %r10, %r12
+	CMPQ %r12, %rbx
+	JL .Lallocated_21
+	MOVQ $0, %rbx
+	JMP .Lallocated_22
+.Lallocated_21:
+	MOVQ $1, %rbx
+.Lallocated_22:
+	CMPQ $0, %rbx
+	JE .Lallocated_1
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_25
+	MOVQ $0, %r12
+	JMP .Lallocated_26
+.Lallocated_25:
+	MOVQ $1, %r12
+.Lallocated_26:
+	CMP $0, %r12
+	JE .Lallocated_23
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_24
+.Lallocated_23:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_24:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_0
+.Lallocated_1:
+	MOVQ $0, %rbx
+	MOVQ %rbx, -56(%rbp)
+	MOVQ $0, %rbx
+	MOVQ -16(%rbp), %r10
+	MOVQ (%r10, %rbx, 8), %r10
+	MOVQ -56(%rbp), %rbx
+	MOVQ -16(%rbp), %r11
+	LEAQ 8(%r11, %rbx, 8), %r11
+.Lallocated_29:
+	MOVQ -56(%rbp), %rbx
+	MOVQ $3, %r12
+	ADDQ %rbx, %r12
+	MOVQ %r10, %rbx
+	CMPQ %rbx, %r12
+	JL .Lallocated_30
+	MOVQ $0, %r12
+	JMP .Lallocated_31
+.Lallocated_30:
+	MOVQ $1, %r12
+.Lallocated_31:
+	CMPQ $0, %r12
+	JE .Lallocated_27
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_29
+.Lallocated_27:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %r10, %r12
+	CMPQ %r12, %rbx
+	JL .Lallocated_32
+	MOVQ $0, %rbx
+	JMP .Lallocated_33
+.Lallocated_32:
+	MOVQ $1, %rbx
+.Lallocated_33:
+	CMPQ $0, %rbx
+	JE .Lallocated_28
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_27
+.Lallocated_28:
+	MOVQ $0, %rbx
+	MOVQ %rbx, -56(%rbp)
+	MOVQ $0, %rbx
+	MOVQ -24(%rbp), %r10
+	MOVQ (%r10, %rbx, 8), %r10
+	MOVQ -56(%rbp), %rbx
+	MOVQ -24(%rbp), %r11
+	LEAQ 8(%r11, %rbx, 8), %r11
+.Lallocated_36:
+	MOVQ -56(%rbp), %rbx
+	MOVQ $3, %r12
+	ADDQ %rbx, %r12
+	MOVQ %r10, %rbx
+	CMPQ %rbx, %r12
+	JL .Lallocated_37
+	MOVQ $0, %r12
+	JMP .Lallocated_38
+.Lallocated_37:
+	MOVQ $1, %r12
+.Lallocated_38:
+	CMPQ $0, %r12
+	JE .Lallocated_34
+	MOVQ -56(%rbp), %rbx
+	MOVQ $4, %r12
+	CMPQ %r12, %rbx
+	JE .Lallocated_41
+	MOVQ $0, %rbx
+	JMP .Lallocated_42
+.Lallocated_41:
+	MOVQ $1, %rbx
+.Lallocated_42:
+	CMP $0, %rbx
+	JE .Lallocated_39
+	MOVQ (%r11), %rbx
+	MOVQ $97, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_40
+.Lallocated_39:
+	MOVQ (%r11), %rbx
+	MOVQ $98, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_40:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $4, %r12
+	CMPQ %r12, %rbx
+	JE .Lallocated_45
+	MOVQ $0, %rbx
+	JMP .Lallocated_46
+.Lallocated_45:
+	MOVQ $1, %rbx
+.Lallocated_46:
+	CMP $0, %rbx
+	JE .Lallocated_43
+	MOVQ (%r11), %rbx
+	MOVQ $97, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_44
+.Lallocated_43:
+	MOVQ (%r11), %rbx
+	MOVQ $98, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_44:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $4, %r12
+	CMPQ %r12, %rbx
+	JE .Lallocated_49
+	MOVQ $0, %rbx
+	JMP .Lallocated_50
+.Lallocated_49:
+	MOVQ $1, %rbx
+.Lallocated_50:
+	CMP $0, %rbx
+	JE .Lallocated_47
+	MOVQ (%r11), %rbx
+	MOVQ $97, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_48
+.Lallocated_47:
+	MOVQ (%r11), %rbx
+	MOVQ $98, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_48:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $4, %r12
+	CMPQ %r12, %rbx
+	JE .Lallocated_53
+	MOVQ $0, %rbx
+	JMP .Lallocated_54
+.Lallocated_53:
+	MOVQ $1, %rbx
+.Lallocated_54:
+	CMP $0, %rbx
+	JE .Lallocated_51
+	MOVQ (%r11), %rbx
+	MOVQ $97, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_52
+.Lallocated_51:
+	MOVQ (%r11), %rbx
+	MOVQ $98, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_52:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_36
+.Lallocated_34:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %r10, %r12
+	CMPQ %r12, %rbx
+	JL .Lallocated_55
+	MOVQ $0, %rbx
+	JMP .Lallocated_56
+.Lallocated_55:
+	MOVQ $1, %rbx
+.Lallocated_56:
+	CMPQ $0, %rbx
+	JE .Lallocated_35
+	MOVQ -56(%rbp), %rbx
+	MOVQ $4, %r12
+	CMPQ %r12, %rbx
+	JE .Lallocated_59
+	MOVQ $0, %rbx
+	JMP .Lallocated_60
+.Lallocated_59:
+	MOVQ $1, %rbx
+.Lallocated_60:
+	CMP $0, %rbx
+	JE .Lallocated_57
+	MOVQ (%r11), %rbx
+	MOVQ $97, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_58
+.Lallocated_57:
+	MOVQ (%r11), %rbx
+	MOVQ $98, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_58:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_34
+.Lallocated_35:
+	MOVQ $0, %rbx
+	MOVQ %rbx, -56(%rbp)
+	MOVQ $0, %rbx
+	MOVQ -32(%rbp), %r10
+	MOVQ (%r10, %rbx, 8), %r10
+	MOVQ -56(%rbp), %rbx
+	MOVQ -32(%rbp), %r11
+	LEAQ 8(%r11, %rbx, 8), %r11
+.Lallocated_63:
+	MOVQ -56(%rbp), %rbx
+	MOVQ $3, %r12
+	ADDQ %rbx, %r12
+	MOVQ %r10, %rbx
+	CMPQ %rbx, %r12
+	JL .Lallocated_64
+	MOVQ $0, %r12
+	JMP .Lallocated_65
+.Lallocated_64:
+	MOVQ $1, %r12
+.Lallocated_65:
+	CMPQ $0, %r12
+	JE .Lallocated_61
+	MOVQ (%r11), %rbx
+	MOVQ $str1, %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ $str1, %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ $str1, %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ $str1, %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_63
+.Lallocated_61:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %r10, %r12
+	CMPQ %r12, %rbx
+	JL .Lallocated_66
+	MOVQ $0, %rbx
+	JMP .Lallocated_67
+.Lallocated_66:
+	MOVQ $1, %rbx
+.Lallocated_67:
+	CMPQ $0, %rbx
+	JE .Lallocated_62
+	MOVQ (%r11), %rbx
+	MOVQ $str1, %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_61
+.Lallocated_62:
+	MOVQ $0, %rbx
+	MOVQ %rbx, -56(%rbp)
+	MOVQ $0, %rbx
+	MOVQ -40(%rbp), %r10
+	MOVQ (%r10, %rbx, 8), %r10
+	MOVQ -56(%rbp), %rbx
+	MOVQ -40(%rbp), %r11
+	LEAQ 8(%r11, %rbx, 8), %r11
+.Lallocated_70:
+	MOVQ -56(%rbp), %rbx
+	MOVQ $3, %r12
+	ADDQ %rbx, %r12
+	MOVQ %r10, %rbx
+	CMPQ %rbx, %r12
+	JL .Lallocated_71
+	MOVQ $0, %r12
+	JMP .Lallocated_72
+.Lallocated_71:
+	MOVQ $1, %r12
+.Lallocated_72:
+	CMPQ $0, %r12
+	JE .Lallocated_68
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_75
+	MOVQ $0, %r12
+	JMP .Lallocated_76
+.Lallocated_75:
+	MOVQ $1, %r12
+.Lallocated_76:
+	CMP $0, %r12
+	JE .Lallocated_73
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_74
+.Lallocated_73:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_74:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_79
+	MOVQ $0, %r12
+	JMP .Lallocated_80
+.Lallocated_79:
+	MOVQ $1, %r12
+.Lallocated_80:
+	CMP $0, %r12
+	JE .Lallocated_77
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_78
+.Lallocated_77:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_78:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_83
+	MOVQ $0, %r12
+	JMP .Lallocated_84
+.Lallocated_83:
+	MOVQ $1, %r12
+.Lallocated_84:
+	CMP $0, %r12
+	JE .Lallocated_81
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_82
+.Lallocated_81:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_82:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_87
+	MOVQ $0, %r12
+	JMP .Lallocated_88
+.Lallocated_87:
+	MOVQ $1, %r12
+.Lallocated_88:
+	CMP $0, %r12
+	JE .Lallocated_85
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_86
+.Lallocated_85:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_86:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_70
+.Lallocated_68:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %r10, %r12
+	CMPQ %r12, %rbx
+	JL .Lallocated_89
+	MOVQ $0, %rbx
+	JMP .Lallocated_90
+.Lallocated_89:
+	MOVQ $1, %rbx
+.Lallocated_90:
+	CMPQ $0, %rbx
+	JE .Lallocated_69
+	MOVQ -56(%rbp), %rbx
+	MOVQ $2, %r12
+	MOVQ %rbx, %rax
+	CQO
+	IDIVQ %r12
+	MOVQ %rdx, %r12
+	MOVQ $0, %rbx
+	CMPQ %rbx, %r12
+	JE .Lallocated_93
+	MOVQ $0, %r12
+	JMP .Lallocated_94
+.Lallocated_93:
+	MOVQ $1, %r12
+.Lallocated_94:
+	CMP $0, %r12
+	JE .Lallocated_91
+	MOVQ (%r11), %rbx
+	MOVQ $1, %rbx
+	MOVQ %rbx, (%r11)
+	JMP .Lallocated_92
+.Lallocated_91:
+	MOVQ (%r11), %rbx
+	MOVQ $0, %rbx
+	MOVQ %rbx, (%r11)
+.Lallocated_92:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_68
+.Lallocated_69:
+	MOVQ $0, %rbx
+	MOVQ %rbx, -56(%rbp)
+	MOVQ $0, %rbx
+	MOVQ -48(%rbp), %r10
+	MOVQ (%r10, %rbx, 8), %r10
+	MOVQ -56(%rbp), %rbx
+	MOVQ -48(%rbp), %r11
+	LEAQ 8(%r11, %rbx, 8), %r11
+.Lallocated_97:
+	MOVQ -56(%rbp), %rbx
+	MOVQ $3, %r12
+	ADDQ %rbx, %r12
+	MOVQ %r10, %rbx
+	CMPQ %rbx, %r12
+	JL .Lallocated_98
+	MOVQ $0, %r12
+	JMP .Lallocated_99
+.Lallocated_98:
+	MOVQ $1, %r12
+.Lallocated_99:
+	CMPQ $0, %r12
+	JE .Lallocated_95
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_97
+.Lallocated_95:
+	MOVQ -56(%rbp), %rbx
+	MOVQ %r10, %r12
+	CMPQ %r12, %rbx
+	JL .Lallocated_100
+	MOVQ $0, %rbx
+	JMP .Lallocated_101
+.Lallocated_100:
+	MOVQ $1, %rbx
+.Lallocated_101:
+	CMPQ $0, %rbx
+	JE .Lallocated_96
+	MOVQ (%r11), %rbx
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, (%r11)
+	MOVQ -56(%rbp), %rbx
+	MOVQ %rbx, %r12
+	INCQ %rbx
+	MOVQ %rbx, -56(%rbp)
+	ADDQ $8, %r11
+	JMP .Lallocated_95
+.Lallocated_96:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_array_bool
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_array_int
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_array_char
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -32(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_array_str
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -40(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_array_bool
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -48(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_array_int
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $10, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_character
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+.allocated_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %rbx
+	MOVQ %rbx, %rdi
+	MOVQ $b, %rbx
+	MOVQ %rbx, %rsi
+	MOVQ $c, %rbx
+	MOVQ %rbx, %rdx
+	MOVQ $d, %rbx
+	MOVQ %rbx, %rcx
+	MOVQ $e, %rbx
+	MOVQ %rbx, %r8
+	MOVQ $f, %rbx
+	MOVQ %rbx, %r9
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL allocated
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
+.data
+str0:
+	.string ""
+str1:
+	.string "hello"
@@ -0,0 +1,592 @@
+.data
+a:
+	.quad 5, 1, 2, 3, 4, 5
+g:
+	.quad 3
+.text
+.global bump
+bump:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $8, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ g, %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, g
+.bump_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
+.global noop
+noop:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+	PUSHQ %rdi
+
+	SUBQ  $0, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ -8(%rbp), %rbx
+	MOVQ $1, %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, %rax
+	JMP .noop_epilogue
+.noop_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $24, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $2, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -16(%rbp)
+	MOVQ $0, -24(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -24(%rbp)
+	MOVQ $0, %rbx
+	MOVQ $a, %r10
+	MOVQ (%r10, %rbx, 8), %r10
+	MOVQ $1, %rbx
+	SUBQ %rbx, %r10
+	MOVQ -8(%rbp), %rbx
+	MOVQ g, %r11
+	MOVQ %r11, %rax
+	IMUL %rbx
+	MOVQ %rax, %r11
+	MOVQ -24(%rbp), %rbx
+	MOVQ $a, %r12
+	LEAQ 8(%r12, %rbx, 8), %r12
+.Lmain_2:
+	MOVQ -24(%rbp), %rbx
+	MOVQ $3, %r13
+	ADDQ %rbx, %r13
+	MOVQ %r10, %rbx
+	CMPQ %rbx, %r13
+	JL .Lmain_3
+	MOVQ $0, %r13
+	JMP .Lmain_4
+.Lmain_3:
+	MOVQ $1, %r13
+.Lmain_4:
+	CMPQ $0, %r13
+	JE .Lmain_0
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r13
+	MOVQ %r13, %rdi
+	MOVQ -24(%rbp), %r13
+	MOVQ %r13, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r13
+	MOVQ $0, %rax
+	MOVQ (%r12), %r13
+	MOVQ %r11, %r14
+	MOVQ %r14, %rax
+	IMUL %r13
+	MOVQ %rax, %r14
+	ADDQ %rbx, %r14
+	MOVQ %r14, -16(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r13
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	ADDQ $8, %r12
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r13
+	MOVQ %r13, %rdi
+	MOVQ -24(%rbp), %r13
+	MOVQ %r13, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r13
+	MOVQ $0, %rax
+	MOVQ (%r12), %r13
+	MOVQ %r11, %r14
+	MOVQ %r14, %rax
+	IMUL %r13
+	MOVQ %rax, %r14
+	ADDQ %rbx, %r14
+	MOVQ %r14, -16(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r13
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	ADDQ $8, %r12
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r13
+	MOVQ %r13, %rdi
+	MOVQ -24(%rbp), %r13
+	MOVQ %r13, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r13
+	MOVQ $0, %rax
+	MOVQ (%r12), %r13
+	MOVQ %r11, %r14
+	MOVQ %r14, %rax
+	IMUL %r13
+	MOVQ %rax, %r14
+	ADDQ %rbx, %r14
+	MOVQ %r14, -16(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r13
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	ADDQ $8, %r12
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r13
+	MOVQ %r13, %rdi
+	MOVQ -24(%rbp), %r13
+	MOVQ %r13, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r13
+	MOVQ $0, %rax
+	MOVQ (%r12), %r13
+	MOVQ %r11, %r14
+	MOVQ %r14, %rax
+	IMUL %r13
+	MOVQ %rax, %r14
+	ADDQ %rbx, %r14
+	MOVQ %r14, -16(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r13
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	ADDQ $8, %r12
+	JMP .Lmain_2
+.Lmain_0:
+	MOVQ -24(%rbp), %rbx
+	MOVQ %r10, %r13
+	CMPQ %r13, %rbx
+	JL .Lmain_5
+	MOVQ $0, %rbx
+	JMP .Lmain_6
+.Lmain_5:
+	MOVQ $1, %rbx
+.Lmain_6:
+	CMPQ $0, %rbx
+	JE .Lmain_1
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r13
+	MOVQ %r13, %rdi
+	MOVQ -24(%rbp), %r13
+	MOVQ %r13, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r13
+	MOVQ $0, %rax
+	MOVQ (%r12), %r13
+	MOVQ %r11, %r14
+	MOVQ %r14, %rax
+	IMUL %r13
+	MOVQ %rax, %r14
+	ADDQ %rbx, %r14
+	MOVQ %r14, -16(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r13
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	ADDQ $8, %r12
+	JMP .Lmain_0
+.Lmain_1:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rbx
+	MOVQ %rbx, -24(%rbp)
+.Lmain_7:
+	MOVQ -24(%rbp), %rbx
+	MOVQ $3, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_9
+	MOVQ $0, %rbx
+	JMP .Lmain_10
+.Lmain_9:
+	MOVQ $1, %rbx
+.Lmain_10:
+	CMPQ $0, %rbx
+	JE .Lmain_8
+	MOVQ -16(%rbp), %rbx
+	MOVQ g, %r10
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rax
+	IMUL %r10
+	MOVQ %rax, %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL bump
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	JMP .Lmain_7
+.Lmain_8:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str1, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ g, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rbx
+	MOVQ %rbx, -24(%rbp)
+.Lmain_11:
+	MOVQ -24(%rbp), %rbx
+	MOVQ $3, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_13
+	MOVQ $0, %rbx
+	JMP .Lmain_14
+.Lmain_13:
+	MOVQ $1, %rbx
+.Lmain_14:
+	CMPQ $0, %rbx
+	JE .Lmain_12
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %r10
+	MOVQ g, %r11
+	MOVQ %r11, %rax
+	IMUL %r10
+	MOVQ %rax, %r11
+	MOVQ %r11, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL noop
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r10
+	MOVQ $0, %rax
+	ADDQ %rbx, %r10
+	MOVQ %r10, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $0, %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, -8(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	JMP .Lmain_11
+.Lmain_12:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
+.data
+str0:
+	.string "\n"
+str1:
+	.string " "
@@ -0,0 +1,1143 @@
+.data
+a:
+	.quad 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10
+g:
+	.quad 0
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $24, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $0, -8(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -16(%rbp)
+	MOVQ $7, %rbx
+	MOVQ %rbx, -24(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $a, %r10
+	LEAQ 8(%r10, %rbx, 8), %r10
+.Lmain_2:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $3, %r11
+	ADDQ %rbx, %r11
+	MOVQ $8, %rbx
+	CMPQ %rbx, %r11
+	JL .Lmain_3
+	MOVQ $0, %r11
+	JMP .Lmain_4
+.Lmain_3:
+	MOVQ $1, %r11
+.Lmain_4:
+	CMPQ $0, %r11
+	JE .Lmain_1
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	JMP .Lmain_2
+.Lmain_1:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str1, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $a, %r10
+	LEAQ 8(%r10, %rbx, 8), %r10
+.Lmain_7:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $3, %r11
+	ADDQ %rbx, %r11
+	MOVQ -24(%rbp), %rbx
+	CMPQ %rbx, %r11
+	JL .Lmain_8
+	MOVQ $0, %r11
+	JMP .Lmain_9
+.Lmain_8:
+	MOVQ $1, %r11
+.Lmain_9:
+	CMPQ $0, %r11
+	JE .Lmain_5
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	JMP .Lmain_7
+.Lmain_5:
+	MOVQ -8(%rbp), %rbx
+	MOVQ -24(%rbp), %r11
+	CMPQ %r11, %rbx
+	JL .Lmain_10
+	MOVQ $0, %rbx
+	JMP .Lmain_11
+.Lmain_10:
+	MOVQ $1, %rbx
+.Lmain_11:
+	CMPQ $0, %rbx
+	JE .Lmain_6
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r11
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $8, %r10
+	JMP .Lmain_5
+.Lmain_6:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str1, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $9, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $a, %r10
+	LEAQ 8(%r10, %rbx, 8), %r10
+.Lmain_14:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $6, %r11
+	SUBQ %r11, %rbx
+	MOVQ $0, %r11
+	CMPQ %r11, %rbx
+	JGE .Lmain_15
+	MOVQ $0, %rbx
+	JMP .Lmain_16
+.Lmain_15:
+	MOVQ $1, %rbx
+.Lmain_16:
+	CMPQ $0, %rbx
+	JE .Lmain_12
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $2, %r11
+	SUBQ %r11, %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $-16, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $2, %r11
+	SUBQ %r11, %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $-16, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $2, %r11
+	SUBQ %r11, %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $-16, %r10
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $2, %r11
+	SUBQ %r11, %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $-16, %r10
+	JMP .Lmain_14
+.Lmain_12:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $0, %r11
+	CMPQ %r11, %rbx
+	JGE .Lmain_17
+	MOVQ $0, %rbx
+	JMP .Lmain_18
+.Lmain_17:
+	MOVQ $1, %rbx
+.Lmain_18:
+	CMPQ $0, %rbx
+	JE .Lmain_13
+	MOVQ -16(%rbp), %rbx
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %r11
+	MOVQ %r11, %rdi
+	MOVQ -8(%rbp), %r11
+	MOVQ %r11, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %r11
+	MOVQ $0, %rax
+	MOVQ (%r10), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $2, %r11
+	SUBQ %r11, %rbx
+	MOVQ %rbx, -8(%rbp)
+	ADDQ $-16, %r10
+	JMP .Lmain_12
+.Lmain_13:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str1, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $1, %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $a, %r10
+	LEAQ 8(%r10, %rbx, 8), %r10
+.Lmain_19:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $9, %r11
+	CMPQ %r11, %rbx
+	JLE .Lmain_21
+	MOVQ $0, %rbx
+	JMP .Lmain_22
+.Lmain_21:
+	MOVQ $1, %rbx
+.Lmain_22:
+	CMPQ $0, %rbx
+	JE .Lmain_20
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $a, %rbx
+	MOVQ %rbx, %rdi
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rsi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL check_bounds
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ (%r10), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $3, %rbx
+	MOVQ -8(%rbp), %r11
+	ADDQ %rbx, %r11
+	MOVQ %r11, -8(%rbp)
+	ADDQ $24, %r10
+	JMP .Lmain_19
+.Lmain_20:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str1, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+.Lmain_23:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $3, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_25
+	MOVQ $0, %rbx
+	JMP .Lmain_26
+.Lmain_25:
+	MOVQ $1, %rbx
+.Lmain_26:
+	CMPQ $0, %rbx
+	JE .Lmain_24
+	MOVQ -16(%rbp), %rbx
+	MOVQ $1, %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, -16(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	JMP .Lmain_23
+.Lmain_24:
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+.Lmain_29:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $3, %r10
+	ADDQ %rbx, %r10
+	MOVQ -24(%rbp), %rbx
+	CMPQ %rbx, %r10
+	JL .Lmain_30
+	MOVQ $0, %r10
+	JMP .Lmain_31
+.Lmain_30:
+	MOVQ $1, %r10
+.Lmain_31:
+	CMPQ $0, %r10
+	JE .Lmain_27
+	MOVQ -8(%rbp), %rbx
+	MOVQ $5, %r10
+	CMPQ %r10, %rbx
+	JE .Lmain_34
+	MOVQ $0, %rbx
+	JMP .Lmain_35
+.Lmain_34:
+	MOVQ $1, %rbx
+.Lmain_35:
+	CMP $0, %rbx
+	JE .Lmain_32
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+	JMP .Lmain_33
+.Lmain_32:
+.Lmain_33:
+	MOVQ g, %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, g
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $5, %r10
+	CMPQ %r10, %rbx
+	JE .Lmain_38
+	MOVQ $0, %rbx
+	JMP .Lmain_39
+.Lmain_38:
+	MOVQ $1, %rbx
+.Lmain_39:
+	CMP $0, %rbx
+	JE .Lmain_36
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+	JMP .Lmain_37
+.Lmain_36:
+.Lmain_37:
+	MOVQ g, %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, g
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $5, %r10
+	CMPQ %r10, %rbx
+	JE .Lmain_42
+	MOVQ $0, %rbx
+	JMP .Lmain_43
+.Lmain_42:
+	MOVQ $1, %rbx
+.Lmain_43:
+	CMP $0, %rbx
+	JE .Lmain_40
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+	JMP .Lmain_41
+.Lmain_40:
+.Lmain_41:
+	MOVQ g, %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, g
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	MOVQ -8(%rbp), %rbx
+	MOVQ $5, %r10
+	CMPQ %r10, %rbx
+	JE .Lmain_46
+	MOVQ $0, %rbx
+	JMP .Lmain_47
+.Lmain_46:
+	MOVQ $1, %rbx
+.Lmain_47:
+	CMP $0, %rbx
+	JE .Lmain_44
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+	JMP .Lmain_45
+.Lmain_44:
+.Lmain_45:
+	MOVQ g, %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, g
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	JMP .Lmain_29
+.Lmain_27:
+	MOVQ -8(%rbp), %rbx
+	MOVQ -24(%rbp), %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_48
+	MOVQ $0, %rbx
+	JMP .Lmain_49
+.Lmain_48:
+	MOVQ $1, %rbx
+.Lmain_49:
+	CMPQ $0, %rbx
+	JE .Lmain_28
+	MOVQ -8(%rbp), %rbx
+	MOVQ $5, %r10
+	CMPQ %r10, %rbx
+	JE .Lmain_52
+	MOVQ $0, %rbx
+	JMP .Lmain_53
+.Lmain_52:
+	MOVQ $1, %rbx
+.Lmain_53:
+	CMP $0, %rbx
+	JE .Lmain_50
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+	JMP .Lmain_51
+.Lmain_50:
+.Lmain_51:
+	MOVQ g, %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, g
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	JMP .Lmain_27
+.Lmain_28:
+	MOVQ $0, %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
+.data
+str0:
+	.string " "
+str1:
+	.string "\n"
@@ -0,0 +1,212 @@
+.text
+.global main
+main:
+	PUSHQ %rbp
+	MOVQ  %rsp, %rbp
+
+
+	SUBQ  $40, %rsp
+
+	PUSHQ %rbx
+	PUSHQ %r12
+	PUSHQ %r13
+	PUSHQ %r14
+	PUSHQ %r15
+
+	MOVQ $0, -8(%rbp)
+	MOVQ $0, -16(%rbp)
+	MOVQ $0, -24(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -32(%rbp)
+	MOVQ $0, %rbx
+	MOVQ %rbx, -8(%rbp)
+.Lmain_0:
+	MOVQ -8(%rbp), %rbx
+	MOVQ $4, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_2
+	MOVQ $0, %rbx
+	JMP .Lmain_3
+.Lmain_2:
+	MOVQ $1, %rbx
+.Lmain_3:
+	CMPQ $0, %rbx
+	JE .Lmain_1
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str0, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rbx
+	MOVQ %rbx, -16(%rbp)
+.Lmain_4:
+	MOVQ -16(%rbp), %rbx
+	MOVQ $4, %r10
+	CMPQ %r10, %rbx
+	JL .Lmain_6
+	MOVQ $0, %rbx
+	JMP .Lmain_7
+.Lmain_6:
+	MOVQ $1, %rbx
+.Lmain_7:
+	CMPQ $0, %rbx
+	JE .Lmain_5
+	MOVQ $0, %rbx
+	MOVQ %rbx, -24(%rbp)
+.Lmain_10:
+	MOVQ -24(%rbp), %rbx
+	MOVQ $3, %r10
+	ADDQ %rbx, %r10
+	MOVQ $4, %rbx
+	CMPQ %rbx, %r10
+	JL .Lmain_11
+	MOVQ $0, %r10
+	JMP .Lmain_12
+.Lmain_11:
+	MOVQ $1, %r10
+.Lmain_12:
+	CMPQ $0, %r10
+	JE .Lmain_9
+	MOVQ -32(%rbp), %rbx
+	MOVQ -24(%rbp), %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, -32(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	MOVQ -32(%rbp), %rbx
+	MOVQ -24(%rbp), %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, -32(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	MOVQ -32(%rbp), %rbx
+	MOVQ -24(%rbp), %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, -32(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	MOVQ -32(%rbp), %rbx
+	MOVQ -24(%rbp), %r10
+	ADDQ %rbx, %r10
+	MOVQ %r10, -32(%rbp)
+	MOVQ -24(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -24(%rbp)
+	JMP .Lmain_10
+.Lmain_9:
+	MOVQ -16(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -16(%rbp)
+	JMP .Lmain_4
+.Lmain_5:
+	MOVQ -8(%rbp), %rbx
+	MOVQ %rbx, %r10
+	INCQ %rbx
+	MOVQ %rbx, -8(%rbp)
+	JMP .Lmain_0
+.Lmain_1:
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ -32(%rbp), %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_integer
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	PUSHQ %rdi
+	PUSHQ %rsi
+	PUSHQ %rdx
+	PUSHQ %rcx
+	PUSHQ %r8
+	PUSHQ %r9
+	MOVQ $str1, %rbx
+	MOVQ %rbx, %rdi
+	PUSHQ %r10
+	PUSHQ %r11
+	CALL print_string
+	POPQ %r11
+	POPQ %r10
+	POPQ %r9
+	POPQ %r8
+	POPQ %rcx
+	POPQ %rdx
+	POPQ %rsi
+	POPQ %rdi
+	MOVQ %rax, %rbx
+	MOVQ $0, %rax
+	MOVQ $0, %rbx
+	MOVQ %rbx, %rax
+	JMP .main_epilogue
+.main_epilogue:
+	POPQ %r15
+	POPQ %r14
+	POPQ %r13
+	POPQ %r12
+	POPQ %rbx
+
+	MOVQ %rbp, %rsp
+	POPQ %rbp
+	RET
+.data
+str0:
+	.string " "
+str1:
+	.string "\n"
@@ -0,0 +1,134 @@
+#!/bin/bash
+
+# compile-time benchmark: times --scan, --parse, --typecheck and --codegen on generated
+# programs of growing size, then reports throughput and how each phase scales
+# usage: bench.sh   (BENCH_SCALES, BENCH_REPEAT, BENCH_MIN_MS and BENCH_DIR adjust the run)
+
+BMINOR=./bin/bminor
+GEN=./bin/bench_gen
+SCALES=${BENCH_SCALES:-"1 2 4 8 16 32"}
+REPEAT=${BENCH_REPEAT:-3}
+MIN_NS=$(( ${BENCH_MIN_MS:-30} * 1000000 ))
+FLOOR_NS=100000
+DIR=${BENCH_DIR:-/tmp/bminor_bench}
+PHASES="scan parse typecheck codegen"
+RESULTS=$DIR/results.tsv
+
+# sweeps: name, generator flag, value per scale, flags for everything else
+SWEEPS=(
+	"functions -f 50  -g 20 -n 2 -e 4 -s 20"
+	"globals   -g 200 -f 10 -n 2 -e 4 -s 10"
+	"strings   -s 200 -f 10 -g 10 -n 2 -e 4"
+	"nesting   -n 8   -f 10 -g 10 -e 4 -s 10"
+	"expr      -e 16  -f 10 -g 10 -n 2 -s 10"
+)
+
+# codegen output must come from the compiler, not the cache
+unset BMINOR_CACHE_DIR
+
+# wall time of one run of a phase in nanoseconds. Runs repeat until BENCH_MIN_MS have
+# passed and are averaged; the best average of REPEAT such batches is kept.
+time_phase() {
+	phase=$1
+	file=$2
+	best=
+	for batch in $(seq $REPEAT); do
+		runs=0
+		start=$(date +%s%N)
+		while true; do
+			if [ $phase = codegen ]; then
+				$BMINOR --codegen $file $DIR/bench.s > /dev/null 2>&1
+			else
+				$BMINOR --$phase $file > /dev/null 2>&1
+			fi
+			if [ $? -ne 0 ]; then
+				echo "bminor --$phase failed on $file" >&2
+				return 1
+			fi
+			runs=$((runs + 1))
+			elapsed=$(( $(date +%s%N) - start ))
+			if [ $elapsed -ge $MIN_NS ]; then break; fi
+		done
+		average=$((elapsed / runs))
+		if [ -z "$best" ] || [ $average -lt $best ]; then best=$average; fi
+	done
+	echo $best
+}
+
+mkdir -p $DIR
+printf "sweep\tscale\tbytes\tphase\tns\ttotal_ns\tmeasured\n" > $RESULTS
+
+# process start-up is timed on an empty program and taken out of every measurement
+$GEN -f 0 -g 0 -s 0 > $DIR/empty.bminor
+declare -A overhead
+for phase in $PHASES; do
+	overhead[$phase]=$(time_phase $phase $DIR/empty.bminor) || exit 1
+done
+
+status=0
+for sweep in "${SWEEPS[@]}"; do
+	read name flag step base <<< "$sweep"
+	echo "Sweep: $name ($flag $step per scale, base $base)"
+	printf "%6s %10s" "scale" "KiB"
+	for phase in $PHASES; do printf " %12s" "$phase ms"; done
+	printf "\n"
+
+	for scale in $SCALES; do
+		file=$DIR/$name.$scale.bminor
+		$GEN $base $flag $(( step * scale )) > $file
+		bytes=$(stat -c %s $file)
+		printf "%6s %10.1f" $scale $(awk "BEGIN { print $bytes / 1024 }")
+		for phase in $PHASES; do
+			total=$(time_phase $phase $file) || { status=1; break 2; }
+			ns=$(( total - ${overhead[$phase]} ))
+
+			# a phase taking under FLOOR_NS, or under a tenth of the run (the rest is
+			# start-up), is too close to timer and start-up noise to scale from
+			measured=1
+			if [ $ns -lt $FLOOR_NS ] || [ $(( ns * 10 )) -lt $total ]; then measured=0; fi
+			if [ $measured -eq 1 ]; then
+				printf " %12.3f" $(awk "BEGIN { print $ns / 1e6 }")
+			else
+				printf " %12s" "noise"
+			fi
+			printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\n" $name $scale $bytes $phase $ns $total $measured >> $RESULTS
+		done
+		printf "\n"
+	done
+
+	# throughput at the largest scale, and the exponent k of time ~ size^k fitted by least
+	# squares on log time against log size (1 is linear; much more means a phase does not
+	# scale). Only samples above the noise floor are fitted, and at least three are needed.
+	awk -F'\t' -v sweep=$name -v phases="$PHASES" '
+		$1 == sweep {
+			last_bytes[$4] = $3; last_ns[$4] = $5; last_ok[$4] = $7
+			if ($7) {
+				x = log($3); y = log($5)
+				n[$4]++; sx[$4] += x; sy[$4] += y; sxx[$4] += x * x; sxy[$4] += x * y
+			}
+		}
+		END {
+			count = split(phases, order, " ")
+			for (i = 1; i <= count; i++) {
+				p = order[i]
+				if (!last_ok[p]) {
+					printf "%-10s below the noise floor at the largest scale\n", p
+					continue
+				}
+				rate = last_bytes[p] / 1024 / (last_ns[p] / 1e9)
+				d = n[p] * sxx[p] - sx[p] * sx[p]
+				if (n[p] < 3 || d <= 0) {
+					printf "%-10s %12.0f KiB/s   scaling exponent   n/a (%d samples above the noise floor)\n", p, rate, n[p]
+					continue
+				}
+				k = (n[p] * sxy[p] - sx[p] * sy[p]) / d
+				printf "%-10s %12.0f KiB/s   scaling exponent %5.2f%s\n", p, rate, k,
+				       (k > 1.5 ? "   <- superlinear" : "")
+			}
+		}' $RESULTS
+	echo
+done
+
+rm -f $DIR/bench.s
+echo "Results: $RESULTS"
+exit $status
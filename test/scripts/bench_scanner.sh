@@ -0,0 +1,30 @@
+#!/bin/bash
+
+# compare scanner throughput of the flex scanner and the hand-written lexer
+# usage: bench_scanner.sh [input file]   (BENCH_MB sets the size of the generated input)
+
+INPUT=${1:-/tmp/bminor_bench_scanner.bminor}
+BENCH_MB=${BENCH_MB:-32}
+
+# generate input by repeating the test programs 
+if [ ! -f "$INPUT" ]; then
+	cat ./test/scanner/good*.bminor ./test/codegen/good*.bminor > $INPUT.chunk
+	: > $INPUT
+	while [ $(stat -c %s $INPUT) -lt $((BENCH_MB * 1024 * 1024)) ]; do
+		cat $INPUT.chunk $INPUT.chunk $INPUT.chunk $INPUT.chunk >> $INPUT
+	done
+	rm -f $INPUT.chunk
+fi
+
+for lexer in flex hand; do
+	rm -f build/scanner.o bin/bench_scanner
+	if make -s LEXER=$lexer bin/bench_scanner > /dev/null 2>&1; then
+		mv bin/bench_scanner bin/bench_scanner_$lexer
+		./bin/bench_scanner_$lexer $INPUT
+	else
+		echo "$lexer: unable to build scanner (is $lexer available?)"
+	fi
+done
+
+# let the next build pick the configured lexer again
+rm -f build/scanner.o
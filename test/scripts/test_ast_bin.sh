@@ -0,0 +1,28 @@
+#!/bin/bash
+
+# run binary AST tests: each stage must print the same from the binary AST as from source
+
+GREEN='\e[32m'
+RED='\e[31m'
+NC='\e[0m'
+
+for testfile in ./test/printer/good*.bminor ./test/typechecker/good*.bminor
+do
+	if ! ./bin/bminor --emit-ast-bin $testfile $testfile.bast &> /dev/null
+	then
+		echo -e "$testfile.bast ${RED}failure${NC} (INCORRECT)"
+		continue
+	fi
+
+	for stage in --print --resolve --typecheck
+	do
+		./bin/bminor $stage $testfile &> $testfile.ast_bin.out
+		./bin/bminor --load-ast-bin $stage $testfile.bast &> $testfile.ast_bin.bast.out
+		if cmp -s "$testfile.ast_bin.out" "$testfile.ast_bin.bast.out";
+		then
+			echo -e "$testfile.bast $stage ${GREEN}success${NC} (as expected)"
+		else
+			echo -e "$testfile.bast $stage ${RED}failure${NC} (INCORRECT)"
+		fi
+	done
+done
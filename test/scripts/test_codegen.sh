@@ -1,32 +1,65 @@
 #!/bin/bash
 
-# run codegen tests
+# run codegen tests: each program is compiled, linked and run, and its output and exit
+# status must match test/codegen/goodNN.bminor.expected. A test whose output is too big
+# to commit gives its sha256 instead with '// expect-sha256: digest'. Tests with neither
+# (their output holds addresses) only have to link and exit without a signal.
+# BMINOR_UPDATE_EXPECTED=1 rewrites the expectations from the current output.
 GREEN='\e[32m'
 RED='\e[31m'
-NC='\e[0m'  
+NC='\e[0m'
 
 for testfile in ./test/codegen/good*.bminor
 do
     number=$(echo $testfile | grep -Eo "[0-9]{2,3}")
-	if ./bin/bminor --codegen $testfile ./test/codegen/good$number.s &> $testfile.out
+	if ! ./bin/bminor --codegen $testfile ./test/codegen/good$number.s &> $testfile.out
 	then
-		echo -e "$testfile success ${GREEN}(as expected)${NC} "
-
-		# compile program 
-		gcc -g "test/codegen/good$number.s" src/library/library.c -o "test/codegen/good$number.out" 
-		compile_status=$?
+		echo -e "$testfile failure ${RED}(INCORRECT)${NC} "
+		continue
+	fi
 
-		if [ $compile_status -ne 0 ]; then
-			echo "Compilation failed with status $compile_status" >> "$testfile.out"
+	# '// check: N pattern' in a test expects N lines of the assembly to match pattern
+	failed=$(grep -E "^// check: " $testfile | while read -r _ _ count pattern; do
+		found=$(grep -c "$pattern" ./test/codegen/good$number.s)
+		if [ $found -ne $count ]; then
+			echo -e "$testfile assembly ${RED}(INCORRECT)${NC}: $found lines match '$pattern', expected $count"
 		fi
+	done)
+	if [ -n "$failed" ]; then
+		echo "$failed"
+		continue
+	fi
+
+	# compile program
+	if ! gcc -no-pie -g "test/codegen/good$number.s" src/library/library.c -o "test/codegen/good$number.out" >> "$testfile.out" 2>&1
+	then
+		echo -e "$testfile link ${RED}(INCORRECT)${NC}: see $testfile.out"
+		continue
+	fi
+
+	# Run the program
+	./test/codegen/good$number.out &> $testfile.program.out
+	run_status=$?
+	echo -e "\n---------------------------------------" >> $testfile.program.out
+	echo -e "exit status $run_status" >> $testfile.program.out
 
-		# Run the program
-		./test/codegen/good$number.out &> $testfile.program.out
-		run_status=$?
-		echo -e "\n---------------------------------------" >> $testfile.program.out 
-		echo -e "exit status $run_status" >> $testfile.program.out
+	expected=$testfile.expected
+	digest=$(grep -E "^// expect-sha256: " $testfile | awk '{ print $3 }')
+	if [ "$BMINOR_UPDATE_EXPECTED" = 1 ] && [ -z "$digest" ] && [ -f $expected ]; then
+		cp $testfile.program.out $expected
+	fi
 
+	if [ -n "$digest" ]; then
+		actual=$(sha256sum < $testfile.program.out | awk '{ print $1 }')
+		[ "$actual" = "$digest" ]
+	elif [ -f $expected ]; then
+		diff -q $expected $testfile.program.out > /dev/null
 	else
-		echo -e "$testfile failure ${RED}(INCORRECT)${NC} "
+		[ $run_status -lt 128 ]
+	fi
+	if [ $? -eq 0 ]; then
+		echo -e "$testfile success ${GREEN}(as expected)${NC} "
+	else
+		echo -e "$testfile output ${RED}(INCORRECT)${NC}: compare $testfile.program.out with the expected output"
 	fi
-done
\ No newline at end of file
+done
@@ -13,4 +13,17 @@ do
 	else
 		echo -e "$testfile failure ${RED}(INCORRECT)${NC} "
 	fi
-done
\ No newline at end of file
+done
+# piped sources cannot be mapped and are read instead: printing from a pipe must
+# match printing the file
+for testfile in ./test/printer/good*.bminor
+do
+	./bin/bminor --print $testfile > $testfile.out 2>&1
+	if cat $testfile | ./bin/bminor --print /dev/stdin > $testfile.stdin.out 2>&1 &&
+	   [ -s $testfile.stdin.out ] && cmp -s $testfile.out $testfile.stdin.out
+	then
+		echo -e "$testfile from /dev/stdin success ${GREEN}(as expected)${NC} "
+	else
+		echo -e "$testfile from /dev/stdin failure ${RED}(INCORRECT)${NC} "
+	fi
+done
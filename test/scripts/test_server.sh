@@ -0,0 +1,55 @@
+#!/bin/bash
+
+# run compile server tests: codegen served from a warm unit must match the CLI, and
+# repeated requests must not grow the server (SERVER_REQUESTS, SERVER_RSS_LIMIT_KB)
+
+GREEN='\e[32m'
+RED='\e[31m'
+NC='\e[0m'
+
+SOCKET=/tmp/bminor_test_server.$$.sock
+INPUT=/tmp/bminor_test_server.$$.bminor
+REQUESTS=${SERVER_REQUESTS:-200}
+LIMIT_KB=${SERVER_RSS_LIMIT_KB:-2048}
+
+./bin/bench_gen -f 200 -g 40 -n 4 -e 8 -s 200 > $INPUT
+./bin/bminor --server $SOCKET 2> /dev/null &
+server=$!
+for wait in $(seq 50); do
+	[ -S $SOCKET ] && break
+	sleep 0.1
+done
+
+rss() {
+	awk '/^VmRSS/ { print $2 }' /proc/$server/status
+}
+
+request() {
+	./bin/bminor --client $SOCKET --codegen $INPUT $INPUT.s > /dev/null 2>&1
+}
+
+# served code matches the CLI
+./bin/bminor --codegen $INPUT $INPUT.local.s > /dev/null 2>&1
+if request && cmp -s $INPUT.s $INPUT.local.s; then
+	echo -e "codegen from warm unit ${GREEN}success${NC} (as expected)"
+else
+	echo -e "codegen from warm unit ${RED}failure${NC} (INCORRECT)"
+fi
+
+# warm up first, so the unit cache and the allocator's free lists are filled
+for i in $(seq 20); do request; done
+before=$(rss)
+failed=0
+for i in $(seq $REQUESTS); do request || failed=$((failed + 1)); done
+after=$(rss)
+
+growth=$((after - before))
+if [ $failed -eq 0 ] && [ $growth -le $LIMIT_KB ]; then
+	echo -e "RSS after $REQUESTS requests grew ${growth} KiB ${GREEN}success${NC} (as expected)"
+else
+	echo -e "RSS after $REQUESTS requests grew ${growth} KiB, $failed failed ${RED}failure${NC} (INCORRECT)"
+fi
+
+./bin/bminor --client $SOCKET --shutdown > /dev/null 2>&1 || kill $server
+wait $server
+rm -f $INPUT $INPUT.s $INPUT.local.s